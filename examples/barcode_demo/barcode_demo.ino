@@ -1,12 +1,10 @@
 //
 // 1D & 2D Barcode demo
 //
-// Some thermal printers have internal support for generating 1D and 2D barcodes
-// from a string of ASCII characters. Two functions within the Thermal_Printer library
-// allow you to access this functionality in a simple manner.
-// Even if the printer supports barcode printing, it probably doesn't support
-// the complete list of code types defined by the ESC/POS printer commands.
-// In the case of the GOOJPRT PT210/MTP-2, it only supports a small subset of 1D codes
+// The cat printers don't generate barcodes themselves (they only print
+// graphics), so this sketch draws a CODE128 barcode into a small back
+// buffer with tpDrawRect() and prints it between lines of text mode output.
+// CODE128 (code set B) covers all of the printable ASCII characters.
 //
 // written by Larry Bank
 // Copyright (c) 2021 BitBank Software, Inc.
@@ -26,7 +24,66 @@
 //
 
 #include <Thermal_Printer.h>
- 
+
+#define BAR_WIDTH 2 // pixels per module (the narrowest bar)
+#define BAR_HEIGHT 64
+static uint8_t ucBarcode[384/8 * (BAR_HEIGHT + 12)]; // bars + a line of text
+
+// The 11 module bar/space patterns of the CODE128 symbols 0-105 (1 = bar)
+const uint16_t usCode128[106] = {
+  0x6cc, 0x66c, 0x666, 0x498, 0x48c, 0x44c, 0x4c8, 0x4c4, 0x464, 0x648, 0x644, 0x624,
+  0x59c, 0x4dc, 0x4ce, 0x5cc, 0x4ec, 0x4e6, 0x672, 0x65c, 0x64e, 0x6e4, 0x674, 0x76e,
+  0x74c, 0x72c, 0x726, 0x764, 0x734, 0x732, 0x6d8, 0x6c6, 0x636, 0x518, 0x458, 0x446,
+  0x588, 0x468, 0x462, 0x688, 0x628, 0x622, 0x5b8, 0x58e, 0x46e, 0x5d8, 0x5c6, 0x476,
+  0x776, 0x68e, 0x62e, 0x6e8, 0x6e2, 0x6ee, 0x758, 0x746, 0x716, 0x768, 0x762, 0x71a,
+  0x77a, 0x642, 0x78a, 0x530, 0x50c, 0x4b0, 0x486, 0x42c, 0x426, 0x590, 0x584, 0x4d0,
+  0x4c2, 0x434, 0x432, 0x612, 0x650, 0x7ba, 0x614, 0x47a, 0x53c, 0x4bc, 0x49e, 0x5e4,
+  0x4f4, 0x4f2, 0x7a4, 0x794, 0x792, 0x6de, 0x6f6, 0x7b6, 0x578, 0x51e, 0x45e, 0x5e8,
+  0x5e2, 0x7a8, 0x7a2, 0x5de, 0x5ee, 0x75e, 0x7ae, 0x684, 0x690, 0x69c};
+#define CODE128_START_B 104
+#define CODE128_STOP 0x18eb // 13 modules
+
+//
+// Draw the bars of a pattern of iModules modules starting at x
+// returns the x after the pattern
+//
+int DrawModules(int x, uint16_t usPattern, int iModules)
+{
+  for (int i=iModules-1; i>=0; i--) {
+    if (usPattern & (1 << i))
+      tpDrawRect(x, 0, x + BAR_WIDTH - 1, BAR_HEIGHT - 1, 1, 1);
+    x += BAR_WIDTH;
+  }
+  return x;
+} /* DrawModules() */
+//
+// Draw a CODE128 (set B) barcode centered in the back buffer
+// with its text below; returns -1 if it doesn't fit
+//
+int DrawCode128(char *szText)
+{
+  int i, x, iLen = strlen(szText);
+  int iSum = CODE128_START_B; // the check symbol is a weighted sum
+
+  // start + characters + check symbol = 11 modules each, stop = 13
+  x = (tpGetWidth() - ((iLen + 2) * 11 + 13) * BAR_WIDTH) / 2;
+  if (x < 10 * BAR_WIDTH) // leave a quiet zone on both sides
+    return -1;
+  tpFill(0);
+  x = DrawModules(x, usCode128[CODE128_START_B], 11);
+  for (i=0; i<iLen; i++) {
+    int v = szText[i] - ' ';
+    if (v < 0 || v > 95)
+      return -1; // code set B is printable ASCII only
+    x = DrawModules(x, usCode128[v], 11);
+    iSum += v * (i + 1);
+  }
+  x = DrawModules(x, usCode128[iSum % 103], 11);
+  DrawModules(x, CODE128_STOP, 13);
+  tpDrawText((tpGetWidth() - iLen * 8) / 2, BAR_HEIGHT + 2, szText, FONT_SMALL, 0);
+  return 0;
+} /* DrawCode128() */
+
 void setup() {
   Serial.begin(115200);
   while (!Serial);
@@ -47,17 +104,10 @@ void setup() {
       // optionally speed up BLE data throughput if your MCU supports it
 //      tpSetWriteMode(MODE_WITHOUT_RESPONSE);
       tpAlign(ALIGN_LEFT);
-      tpPrint("This should print a 2D QR code\n\rwith the URL of my website\n\r");
-      tpAlign(ALIGN_CENTER);
-      tpQRCode((char *)"https://bitbanksoftware.com");
-      tpAlign(ALIGN_LEFT);
-      tpPrint("\n\rThis should print a CODE128\n\rof the string '123456789'\n\r");
-      // The call below specifies that the code should be 64 pixels tall
-      // and that the text encoded by the bars should be displayed below it
-      // Not all text position options work on all printers.
-      tpAlign(ALIGN_CENTER);
-      tp1DBarcode(BARCODE_CODE128, 64, (char *)"123456789", BARCODE_TEXT_BELOW);
-      tpAlign(ALIGN_LEFT);
+      tpPrint("This should print a CODE128\nof the string '123456789'\n");
+      tpSetBackBuffer(ucBarcode, iWidth, sizeof(ucBarcode) / (iWidth / 8));
+      if (DrawCode128((char *)"123456789") == 0)
+        tpPrintBuffer(); // the finished text line is printed first
       tpFeed(24); // feed the paper out a little from the print head to see what was printed
       Serial.println((char *)"Disconnecting");
       tpDisconnect();
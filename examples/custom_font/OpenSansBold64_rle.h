@@ -0,0 +1,197 @@
+// Open_Sans_Bold_64 converted by fontcomp to FONT_FORMAT_RLE (5420 bytes of glyph data instead of 15794)
+// Call tpSetFontFormat((GFXfont *)&Open_Sans_Bold_64_RLE, FONT_FORMAT_RLE) before using it
+const uint8_t Open_Sans_Bold_64_RLEBitmaps[] PROGMEM = {
+	0x10, // ' '
+	0x0B,0xB1,0xE8,0x01,0xE2,0x71,0xE5,0xE8,0xE1,0x86,0x51,0x61,0x31,0x81,0xE0,0x71,0xB1,0xDC,0x18,0x13,0x16,0x13, // '!'
+	0x09,0x49,0xE2,0x91,0xC1,0xD4,0x1C,0x1E,0xE1, // '"'
+	0xD1,0x76,0x6D,0xE1,0xE0,0x31,0xC1,0xE8,0x81,0xDD,0x15,0x1D,0xD1,0xE6,0xD1,0xDD,0x1D,0xB9,0x67,0x68,0xED,0x77,0x76,0x79,0xE2,0x91,0xDD,0x15,0x1D,0xD1,0xE5,0x19,0x76,0x78,0xEA,0xE8,0x75,0x7A,0xD4,0x1E,0x03,0x1E,0x6D,0x1D,0xD1,0x51,0xDD,0x1E,0x6D,0x1D,0xD1,0x51,0xE2,0x00, // '#'
+	0xD0,0x5E,0x81,0x25,0x4D,0x54,0xB5,0xB2,0xD7,0x37,0x1D,0xC1,0x51,0xDD,0x14,0x1E,0x02,0x1D,0xE1,0xE0,0x71,0xB1,0x53,0xD9,0x29,0x43,0x1D,0x01,0xD2,0x3E,0x33,0x1E,0x04,0x1D,0x91,0xA2,0xE1,0x91,0xD3,0x1D,0x31,0xD3,0x2D,0x21,0xD4,0x2D,0x11,0xD5,0x2D,0x02,0xD5,0x2D,0x02,0xD5,0x1D,0x12,0xD4,0x1D,0x22,0xD3,0x1E,0x04,0x1D,0x71,0xE0,0x41,0xE0,0x42,0xE0,0xD1,0xE0,0x52,0xE0,0x01,0x33,0xD3,0x1D,0x35,0x92,0xD9,0x35,0x1B,0x1E,0x23,0x1E,0x02,0x1E,0x01,0x25,0x3D,0x82,0xA4,0xD0,0x4D,0x36,0x52,0xE9,0x50, // '$'
+	0x77,0xD9,0x7D,0x42,0x72,0xD6,0x1D,0xA1,0xB2,0xDB,0x1D,0x21,0xD1,0x1D,0x21,0xD9,0x1E,0x01,0x17,0x1E,0x03,0x1D,0x71,0xD2,0x1E,0x01,0x1E,0x02,0x47,0x1D,0x51,0xE1,0x11,0xDA,0x17,0x1E,0x00,0x1E,0x00,0x1D,0x31,0xE1,0x01,0xD2,0x1E,0x11,0x1E,0x18,0x17,0x1E,0x18,0x1E,0x11,0x1E,0x20,0x1E,0x11,0x1E,0x14,0x1B,0x15,0x8D,0x81,0xB1,0xB2,0x82,0x61,0x71,0xDA,0x13,0x1C,0x1E,0x00,0x1A,0x1D,0x11,0xD0,0x47,0x12,0x17,0x12,0x1D,0x31,0x41,0xDF,0x1E,0x11,0x1A,0x1D,0x51,0x41,0xD3,0x19,0x1B,0x4D,0x01,0xD1,0x12,0x1E,0x08,0x1C,0x1A,0x1D,0x31,0x71,0x62,0x73,0x31,0xB1,0x71,0xD8,0x7D,0x01,0xE1,0x11,0xE1,0x81,0x71,0xE1,0x81,0xE1,0x11,0xE2,0x01,0xE1,0x11,0xE2,0x01,0x81,0xE0,0x81,0xDB,0x1E,0x07,0x1D,0x91,0x71,0xD2,0x16,0x1E,0x11,0x1D,0x61,0x74,0xE0,0x11,0xE0,0x21,0xD1,0x1D,0x81,0xE0,0xA1,0xE0,0x21,0xD1,0x1D,0xA1,0xD1,0x1D,0x91,0xD4,0x1C,0x1D,0x37,0xD6,0x37,0x26, // '%'
+	0xC9,0xE0,0x53,0x93,0xE0,0x11,0xD2,0x2D,0xD2,0xD5,0x1D,0xB1,0xD8,0x1E,0x11,0x1D,0x81,0xE4,0x85,0xE0,0x11,0x91,0x51,0x91,0xDF,0x17,0x1E,0x2D,0x1D,0xC1,0xDF,0x17,0x1E,0x0F,0x1E,0x0A,0x14,0x19,0x1D,0x81,0xC1,0xE0,0xD3,0xA1,0xDA,0x1D,0x71,0xDC,0x1D,0x51,0xE0,0xF1,0xE0,0xE2,0xDF,0x1D,0x11,0xBA,0x72,0xE0,0xE1,0xD4,0x1A,0x19,0x15,0x1D,0x61,0xE1,0x11,0xDA,0x1B,0x1A,0x16,0x19,0x1D,0x31,0x11,0xA1,0xD7,0x1A,0x13,0x1A,0x13,0x19,0x1D,0x21,0x51,0xA1,0xE0,0x61,0xA2,0x91,0xDB,0x1E,0x11,0x1D,0x51,0xDE,0x1D,0x31,0xE0,0x01,0xE0,0x51,0xB1,0xD0,0x1D,0x71,0xE1,0x12,0x72,0xD0,0x19,0x1D,0x07,0xD3,0x1E,0x11,0x18,0x1E,0x08,0x18,0x1E,0x08,0x18,0x1D,0xB3,0xA1,0x81,0xD8,0x23,0x1A,0x18,0x2D,0x42,0x61,0xA1,0x94,0xA3,0x9B,0x20, // '&'
+	0x09,0xE0,0x21,0xD4,0x1E,0x52, // '''
+	0x98,0x91,0x71,0x81,0x71,0xDD,0x17,0x18,0x1D,0xC1,0x81,0xDC,0x18,0x1D,0xC1,0xDD,0x1D,0xC1,0xDD,0x1E,0x0E,0x1E,0x0F,0x1E,0x20,0x1E,0xA8,0x1D,0xE1,0xE3,0x31,0x91,0xE0,0xF1,0x91,0xE0,0xF1,0x91,0xDD,0x19,0x1D,0xD1,0x91,0xD5,0x17,0x1D,0xF1,0x71,0xA1,0x71,0x10, // '('
+	0x08,0xA1,0x71,0xA1,0x71,0xDF,0x17,0x1D,0xF1,0x71,0xD5,0x19,0x1E,0x07,0x17,0x1E,0x07,0x19,0x1E,0x0F,0x1D,0xE1,0xE2,0x11,0xE1,0x01,0xE9,0x61,0xE2,0x01,0xE0,0xF1,0xE0,0xE1,0xDD,0x1D,0xC1,0xDD,0x1D,0xC1,0x81,0xDC,0x18,0x1D,0xC1,0x81,0x71,0xDD,0x17,0x18,0x17,0x19, // ')'
+	0xB9,0xDA,0x17,0x1E,0xB0,0x1D,0xE1,0x43,0xD8,0x38,0x43,0x15,0x13,0x4D,0x23,0x64,0xD9,0x1D,0x61,0xE0,0x01,0xE2,0x45,0xD8,0x56,0x5B,0x5D,0x21,0xB1,0xE1,0x51,0xD0,0x1D,0x31,0x71,0x71,0xD1,0x17,0x19,0x1D,0xA1,0xD7,0x17,0x1B,0x1A,0x1C,0x18,0x1E,0x0C,0x26,0x15,0x16,0x2B,0x2D,0x22,0xD2,0x21,0x17,0x11,0x29, // '*'
+	0xC7,0xF0,0x16,0xDC,0x7C,0xEA,0x4C,0x7C,0xF0,0x16,0x10, // '+'
+	0x39,0xE0,0xD1,0x81,0xE0,0x81,0xD3,0x1D,0x71,0xDB,0x1D,0x41,0x61,0xD5, // ','
+	0x0D,0x4E,0x62, // '-'
+	0x26,0x51,0x61,0x31,0x81,0xDB,0x1E,0x06,0x1D,0x01,0x81,0x32,0x51,0x30, // '.'
+	0xD4,0x9D,0x41,0x81,0xE1,0x71,0xD4,0x1E,0x20,0x1D,0x41,0xE2,0x01,0xD4,0x1E,0x20,0x1D,0x41,0xE0,0x51,0xD4,0x1E,0x20,0x1D,0x41,0xE2,0x01,0xD4,0x1E,0x20,0x1D,0x41,0xE0,0x51,0xD4,0x1E,0x20,0x1D,0x41,0xE2,0x01,0xD4,0x1E,0x20,0x1D,0x41,0xE1,0x71,0x81,0xE1,0x71,0xD4,0x1E,0x20,0x1D,0x41,0xE2,0x01,0xD4, // '/'
+	0xC9,0xD9,0x39,0x3D,0x42,0xD2,0x1D,0x21,0xD5,0x1D,0x01,0xD7,0x1B,0x1D,0x91,0xE0,0x51,0x81,0xE0,0xF5,0xA1,0x61,0xA1,0x51,0xDD,0x17,0x19,0x1E,0x09,0x19,0x19,0x1E,0x0E,0x1E,0x11,0x1B,0x1E,0x54,0x1E,0x02,0x1E,0xF4,0x1E,0x24,0x1E,0x32,0x1B,0x1E,0x11,0x1E,0x18,0x19,0x1D,0x01,0xDB,0x19,0x17,0x1D,0xD1,0x51,0xA1,0xD4,0x5D,0x51,0xDC,0x18,0x1E,0x1C,0x1A,0x1D,0x81,0xC2,0xD5,0x1D,0x21,0xD2,0x2D,0x43,0x93,0xA0, // '0'
+	0xD1,0x9D,0x11,0xD9,0x1D,0x82,0xD8,0x1D,0x91,0xD9,0x1D,0x82,0xD8,0x1D,0x91,0xD9,0x1D,0x82,0xA1,0xB1,0xA1,0xD9,0x1D,0x11,0x62,0xD3,0x14,0x1D,0x61,0x21,0xD8,0x2F,0x02,0xB2, // '1'
+	0xC9,0xD8,0x49,0x4D,0x22,0xD4,0x1C,0x2D,0x72,0x91,0xDB,0x17,0x1E,0x02,0x2D,0xE1,0x41,0xE0,0x01,0x41,0xB6,0xD4,0x18,0x26,0x2D,0x31,0x52,0xD7,0x16,0x12,0x2C,0x1D,0x42,0xE3,0xF1,0xE1,0xC1,0xE2,0xF1,0xDA,0x1E,0x03,0x19,0x1D,0x91,0xE0,0x31,0xA1,0xE0,0x31,0xD9,0x19,0x1D,0x91,0xE0,0x31,0xA1,0xD8,0x1A,0x1D,0x81,0xA1,0xD8,0x19,0x2D,0x81,0x91,0xD9,0x19,0x1D,0x91,0x91,0xD9,0x19,0x1D,0x91,0x91,0xD9,0x19,0x1D,0x91,0x91,0xD8,0x29,0x1D,0x81,0xBD,0x7E,0xD2, // '2'
+	0xAB,0xD6,0x4B,0x3D,0x12,0xD5,0x2A,0x2D,0x92,0x71,0xDD,0x1E,0x05,0x15,0x1E,0x05,0x1D,0xE1,0xD1,0x7D,0x61,0x43,0x72,0xD5,0x12,0x1C,0x1D,0x52,0xE1,0x31,0xE2,0x61,0xE0,0xD1,0xE1,0xB2,0x81,0xD8,0x29,0x1D,0x09,0xA1,0xE0,0x22,0xE0,0x12,0xE2,0x53,0xE0,0x52,0xE0,0x52,0xC9,0xE0,0x53,0xA1,0xDA,0x1A,0x1D,0xA1,0xEB,0xB2,0xD6,0x1D,0x12,0xD3,0x1D,0x44,0x93,0xB1,0xA9,0xE1,0x21,0xE2,0x51,0xE0,0x22,0x51,0xDC,0x18,0x2D,0x82,0xB5,0xC4,0xA0, // '3'
+	0xD7,0x9D,0xD1,0xE2,0x91,0xE0,0x51,0xE2,0x91,0xE0,0x51,0xE2,0x91,0xE0,0x51,0xE2,0x91,0x61,0xDE,0x1E,0x05,0x17,0x1E,0x21,0x17,0x1D,0xD1,0x71,0xE2,0x11,0x71,0xDD,0x17,0x1E,0x21,0x17,0x1D,0xD1,0x71,0xE2,0x11,0x71,0xDD,0x17,0x1E,0x21,0x17,0x1D,0xD1,0x8B,0x96,0xEB,0xCD,0x79,0x6F,0x01,0x45, // '4'
+	0x3D,0xCE,0x49,0x1E,0x6B,0xD4,0xEF,0x1B,0xC1,0x81,0xA3,0xE0,0x32,0xE0,0x31,0xE0,0x31,0xE0,0x31,0xE0,0x71,0xDE,0x14,0x23,0x9D,0x73,0x93,0xB1,0xD7,0x1E,0x03,0x1E,0xCE,0x1D,0x61,0x91,0x23,0xD2,0x1D,0x33,0x93,0xD7,0x9D,0x01,0xE0,0x11,0xE2,0x11,0xE0,0x11,0xE0,0x02,0x62,0xD7,0x2A,0x5B,0x4A, // '5'
+	0xD5,0xCD,0x54,0xDE,0x3E,0x01,0x1E,0x02,0x2E,0x02,0x1E,0x03,0x1E,0x03,0x1E,0x12,0xA9,0x1B,0x3A,0x17,0x1A,0x2E,0x02,0x1E,0x03,0x1D,0xA1,0x81,0xE2,0x51,0xDB,0x1E,0x13,0x8D,0xA3,0x82,0xD4,0x12,0x1D,0x02,0xD4,0x1D,0x31,0xD2,0x1D,0x51,0x41,0x81,0xD7,0x1E,0x16,0x6B,0x1D,0x21,0x62,0xDA,0x2E,0x0E,0x19,0x1B,0x1E,0x33,0x1A,0x1E,0x1B,0x1E,0x19,0x1E,0x1D,0x19,0x1A,0x19,0x1D,0x01,0x81,0xD1,0x1A,0x25,0x1D,0xF5,0xB1,0x51,0xE0,0x51,0xDC,0x1E,0x03,0x19,0x2D,0x81,0xC1,0xD6,0x1D,0x12,0xD2,0x2D,0x43,0x93,0x90, // '6'
+	0x0E,0x04,0xED,0x01,0x1D,0x9E,0x0E,0x1E,0x1C,0x1E,0x0D,0x1D,0xA1,0xE0,0xD1,0xDA,0x1E,0x0D,0x1D,0xA1,0xE0,0xD1,0xDA,0x1E,0x25,0x19,0x1E,0x25,0x1D,0xA1,0xE0,0xD1,0xDA,0x1E,0x0D,0x1D,0xA1,0xE2,0x51,0x91,0xE1,0xB1,0x91,0xE1,0xB1,0x91,0xE3,0xD1,0x91,0xE1,0xB1,0x91,0xE1,0xB1,0x91,0xE1,0xB1,0x91,0xE1,0xB1,0xDF, // '7'
+	0xC9,0xD9,0x39,0x4D,0x32,0xD3,0x2C,0x2D,0x71,0xA1,0xDA,0x18,0x1D,0xC1,0xE0,0xB1,0xB5,0xB1,0xD2,0x25,0x2D,0xB1,0x91,0xE8,0x21,0x91,0xD1,0x1D,0xE1,0xD2,0x25,0x2D,0x31,0xA1,0x31,0xA1,0xD6,0x3A,0x19,0x1D,0x91,0xB1,0xD7,0x1D,0x02,0xD3,0x2D,0x31,0xE0,0x32,0xD2,0x1D,0x21,0xD5,0x2B,0x2D,0x81,0x91,0xDB,0x1D,0x64,0xB1,0x61,0x92,0x42,0xA1,0x41,0x91,0x81,0xDA,0x1A,0x19,0x1D,0xB1,0xB1,0x81,0xD9,0x1D,0xB1,0xE3,0xA1,0xD0,0x1A,0x1E,0x02,0x1B,0x1B,0x1D,0x92,0x72,0xD0,0x1B,0x7B,0x1E,0x03,0x15,0x1E,0x05,0x1D,0xB2,0x82,0xD8,0x1C,0x2D,0x42,0xD2,0x3B,0x39, // '8'
+	0xB9,0xD9,0x39,0x3D,0x42,0xD2,0x2D,0x11,0xD6,0x1C,0x1D,0x81,0xA1,0xDA,0x18,0x1D,0xC1,0xE0,0x51,0x51,0xB5,0xDF,0x15,0x2A,0x1D,0x11,0x81,0xD0,0x19,0x1A,0x19,0x1E,0x1D,0x1E,0x19,0x1E,0x1B,0x1A,0x1E,0x33,0x1B,0x19,0x1E,0x0F,0x1D,0xA2,0x62,0xD1,0x1B,0x6E,0x16,0x1D,0x71,0x81,0x41,0xD5,0x1D,0x21,0xD3,0x1D,0x41,0xD1,0x12,0x1D,0x33,0x83,0xDA,0x8E,0x13,0x1D,0xB1,0xE2,0x51,0x81,0xE1,0xC1,0xE0,0x31,0x91,0xD8,0x29,0x18,0x1A,0x3D,0x8A,0xD0,0x1E,0x03,0x1E,0x03,0x1E,0x02,0x2E,0x02,0x1E,0x01,0x3D,0xE4,0xD2, // '9'
+	0x26,0x51,0x61,0x31,0x81,0xDB,0x1E,0x06,0x1D,0x01,0x81,0x31,0x61,0x56,0xE9,0x16,0x51,0x61,0x31,0x81,0xDB,0x1E,0x06,0x1D,0x01,0x81,0x32,0x51,0x30, // ':'
+	0x46,0x71,0x61,0x51,0x81,0xDF,0x1E,0x0C,0x1D,0x41,0x81,0x51,0x61,0x76,0xED,0x89,0xE1,0x11,0x81,0xE0,0xB1,0xD5,0x1D,0x81,0xDD,0x1D,0x61,0x61,0xD7, // ';'
+	0xE0,0x11,0xE0,0x02,0xDF,0x2D,0xF2,0xDF,0x2D,0xF2,0xDF,0x2D,0xF2,0xDF,0x2D,0x02,0xD0,0x2D,0x02,0xD0,0x2D,0x02,0xD0,0x2D,0x02,0xD0,0x2C,0x3D,0x02,0xC2,0xD1,0x2C,0x2D,0x12,0xC2,0xDF,0x2D,0xE3,0xE0,0x03,0xE0,0x32,0xD5,0x1D,0x03,0xD3,0x2D,0x12,0xD3,0x2D,0x13,0xD2,0x3D,0x12,0xD3,0x2D,0x13,0xD2,0x2D,0x22,0xD2,0x3D,0x12,0xD3,0x2E,0x03,0x2E,0x03,0x2E,0x03,0x3E,0x03,0x2E,0x03,0x2E,0x03,0x31, // '<'
+	0x0E,0x02,0xEA,0x4E,0x02,0xE6,0x4E,0x02,0xEA,0x40, // '='
+	0x01,0xE0,0x32,0xE0,0x32,0xE0,0x32,0xE0,0x32,0xE0,0x32,0xE0,0x32,0xE0,0x32,0xD4,0x2D,0x02,0xD4,0x2D,0x02,0xD4,0x2D,0x02,0xD4,0x2D,0x02,0xD4,0x3C,0x2D,0x52,0xC2,0xD5,0x2C,0x2D,0x52,0xC2,0xD5,0x2E,0x03,0x3E,0x00,0x3D,0xE2,0xDE,0x3D,0x01,0xD0,0x2D,0x12,0xB3,0xD1,0x2B,0x2D,0x13,0xA3,0xD1,0x2B,0x2D,0x22,0xB2,0xD1,0x3D,0xE2,0xDF,0x2D,0xF2,0xDE,0x3D,0xE2,0xDF,0x2D,0xE3,0xE0,0x00, // '>'
+	0xAA,0xD3,0x4A,0x3A,0x3D,0x42,0x62,0xD9,0x14,0x1D,0xC1,0x31,0xDD,0x1E,0x04,0x1D,0xD1,0xC7,0xD1,0x14,0x47,0x1D,0x32,0xC1,0xD0,0x2E,0x69,0x1D,0xF1,0x91,0xD5,0x1D,0xF1,0xA1,0xD3,0x2A,0x1D,0x31,0xB1,0xD3,0x1B,0x1D,0x31,0xA2,0xD3,0x1A,0x1D,0xF1,0xD5,0x18,0x2E,0x1C,0x1E,0x52,0x8E,0x73,0x5D,0xA2,0x51,0xD8,0x18,0x1E,0x1F,0x1E,0x3C,0x1E,0x14,0x18,0x1D,0x82,0x51,0xD0, // '?'
+	0xD9,0xBE,0x08,0x4B,0x4E,0x01,0x3D,0x62,0xDD,0x2D,0xB2,0xDA,0x1D,0xF1,0xD7,0x2E,0x01,0x2D,0x41,0xCA,0xC1,0xD2,0x1A,0x3A,0x3A,0x1D,0x01,0x92,0xD3,0x2D,0x81,0x82,0xD7,0x18,0x1A,0x18,0x1D,0xA1,0x81,0xD4,0x1D,0xC1,0xD3,0x17,0x1A,0xA7,0x17,0x16,0x17,0x18,0x3A,0x44,0x1D,0x71,0x72,0xD4,0x1B,0x1D,0x61,0xDB,0x1B,0x16,0x16,0x1E,0x15,0x1E,0x08,0x16,0x15,0x18,0x8C,0x1D,0x81,0x81,0xDE,0x1D,0x91,0xE1,0x51,0xE0,0x91,0x41,0xD4,0x1D,0x81,0xE2,0x91,0xE2,0x81,0xE5,0x71,0xE0,0xF1,0xE0,0x81,0xE0,0xC1,0xE0,0xF1,0xD2,0x18,0x14,0x16,0x12,0x16,0x1C,0x16,0x1D,0x01,0xE0,0x26,0xB3,0x71,0xD3,0x1E,0x17,0x1D,0x41,0xD1,0x1C,0x16,0x1D,0x21,0x11,0xC1,0x61,0xD1,0x1C,0x23,0x19,0x2D,0x21,0x73,0x72,0x61,0x62,0xA1,0x71,0x97,0x96,0xD8,0x1E,0x0E,0x18,0x1E,0x0E,0x18,0x1D,0xC1,0xDD,0x2D,0x73,0xD5,0x1A,0x3C,0x5D,0x92,0xBC,0xE0,0x01,0xE1,0x71,0xE1,0x72,0xDE,0x1D,0xB3,0xD8,0x3D,0xF4,0xD0,0x4D,0x30, // '@'
+	0xD3,0xCE,0x30,0x1C,0x1E,0x2E,0x1E,0x1E,0x1E,0x2C,0x1D,0x31,0xE3,0x32,0xE0,0x51,0xD5,0x1E,0x31,0x12,0x1E,0x03,0x1D,0x71,0xE5,0x31,0x81,0x41,0x81,0xE5,0x11,0x81,0x61,0x81,0xE4,0xF1,0xD4,0x18,0x1D,0xD1,0xE0,0x51,0xE2,0xC1,0xDB,0x1A,0x1D,0xA1,0x9C,0x91,0xE4,0x91,0xE0,0x31,0xE4,0x71,0xE0,0x51,0xE2,0x3D,0x3D,0x51,0x91,0xD3,0x19,0x1E,0x43,0x19,0x1D,0x51,0x91,0xE4,0x11,0x91,0xD7,0x19,0x1E,0x3F,0x1E,0x0D,0x11, // 'A'
+	0x0D,0x8E,0x06,0x4E,0x06,0x3E,0x06,0x1E,0x06,0x1E,0x06,0x1E,0x29,0x1C,0xAE,0x06,0x2E,0x06,0x1E,0x29,0x1E,0x05,0x1E,0x4A,0x1E,0x03,0x2A,0x1C,0xAB,0x1E,0x26,0x2E,0x01,0x3E,0x03,0x3E,0x06,0x2E,0x06,0x1E,0x06,0x1C,0xAE,0x06,0x3A,0x1D,0xB1,0xE3,0x31,0xDB,0x1E,0x28,0x1E,0x32,0x1D,0xA1,0xE0,0x32,0xD9,0xBC,0x1E,0x27,0x1E,0x04,0x1E,0x04,0x1E,0x04,0x1E,0x03,0x2E,0x00,0x49, // 'B'
+	0xD3,0xAD,0xA3,0xA4,0xD3,0x3D,0x43,0xC1,0xDA,0x28,0x2D,0xC1,0x71,0xE0,0x51,0xDE,0x1E,0x0D,0x1D,0x07,0xD1,0x1C,0x27,0x34,0x1D,0x42,0xC2,0x81,0xA1,0xD3,0x2D,0x31,0xDB,0x1E,0x10,0x1E,0x1F,0x1E,0x10,0x1F,0x01,0xED,0x19,0x1E,0x2B,0x1E,0x20,0x1A,0x1E,0x07,0x1D,0xB1,0xB1,0xD2,0x3D,0x52,0x94,0x91,0xD0,0x9D,0x11,0xE0,0x71,0xE0,0x71,0xE0,0x71,0xE0,0x71,0xE0,0x73,0xD6,0x2D,0x23,0xB5,0x50, // 'C'
+	0x0D,0x7E,0x09,0x4E,0x09,0x2E,0x09,0x2E,0x09,0x1E,0x09,0x2E,0x09,0x1E,0x09,0x1D,0x1A,0xE0,0x92,0xC1,0xDC,0x2B,0x1D,0xD1,0xE0,0x91,0xE1,0x31,0xDE,0x1E,0x39,0x1D,0xE1,0xF0,0x1C,0x71,0xE1,0x21,0xE2,0x31,0xE0,0x71,0xA1,0xE2,0x12,0xA1,0xDB,0x1E,0x05,0x3C,0x1D,0x09,0xD1,0x1E,0x07,0x1E,0x07,0x1E,0x07,0x1E,0x07,0x1E,0x06,0x2E,0x04,0x3E,0x02,0x4D,0x20, // 'D'
+	0x0D,0xDE,0xAA,0xD4,0xEE,0x0D,0x3E,0xAB,0xD3,0xF0,0x13,0x4D,0x4E,0xA1, // 'E'
+	0x0D,0xDE,0xAA,0xD4,0xF0,0x13,0x3D,0x3E,0xAB,0xD3,0xF0,0x1C,0xD0, // 'F'
+	0xD5,0xBD,0xA4,0xB4,0xD3,0x3D,0x63,0xB2,0xDC,0x19,0x1D,0xE1,0x81,0xE0,0x71,0xDF,0x17,0x1E,0x07,0x1D,0x19,0x61,0x61,0xD0,0x29,0x3D,0x92,0xD1,0x36,0x1B,0x1E,0x07,0x1D,0xC1,0xA1,0xE2,0xD1,0xDD,0x1E,0x38,0x1E,0x5D,0xD5,0xF0,0x11,0xE8,0xD8,0x1D,0xE1,0xE3,0x91,0xE2,0x41,0xA1,0xE0,0x91,0xDD,0x1B,0x1E,0x09,0x3D,0xA1,0xD1,0x9D,0x21,0xE0,0x91,0xE0,0x91,0xE0,0x91,0xE0,0x92,0xE0,0x92,0xD8,0x4D,0x03,0xD0,0x55, // 'G'
+	0x09,0xD6,0x9F,0x02,0x90,0xD6,0xF0,0x11,0xDD,0x6F,0x02,0xDC, // 'H'
+	0x09,0xF0,0x1C,0x30, // 'I'
+	0xB9,0xF0,0x3B,0xC1,0xE2,0x01,0xB1,0x71,0xA1,0x27,0xE0,0x21,0xE0,0xB1,0xD6,0x1D,0x61,0xD5,0x26,0x19,0x38, // 'J'
+	0x09,0xD4,0xAD,0xE1,0xE0,0x71,0xA1,0xDC,0x1A,0x1D,0xC1,0xA1,0xE0,0x71,0xDD,0x1E,0x07,0x1A,0x1D,0xC1,0xA1,0xDC,0x1A,0x1E,0x07,0x1D,0xD1,0xE0,0x71,0xA1,0xDC,0x1A,0x1D,0xC1,0xA1,0xDC,0x1A,0x1E,0x22,0x1A,0x1D,0xC1,0xA1,0xE0,0x71,0xDD,0x1E,0x07,0x1E,0x14,0x1E,0x09,0x1E,0x2F,0x1E,0x23,0x2A,0x1D,0xB1,0x21,0xA1,0xD8,0x2E,0x0D,0x1A,0x1D,0xE1,0xA1,0xE2,0x41,0xA1,0xDE,0x1A,0x1E,0x24,0x1A,0x1D,0xE1,0xA1,0xE2,0x41,0xA1,0xDE,0x1E,0x13,0x1D,0xE1,0xA1,0xE2,0x41,0xA1,0xDE,0x1A,0x11, // 'K'
+	0x09,0xF0,0x44,0xED,0x6E,0xAF, // 'L'
+	0x0D,0x0D,0x9D,0x0E,0x22,0x1D,0x71,0xE6,0x11,0xD5,0x1E,0x74,0x1E,0x02,0x1E,0x2B,0x1D,0x41,0xD9,0x1E,0x04,0x1E,0x29,0x1E,0x0B,0x18,0x1D,0x51,0x71,0xE2,0x71,0xE0,0xB1,0xE0,0x01,0x71,0xE2,0x51,0xE0,0xB1,0xE0,0x21,0xE1,0xB1,0xD2,0x1E,0x3C,0x1E,0x04,0x17,0x1D,0x01,0xE3,0xC1,0xE0,0x61,0x71,0xB1,0xE3,0xC1,0xE0,0x81,0xD4,0x1E,0x09,0x1E,0x15,0x1E,0x3B,0x17,0x17,0x1E,0x66,0x1D,0x01,0xE6,0x81,0xB1,0xE7,0x41,0xE0,0x91,0xE0,0x10, // 'M'
+	0x0C,0xD7,0x8D,0x01,0xE3,0x51,0xE0,0xC1,0xE3,0x51,0xE3,0x51,0xE3,0x51,0xE0,0xC1,0xE0,0x11,0xE1,0x61,0xE0,0x11,0xE0,0xC1,0x91,0xE2,0xB1,0x91,0xE0,0xC1,0xE0,0x11,0xE1,0x61,0xE0,0x11,0xE0,0xC1,0x91,0xE2,0xB1,0x91,0xE0,0xC1,0xE0,0x11,0xE1,0x61,0xE0,0x11,0xE0,0xC1,0x91,0xE0,0xC1,0xE0,0x11,0xE1,0x61,0xE0,0x11,0xE1,0x61,0xE0,0x11,0xE0,0xC1,0xE3,0x51,0xE3,0x51,0xE3,0x51,0xE0,0xC1,0xE3,0x51,0xD0, // 'N'
+	0xD3,0xBE,0x00,0x4B,0x4D,0xA2,0xD6,0x2D,0x62,0xDA,0x2D,0x31,0xDE,0x1D,0x11,0xE0,0x01,0xC1,0xE0,0x21,0xA1,0xE0,0x41,0x81,0xD1,0x7D,0x11,0xD7,0x27,0x3D,0x51,0xB2,0xC1,0xB1,0xD3,0x1D,0x21,0xD2,0x1A,0x1D,0x41,0xA1,0xE1,0xC1,0xD6,0x1E,0x1B,0x1E,0x0C,0x1B,0x1D,0x81,0xF0,0x22,0x51,0xD8,0x1B,0x1E,0x0C,0x1E,0x1B,0x1D,0x61,0xE1,0xC1,0xA1,0xD4,0x1A,0x1D,0x21,0xD2,0x1D,0x31,0xB1,0xD0,0x1B,0x1D,0x53,0x73,0xD6,0x1D,0x17,0xD1,0x18,0x1E,0x04,0x1A,0x1E,0x02,0x1C,0x1E,0x00,0x1D,0x11,0xDE,0x1D,0x32,0xDA,0x2D,0x62,0xD6,0x2D,0xA4,0xB4,0xD0, // 'O'
+	0x0D,0x7E,0x03,0x3E,0x03,0x2E,0x03,0x2E,0x03,0x1E,0x03,0x1E,0x23,0x1B,0x8E,0x03,0x2E,0x03,0x1A,0x1D,0x81,0xEE,0x21,0xE0,0x11,0xA1,0xD5,0x2D,0x98,0xC1,0xE2,0x11,0xE0,0x11,0xE0,0x11,0xE0,0x02,0xDF,0x2D,0xE3,0xD6,0xAF,0x01,0xED, // 'P'
+	0xD3,0xBE,0x00,0x4B,0x4D,0xA2,0xD6,0x2D,0x62,0xDA,0x2D,0x31,0xDE,0x1D,0x11,0xE0,0x01,0xC1,0xE0,0x21,0xA1,0xE0,0x41,0x81,0xD1,0x7D,0x11,0xD7,0x27,0x3D,0x51,0xB2,0xC1,0xB1,0xD3,0x1D,0x21,0xD2,0x1A,0x1D,0x41,0xA1,0xE1,0xC1,0xD6,0x1E,0x1B,0x1E,0x0C,0x1B,0x1D,0x81,0xF0,0x22,0x51,0xD8,0x1B,0x1E,0x0C,0x1E,0x1B,0x1D,0x61,0xE1,0xC1,0xA1,0xD4,0x1A,0x1D,0x21,0xD2,0x1D,0x31,0xB1,0xD0,0x1B,0x1D,0x53,0x73,0xD6,0x1D,0x17,0xD1,0x18,0x1E,0x04,0x1A,0x1E,0x02,0x1C,0x1E,0x00,0x1D,0x11,0xDE,0x1D,0x32,0xDA,0x2D,0x62,0xE0,0xF4,0xE0,0xF7,0xA1,0xE0,0xF1,0xE0,0x31,0xB1,0xE0,0x31,0xB1,0xE0,0x31,0xB1,0xE0,0x31,0xB1,0xE0,0x31,0xB1,0xE0,0x31,0xB1,0xE0,0xF1,0xE0,0x21,0xC1,0x10, // 'Q'
+	0x0D,0x6E,0x08,0x4E,0x08,0x2E,0x08,0x2E,0x08,0x1E,0x08,0x1E,0x2D,0x1D,0x38,0xE0,0x82,0xB1,0xDC,0x1E,0x08,0x1E,0xC0,0x1E,0x06,0x1A,0x1D,0xA2,0xDE,0x8C,0x1E,0x06,0x1E,0x06,0x1E,0x06,0x1E,0x06,0x1E,0x05,0x2E,0x2B,0x1D,0x96,0x91,0xE2,0x31,0x91,0xDE,0x1E,0x11,0x1D,0xE1,0x91,0xE2,0x31,0x91,0xDE,0x19,0x1E,0x23,0x19,0x1E,0x08,0x1D,0xD1,0xE0,0x81,0x91,0xE0,0x81,0xDD,0x1E,0x12,0x1D,0xD1,0xA1,0x10, // 'R'
+	0xBA,0xD4,0x3A,0x4B,0x2D,0x43,0x62,0xD9,0x14,0x1E,0x19,0x13,0x1D,0xF1,0xDC,0x1D,0x27,0xD8,0x27,0x3D,0x41,0xC4,0x31,0xE5,0xA1,0x91,0xE0,0x11,0xE0,0x12,0xD4,0x1C,0x1E,0x01,0x2D,0x21,0xD1,0x3D,0x01,0xD3,0x1D,0x01,0xD3,0x2C,0x1D,0x41,0xC1,0xD4,0x2B,0x2D,0x41,0xC2,0xE0,0x12,0xD1,0x1D,0x22,0xE0,0x12,0xB1,0xD5,0x1E,0x01,0x1E,0x01,0x1E,0x47,0x3D,0x31,0xD0,0x2E,0x01,0x48,0x2D,0x78,0xB1,0xE1,0xD1,0xDF,0x1D,0xF1,0xDF,0x15,0x3D,0x62,0x94,0xB4,0x80, // 'S'
+	0x0E,0x06,0xEE,0x0D,0x09,0xD0,0xF0,0x53,0x50, // 'T'
+	0x0A,0xD5,0xAF,0x04,0xBA,0x1E,0x07,0x1B,0x1D,0x31,0xE2,0xF1,0xDA,0x1D,0xB1,0x31,0xA1,0xC1,0xDD,0x28,0x2D,0x31,0xC8,0xC1,0x61,0xE0,0x11,0xE1,0x21,0xDF,0x1A,0x1D,0xC2,0xC2,0xD9,0x1D,0x32,0xD5,0x2D,0x63,0xB4,0xB0, // 'U'
+	0x0A,0xD9,0xA1,0x1E,0x17,0x1D,0x71,0x91,0xE1,0x01,0xE0,0x91,0xD0,0x1D,0x51,0xE1,0xC1,0xE0,0x71,0xE0,0x31,0xDC,0x1E,0x04,0x1E,0x05,0x1E,0x1F,0x1D,0x11,0xD5,0x1E,0x03,0x1E,0x21,0x1C,0x1D,0x71,0xE0,0x11,0xE2,0x31,0xA1,0xD9,0x1D,0xF1,0xE2,0x51,0x81,0xDB,0x1D,0xD1,0xE2,0x71,0x61,0xDD,0x1D,0xB1,0xE2,0x91,0x41,0xDF,0x1D,0x91,0xE4,0xD1,0x81,0x21,0x81,0xE4,0xF1,0xD5,0x1E,0x03,0x2E,0x2F,0x1D,0x31,0xE5,0x31,0xD1,0x1E,0x2A,0x1C,0x1E,0x57,0x1A,0x1D,0x30, // 'V'
+	0x0A,0xD3,0xAD,0x3A,0xE2,0x31,0xE1,0xF1,0xE2,0xD1,0xD1,0x1A,0x1D,0x11,0xE2,0xE1,0xE1,0xD1,0xDD,0x1C,0x1E,0x07,0x1E,0x09,0x1E,0x30,0x1E,0x1B,0x1D,0xD1,0xD1,0x1E,0x46,0x1E,0x07,0x1D,0x31,0xDD,0x2D,0xD1,0xDD,0x1D,0x31,0xE4,0x61,0xE0,0x51,0xD5,0x1E,0x17,0x1D,0xD1,0x71,0x21,0x71,0xE4,0x61,0xE0,0x31,0xD7,0x1E,0x15,0x1D,0xD1,0x71,0x41,0x71,0xE7,0xC1,0x81,0xE0,0x11,0x81,0xDD,0x17,0x16,0x17,0x1E,0x7C,0x1E,0x08,0x18,0x1D,0xB1,0x11,0x71,0x81,0xE2,0x91,0xDE,0x1E,0x4E,0x1E,0x05,0x1A,0x1E,0x29,0x1D,0xE1,0x71,0xE4,0x41,0xE0,0x51,0xC1,0xE4,0x51,0xE4,0xA1,0xE0,0x51,0xD1,0x1E,0x45,0x1E,0x09,0x1C, // 'W'
+	0x1B,0xD6,0xB3,0x1A,0x1D,0xF1,0x41,0xDE,0x19,0x1D,0x31,0xD2,0x1D,0x41,0xE0,0x61,0x81,0x91,0xD0,0x19,0x1D,0x71,0xE0,0x41,0xD8,0x19,0x1D,0x91,0x91,0xDA,0x1E,0x00,0x1D,0x11,0x91,0x71,0x91,0xDD,0x1E,0x04,0x1D,0x21,0x91,0xD5,0x19,0x13,0x19,0x1E,0x23,0x19,0x11,0x19,0x1D,0x91,0x91,0x91,0xE2,0x71,0xD4,0x1D,0xD1,0xE1,0xE1,0xDF,0x1D,0x01,0xE5,0x81,0xD0,0x1D,0xF1,0xE1,0xE1,0xDD,0x1D,0x41,0xDB,0x1E,0x18,0x19,0x1D,0x91,0x91,0xB1,0xD7,0x19,0x12,0x1E,0x0F,0x19,0x1D,0x51,0x91,0xD2,0x1D,0x31,0xD3,0x1E,0x07,0x1D,0x41,0xD1,0x19,0x18,0x1A,0x1C,0x1D,0x71,0xE0,0x31,0xD8,0x1A,0x19,0x1C,0x1A,0x1E,0x04,0x1D,0x51,0x91,0xDC,0x16,0x1D,0xD1,0xA1,0xD2,0x1E,0x03,0x19,0x1D,0x51,0xA1,0x21,0xE0,0x11,0xA1,0x10, // 'X'
+	0x0B,0xD5,0xB1,0x1E,0x09,0x1C,0x1D,0x31,0xD0,0x1E,0x07,0x1D,0x11,0xD1,0x1D,0x21,0xE0,0x51,0x61,0x91,0xC1,0x91,0xE1,0x41,0x91,0xA1,0x91,0xE1,0x61,0x91,0x81,0x91,0xE1,0x81,0x91,0x61,0x91,0xE1,0xA1,0x91,0x41,0x91,0xE1,0xC1,0x91,0x21,0x91,0xE1,0xE1,0x92,0x91,0xE0,0xA1,0xD8,0x1E,0x0C,0x1D,0x31,0xE2,0x41,0xD1,0x1E,0x26,0x1C,0x1E,0x28,0x1A,0x1F,0x02,0xF1, // 'Y'
+	0x0E,0x04,0xED,0x01,0x1D,0x8A,0x1D,0x91,0xE0,0xE1,0xD9,0x19,0x1D,0x91,0xE0,0xE1,0xD9,0x19,0x1D,0x91,0xE0,0xE1,0xD9,0x19,0x1D,0x91,0x91,0xD9,0x1E,0x0E,0x1D,0x91,0x91,0xD9,0x1E,0x0E,0x1D,0x91,0x91,0xD9,0x1E,0x0E,0x1D,0x91,0x91,0xD9,0x1E,0x0E,0x1D,0x91,0x91,0xD9,0x1E,0x03,0x1A,0x1E,0x03,0x1D,0x91,0x91,0xD9,0x1E,0x0E,0x1D,0x91,0x91,0xD9,0x1A,0xD9,0xED,0x20, // 'Z'
+	0x0D,0x2E,0x4D,0x6F,0x02,0x9A,0x6E,0x44, // '['
+	0x18,0xDE,0x1E,0x10,0x1E,0x06,0x1E,0x10,0x1E,0x06,0x1E,0x10,0x1E,0x06,0x1D,0x51,0xE0,0x61,0xE1,0x01,0xE0,0x61,0xE1,0x01,0xE0,0x61,0xE1,0x01,0xE0,0x61,0xE1,0x01,0x81,0xE1,0x01,0xE0,0x61,0xE1,0x01,0xE0,0x61,0xE1,0x01,0xE0,0x61,0xE1,0x01,0xE0,0x61,0xD5,0x1E,0x06,0x1E,0x10,0x1E,0x06,0x1E,0x10,0x1E,0x06,0x1E,0x10,0x1A, // 0x5C
+	0x0D,0x2E,0x44,0x6F,0x02,0x9A,0x6E,0x4D, // ']'
+	0xD1,0x5E,0x00,0x1E,0x0B,0x1D,0xE1,0xE0,0xD1,0xDC,0x1E,0x0F,0x1D,0xA1,0xE1,0x11,0xE1,0xB1,0x61,0x61,0xE1,0x91,0x61,0x11,0x61,0xE1,0x71,0x61,0x31,0x61,0xE1,0x51,0x61,0x51,0x61,0xE1,0x31,0xD1,0x16,0x1D,0x61,0xE0,0xE1,0x61,0xA1,0x61,0xE1,0x01,0x61,0x81,0x61,0xE1,0x21,0x61,0x61,0xDF,0x1C,0x1D,0x11,0xB1,0xE0,0x11,0xA1,0xD3,0x19,0x1E,0x03,0x11, // '^'
+	0x0D,0xDE,0x35, // '_'
+	0x0B,0x81,0xA1,0x81,0xA1,0x82,0x91,0x91,0xD6,0x18,0x1A,0x18,0x1A,0x27,0x1B,0x17,0x1B,0x18, // '`'
+	0xBB,0xD4,0x4B,0x3B,0x3D,0x52,0x81,0xDA,0x17,0x1D,0xB1,0xE0,0xA1,0xDB,0x1D,0x17,0xD5,0x13,0x37,0x1A,0x17,0x3B,0x1E,0x23,0x1E,0x39,0xAD,0x45,0xDC,0x2D,0xF2,0xE0,0x01,0xE0,0x11,0xE1,0x07,0xA1,0xB3,0xDF,0x1E,0x01,0x1E,0x21,0x1B,0x1E,0x16,0x1A,0x1E,0x01,0x1D,0x91,0x62,0xDB,0x6D,0x21,0xE1,0x81,0xA1,0xD6,0x1C,0x1D,0x41,0x21,0xB1,0xD1,0x2D,0x33,0x83,0x67,0x10, // 'a'
+	0x0A,0xF0,0x1B,0x91,0x67,0xDB,0x37,0x3D,0x71,0xD0,0x1D,0x51,0xD2,0x1D,0x31,0xD4,0x1D,0x11,0xD6,0x1E,0x05,0x1E,0x16,0x5D,0xE2,0x52,0xA1,0xD0,0x19,0x1E,0x1B,0x1B,0x19,0x1F,0x01,0x8D,0x1D,0x81,0xD8,0x1D,0x91,0xDA,0x1E,0x05,0x25,0x2A,0x1D,0x35,0xE3,0x21,0xC1,0xD6,0x1C,0x1D,0x61,0xD2,0x2D,0x21,0xD5,0x1D,0x01,0x78,0x53,0x73,0x80, // 'b'
+	0xCA,0xD3,0x3A,0x4A,0x2D,0x42,0x71,0xDE,0x1D,0x81,0x51,0xDE,0x1D,0xE1,0xDA,0x1D,0x37,0x91,0xB1,0x73,0x11,0xD2,0x1B,0x1D,0x21,0xD4,0x1E,0x09,0x1F,0x01,0x51,0x19,0x1E,0x00,0x1D,0x11,0xDD,0x24,0x1A,0x27,0x3D,0x67,0xA1,0xE1,0xD1,0xE0,0x01,0xE0,0x01,0xE0,0x02,0xD4,0x2A,0x3B,0x34, // 'c'
+	0xDA,0xAF,0x01,0xA3,0x76,0x1D,0x43,0x73,0xD7,0x1D,0x01,0xD5,0x1D,0x21,0xD3,0x1D,0x41,0xD1,0x1D,0x61,0xC1,0xE3,0x26,0xD2,0x1A,0x26,0x1E,0x05,0x1D,0xA1,0xA1,0xB1,0x91,0xE1,0x11,0xF0,0x17,0x51,0xA1,0x91,0xE1,0x01,0xD9,0x1E,0x05,0x26,0x2D,0x01,0xC6,0xE1,0x51,0xE0,0x51,0xD6,0x1D,0x11,0xD4,0x11,0x1D,0x11,0xD2,0x1D,0x51,0xD0,0x1D,0x73,0x73,0x58,0x10, // 'd'
+	0xC9,0xD8,0x39,0x3D,0x32,0xD2,0x2D,0x01,0xD6,0x1B,0x1D,0x81,0x91,0xDA,0x17,0x1D,0xC1,0x51,0xB5,0xDD,0x25,0x29,0x13,0x19,0x19,0x1E,0x04,0x1D,0x71,0xD7,0x1E,0x05,0x1E,0x0D,0xD0,0xEB,0xDD,0x9E,0x47,0x1E,0x0D,0x1E,0x04,0x1D,0x41,0x41,0xA1,0xD1,0x2D,0x42,0x84,0x81,0xC8,0xD0,0x1E,0x04,0x1E,0x04,0x1E,0x04,0x2E,0x04,0x1D,0x62,0xC4,0xB4,0x50, // 'e'
+	0xD0,0xAD,0x23,0xA4,0xA1,0xDD,0x1D,0x41,0x81,0xE1,0x91,0xD5,0x1E,0x12,0x6D,0x81,0x62,0xD5,0x1E,0x48,0x19,0x96,0x3D,0xA2,0xE6,0xD6,0x99,0xF0,0x2F,0x80, // 'f'
+	0xC9,0xDB,0x39,0xD1,0x82,0xE0,0x41,0xE0,0x51,0xE0,0x51,0xE1,0x14,0xD7,0x19,0x24,0x2B,0x3E,0x02,0x2D,0x31,0x81,0x81,0xEA,0x81,0x81,0xD4,0x1E,0x10,0x25,0x19,0x19,0x1A,0x5E,0x10,0x1B,0x1D,0x91,0xD0,0x2D,0x61,0xE0,0x42,0xD2,0x2D,0x13,0xD3,0x17,0x9D,0xD1,0xDE,0x1E,0x0E,0x1E,0x07,0xD0,0xD1,0x1D,0x84,0xE0,0x71,0xA1,0xDC,0x29,0x1E,0x06,0x1D,0xD1,0x62,0xE0,0x41,0xE0,0x11,0x31,0x9C,0xD0,0x18,0x2C,0x2D,0x61,0xDD,0x1E,0x0E,0x1E,0x06,0x1D,0x31,0x81,0xA1,0xD1,0x1D,0x82,0x93,0xC1,0xB9,0xC1,0xE0,0x51,0x41,0xE0,0x01,0x61,0xDE,0x18,0x1D,0xB2,0xA2,0xD7,0x2D,0x14,0xC4,0xA0, // 'g'
+	0x0A,0xF0,0x16,0xA1,0xE2,0xB8,0xD9,0x38,0x3D,0x51,0xD1,0x1D,0x31,0xD3,0x1D,0x11,0xD5,0x1C,0x1D,0x71,0xE3,0x56,0xB1,0xD0,0x26,0x1D,0xA1,0x91,0xE1,0x91,0xE0,0xF1,0xF0,0x2E,0x00, // 'h'
+	0x26,0x41,0x61,0x21,0x81,0xE1,0x01,0x81,0x21,0x61,0x46,0xE1,0x2A,0xF0,0x17,0x70, // 'i'
+	0xB6,0xD0,0x16,0x1B,0x18,0x1E,0x3D,0x18,0x1B,0x16,0x1D,0x06,0xE3,0xFA,0xF0,0x31,0x51,0x91,0x81,0xC7,0xE1,0x51,0xE0,0x91,0xD5,0x1D,0x42,0x51,0xA2,0x70, // 'j'
+	0x0A,0xF0,0x20,0x5B,0xDB,0x1A,0x1D,0xA1,0xA1,0xDA,0x1A,0x1D,0xA1,0xA1,0xDA,0x1A,0x1D,0xA1,0xA1,0xDA,0x1A,0x1D,0xA1,0xA1,0xD5,0x14,0x1A,0x1E,0x05,0x1D,0xB1,0x91,0xDB,0x1E,0x05,0x1A,0x1D,0xA1,0xA1,0xE0,0x51,0xDB,0x1A,0x1E,0x07,0x1E,0x07,0x1E,0x2B,0x1D,0xC1,0xA1,0xDA,0x11,0x1A,0x1D,0x72,0x31,0xE1,0x11,0xDC,0x1A,0x1D,0xC1,0xA1,0xDC,0x1E,0x11,0x1D,0xC1,0xA1,0xDC,0x1A,0x1E,0x20,0x1A,0x1D,0xC1,0xA1,0xDC,0x1A,0x11, // 'k'
+	0x0A,0xF0,0x21,0x10, // 'l'
+	0xD3,0x7D,0x18,0x97,0x63,0x73,0x92,0x83,0xD0,0x14,0x1D,0x02,0x52,0xD0,0x1D,0x22,0xD3,0x13,0x1D,0x32,0xE0,0x51,0xE0,0x12,0xD6,0x2D,0x71,0xE4,0xF1,0xD2,0x5D,0x45,0xDC,0x25,0x1D,0x12,0x51,0xDA,0x18,0x1C,0x18,0x1E,0x2E,0x1A,0x1A,0x1E,0x23,0x1E,0x42,0x1F,0x04,0x4E, // 'm'
+	0xD3,0x89,0x76,0x38,0x3D,0x01,0x41,0xD1,0x1D,0x31,0xD3,0x1D,0x11,0xD5,0x1B,0x2D,0x71,0xE3,0x56,0xB1,0xD0,0x26,0x1D,0xA1,0x91,0xE1,0x91,0xE0,0xF1,0xF0,0x2E,0x00, // 'n'
+	0xCA,0xD9,0x3A,0x3D,0x42,0xD3,0x1D,0x21,0xD6,0x2C,0x1D,0x91,0xA1,0xDB,0x18,0x1D,0xD1,0x61,0xE1,0x16,0xB1,0x41,0xA2,0x62,0xDB,0x1A,0x19,0x1E,0x08,0x19,0x1C,0x1E,0x0F,0x1F,0x01,0x5F,0x1D,0x91,0x91,0xB1,0xE1,0xF1,0x91,0xA1,0x91,0xD1,0x26,0x2D,0x21,0xB6,0xE1,0x11,0x61,0xDD,0x18,0x1D,0xB1,0xA1,0xD9,0x1C,0x1D,0x71,0xD1,0x2D,0x32,0xD4,0x3A,0x3A, // 'o'
+	0xD3,0x7B,0x86,0x27,0x3D,0x72,0xC1,0xD2,0x12,0x1D,0x21,0xD3,0x1D,0x41,0xD1,0x1D,0x61,0xE0,0x51,0xE1,0x65,0xDE,0x25,0x2A,0x1D,0x01,0x91,0xE1,0xB1,0xB1,0x91,0xF0,0x1A,0x31,0xB1,0x91,0xE1,0x11,0x91,0xDB,0x25,0x2A,0x1D,0x35,0xE1,0x01,0xE1,0x11,0xD6,0x1E,0x03,0x1D,0x22,0xD2,0x1D,0x51,0xD0,0x1D,0x31,0x33,0x73,0xDB,0x7F,0x01,0xC5, // 'p'
+	0xA7,0xDB,0x37,0x35,0x87,0x1D,0x01,0xD5,0x1D,0x21,0x21,0xD0,0x1D,0x41,0xD1,0x1D,0x61,0xC1,0xE3,0x26,0xD2,0x1A,0x26,0x1D,0xB1,0x91,0xE0,0x51,0xB1,0x91,0xE1,0x11,0xF0,0x17,0x51,0xA1,0x91,0xE2,0x71,0xA1,0xDA,0x26,0x2D,0x01,0xC6,0xE1,0x51,0xE0,0x51,0xD6,0x1D,0x11,0xD4,0x1D,0x31,0xD2,0x1D,0x51,0xD0,0x12,0x1D,0x43,0x73,0xDB,0x7F,0x01,0xCB, // 'q'
+	0xD3,0x71,0x77,0x2D,0x21,0x42,0x81,0xC1,0xD9,0x1E,0x10,0x2E,0x30,0x7D,0x22,0xD8,0x1D,0x91,0xD9,0x1F,0x02,0x1D, // 'r'
+	0x9A,0xD1,0x4A,0x49,0x1D,0x53,0x42,0xDC,0x1D,0xA1,0xE0,0x11,0xE0,0x96,0x71,0xD0,0x16,0x4D,0x31,0xB3,0xD0,0x1E,0x1B,0x2D,0xF2,0xD1,0x1D,0x03,0xDF,0x2A,0x1D,0x42,0x91,0xD5,0x19,0x1D,0x52,0x82,0xD5,0x19,0x2D,0xF2,0xD2,0x1C,0x2D,0xF2,0xDF,0x2D,0xF1,0x91,0xE0,0x01,0xDC,0x12,0x3D,0xF3,0x82,0xD5,0x8E,0x09,0x1E,0x19,0x1D,0xC2,0x41,0xD6,0x27,0x4C,0x38, // 's'
+	0x77,0xE0,0xD1,0xE2,0xC1,0xE1,0x31,0x9A,0x32,0xD8,0x2E,0x5E,0x4A,0xAF,0x01,0xEA,0x17,0x2D,0x37,0x71,0xE1,0x51,0xE1,0x51,0xDC,0x1D,0xC3,0x94,0x10, // 't'
+	0x09,0xD0,0xAF,0x02,0xE0,0x1E,0x0F,0x1E,0x19,0x19,0x1D,0xA1,0x62,0xD0,0x1B,0x6E,0x35,0x1D,0x72,0xB1,0xD5,0x1D,0x11,0xD3,0x1D,0x31,0xD1,0x14,0x1D,0x03,0x83,0x67,0x10, // 'u'
+	0x0A,0xD3,0xA1,0x1E,0x05,0x1B,0x1D,0x11,0xE1,0x41,0xE0,0x31,0xD0,0x1C,0x1E,0x16,0x1E,0x01,0x1D,0x21,0xA1,0xD3,0x1D,0xF1,0xE1,0x91,0x81,0xD5,0x1D,0xD1,0xE1,0xB1,0x61,0xD7,0x1D,0xB1,0xE1,0x41,0x81,0x41,0x81,0xE3,0xB1,0x81,0x21,0x81,0xE3,0xD1,0xD5,0x1D,0xD2,0xDE,0x1D,0x31,0xE4,0x11,0xD1,0x1E,0x43,0x1C,0x1E,0x20,0x1A,0x1E,0x15, // 'v'
+	0x09,0xCB,0xC9,0xA1,0xE3,0xA1,0xA1,0xD6,0x1B,0x1D,0x61,0xE2,0x41,0xE3,0x81,0xC1,0xD4,0x16,0x16,0x1D,0x41,0xE2,0x61,0xE0,0x01,0xD1,0x1E,0x12,0x1D,0x81,0x61,0x11,0x61,0xE3,0x81,0xDE,0x18,0x17,0x1E,0x26,0x16,0x1A,0x1E,0x11,0x1E,0x00,0x18,0x1D,0xC1,0x81,0xE2,0xE1,0x61,0xE1,0xE1,0x61,0xA1,0xB1,0xE3,0x91,0xE0,0x01,0xE1,0x01,0xD2,0x17,0x1D,0x21,0xD9,0x1E,0x2E,0x1E,0x20,0x1D,0x21,0xD0,0x1E,0x22,0x1E,0x37,0x1E,0x06,0x1E,0x00,0x1E,0x24,0x1E,0x23,0x1A, // 'w'
+	0x1B,0xD0,0xB3,0x1A,0x1B,0x1A,0x14,0x1E,0x13,0x19,0x1A,0x16,0x1E,0x00,0x18,0x19,0x17,0x1E,0x01,0x15,0x1A,0x1A,0x1D,0xC1,0xD9,0x13,0x1D,0xA1,0xDA,0x1D,0x11,0x91,0x11,0x91,0xDD,0x1D,0xE1,0xD6,0x1D,0x51,0xD4,0x1E,0x1D,0x1D,0x21,0xD9,0x1D,0x01,0xE2,0x01,0xD0,0x1E,0x1F,0x1D,0x21,0xD7,0x1D,0x41,0xE1,0xB1,0x91,0x91,0xD3,0x1D,0x81,0xDC,0x11,0x1D,0xB1,0x91,0x31,0x91,0xC1,0xDC,0x1D,0x81,0x51,0xD7,0x1D,0xE1,0x81,0xA1,0x71,0xA1,0xD4,0x19,0x1D,0x31,0xE0,0x21,0x41,0xA1,0xB1,0xA1,0xD0,0x1D,0x01,0xC0, // 'x'
+	0x0B,0xD2,0xA1,0x1D,0xB1,0x91,0xE1,0x41,0xDD,0x1D,0x91,0x91,0xE0,0xC1,0x91,0xE1,0x21,0x91,0xE0,0xE1,0xDF,0x1D,0x41,0x81,0xE1,0xA1,0xDD,0x1D,0x61,0x61,0xD7,0x1E,0x20,0x1D,0x81,0xDE,0x1D,0x01,0xE1,0x01,0xD1,0x18,0x1E,0x0A,0x18,0x1E,0x18,0x1E,0x10,0x19,0x1D,0x51,0x81,0xE3,0x41,0xD7,0x1E,0x16,0x1D,0x91,0xE3,0x91,0xDB,0x1E,0x37,0x1E,0x2B,0x1E,0x22,0x1E,0x06,0x19,0x1D,0xC1,0xE0,0x61,0xA1,0xD5,0x7E,0x12,0x1E,0x2B,0x1E,0x06,0x1E,0x05,0x2E,0x05,0x1E,0x04,0x3D,0xA0, // 'y'
+	0x1D,0xDE,0x8A,0x12,0xD1,0xA1,0xE0,0xF1,0x91,0xD3,0x19,0x1D,0x31,0xE0,0x81,0xD3,0x19,0x1D,0x31,0xE0,0x81,0xD3,0x19,0x1D,0x31,0x91,0xE0,0xF1,0x91,0xD3,0x19,0x1D,0x31,0xE0,0x81,0xD3,0x19,0x1D,0x31,0x91,0xE0,0xF1,0x91,0xD3,0x19,0x1D,0x31,0xAD,0x3E,0x8C, // 'z'
+	0xD2,0x6D,0x03,0xD4,0x2D,0x61,0xE0,0xD1,0xE1,0x92,0xD5,0x2D,0x61,0xEE,0x11,0xD7,0x1D,0x71,0xD3,0x5A,0x1D,0x71,0xD7,0x1D,0x53,0xE0,0xC3,0xD9,0x1D,0x91,0x74,0xB1,0xA2,0xD9,0x1E,0x0F,0x1E,0xDD,0x1D,0x92,0xD9,0x2E,0x02,0x1E,0x0F,0x1D,0x92,0xD9,0x37, // '{'
+	0x07,0xF0,0x1F,0x90, // '|'
+	0x06,0xD9,0x3D,0x92,0xD9,0x1E,0x0F,0x1E,0x02,0x2D,0x92,0xD9,0x1E,0xF3,0x1D,0x91,0xD9,0x1B,0x1A,0x57,0x1D,0x91,0xD9,0x3E,0x0C,0x3D,0x51,0xD7,0x1D,0x71,0xA5,0xD3,0x1D,0x71,0xD7,0x1E,0xE1,0x1D,0x62,0xD5,0x2E,0x2F,0x1D,0x71,0xD7,0x1D,0x44,0xC0, // '}'
+};
+const GFXglyph Open_Sans_Bold_64_RLEGlyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   1,   1,  18,    0,    0 }, // ' '
+	  {     1,  12,  47,  19,    4,  -46 }, // '!'
+	  {    23,  23,  17,  31,    4,  -46 }, // '"'
+	  {    32,  40,  46,  42,    1,  -46 }, // '#'
+	  {    86,  33,  52,  38,    3,  -49 }, // '$'
+	  {   184,  55,  47,  59,    2,  -46 }, // '%'
+	  {   352,  46,  47,  49,    3,  -46 }, // '&'
+	  {   493,  10,  17,  18,    4,  -46 }, // '''
+	  {   499,  18,  56,  23,    3,  -46 }, // '('
+	  {   550,  18,  56,  23,    2,  -46 }, // ')'
+	  {   602,  32,  30,  36,    2,  -49 }, // '*'
+	  {   662,  32,  31,  38,    3,  -38 }, // '+'
+	  {   673,  13,  16,  20,    2,   -7 }, // ','
+	  {   687,  18,   8,  22,    2,  -21 }, // '-'
+	  {   690,  12,  11,  19,    4,  -10 }, // '.'
+	  {   704,  27,  46,  27,    0,  -46 }, // '/'
+	  {   763,  34,  47,  38,    2,  -46 }, // '0'
+	  {   843,  24,  46,  38,    4,  -46 }, // '1'
+	  {   877,  34,  46,  38,    2,  -46 }, // '2'
+	  {   966,  34,  47,  38,    2,  -46 }, // '3'
+	  {  1051,  36,  46,  38,    1,  -46 }, // '4'
+	  {  1108,  32,  47,  38,    3,  -46 }, // '5'
+	  {  1165,  34,  47,  38,    2,  -46 }, // '6'
+	  {  1264,  34,  46,  38,    2,  -46 }, // '7'
+	  {  1325,  34,  47,  38,    2,  -46 }, // '8'
+	  {  1433,  34,  47,  38,    2,  -46 }, // '9'
+	  {  1532,  12,  37,  19,    4,  -36 }, // ':'
+	  {  1561,  14,  45,  20,    2,  -36 }, // ';'
+	  {  1590,  32,  34,  38,    3,  -40 }, // '<'
+	  {  1667,  32,  19,  38,    3,  -32 }, // '='
+	  {  1677,  32,  34,  38,    3,  -40 }, // '>'
+	  {  1752,  30,  47,  32,    0,  -46 }, // '?'
+	  {  1824,  52,  51,  58,    3,  -46 }, // '@'
+	  {  1997,  45,  46,  45,    0,  -46 }, // 'A'
+	  {  2078,  35,  46,  44,    6,  -46 }, // 'B'
+	  {  2151,  36,  47,  42,    4,  -46 }, // 'C'
+	  {  2227,  38,  46,  48,    6,  -46 }, // 'D'
+	  {  2296,  27,  46,  37,    6,  -46 }, // 'E'
+	  {  2310,  27,  46,  36,    6,  -46 }, // 'F'
+	  {  2323,  38,  47,  47,    4,  -46 }, // 'G'
+	  {  2403,  38,  46,  50,    6,  -46 }, // 'H'
+	  {  2415,  10,  46,  22,    6,  -46 }, // 'I'
+	  {  2419,  21,  59,  22,   -5,  -46 }, // 'J'
+	  {  2440,  38,  46,  44,    6,  -46 }, // 'K'
+	  {  2534,  29,  46,  37,    6,  -46 }, // 'L'
+	  {  2540,  49,  46,  61,    6,  -46 }, // 'M'
+	  {  2624,  41,  46,  53,    6,  -46 }, // 'N'
+	  {  2702,  44,  47,  52,    4,  -46 }, // 'O'
+	  {  2807,  32,  46,  41,    6,  -46 }, // 'P'
+	  {  2852,  44,  57,  52,    4,  -46 }, // 'Q'
+	  {  2983,  37,  46,  43,    6,  -46 }, // 'R'
+	  {  3061,  30,  47,  36,    3,  -46 }, // 'S'
+	  {  3149,  36,  46,  38,    1,  -46 }, // 'T'
+	  {  3158,  39,  47,  49,    5,  -46 }, // 'U'
+	  {  3200,  43,  46,  43,    0,  -46 }, // 'V'
+	  {  3289,  63,  46,  63,    0,  -46 }, // 'W'
+	  {  3406,  44,  46,  44,    0,  -46 }, // 'X'
+	  {  3543,  41,  46,  41,    0,  -46 }, // 'Y'
+	  {  3613,  34,  46,  38,    2,  -46 }, // 'Z'
+	  {  3684,  16,  56,  22,    4,  -46 }, // '['
+	  {  3692,  27,  46,  27,    0,  -46 }, // 0x5C
+	  {  3755,  16,  56,  22,    2,  -46 }, // ']'
+	  {  3763,  35,  30,  35,    0,  -46 }, // '^'
+	  {  3831,  27,   4,  27,    0,    6 }, // '_'
+	  {  3834,  19,  10,  40,   10,  -49 }, // '`'
+	  {  3852,  32,  37,  40,    3,  -36 }, // 'a'
+	  {  3923,  34,  50,  42,    5,  -49 }, // 'b'
+	  {  3988,  29,  37,  34,    3,  -36 }, // 'c'
+	  {  4043,  34,  50,  42,    3,  -49 }, // 'd'
+	  {  4112,  33,  37,  39,    3,  -36 }, // 'e'
+	  {  4179,  28,  49,  26,    1,  -49 }, // 'f'
+	  {  4209,  36,  51,  37,    0,  -36 }, // 'g'
+	  {  4321,  33,  49,  43,    5,  -49 }, // 'h'
+	  {  4356,  11,  49,  21,    5,  -49 }, // 'i'
+	  {  4372,  20,  64,  21,   -4,  -49 }, // 'j'
+	  {  4402,  36,  49,  41,    5,  -49 }, // 'k'
+	  {  4484,  11,  49,  21,    5,  -49 }, // 'l'
+	  {  4488,  54,  36,  64,    5,  -36 }, // 'm'
+	  {  4540,  33,  36,  43,    5,  -36 }, // 'n'
+	  {  4572,  35,  37,  41,    3,  -36 }, // 'o'
+	  {  4640,  34,  51,  42,    5,  -36 }, // 'p'
+	  {  4705,  34,  51,  42,    3,  -36 }, // 'q'
+	  {  4772,  24,  36,  30,    5,  -36 }, // 'r'
+	  {  4794,  28,  37,  33,    3,  -36 }, // 's'
+	  {  4863,  25,  43,  29,    2,  -42 }, // 't'
+	  {  4892,  33,  36,  43,    5,  -35 }, // 'u'
+	  {  4925,  37,  35,  37,    0,  -35 }, // 'v'
+	  {  4990,  54,  35,  56,    1,  -35 }, // 'w'
+	  {  5079,  38,  35,  38,    0,  -35 }, // 'x'
+	  {  5177,  37,  50,  37,    0,  -35 }, // 'y'
+	  {  5269,  28,  35,  32,    2,  -35 }, // 'z'
+	  {  5319,  22,  56,  26,    1,  -46 }, // '{'
+	  {  5368,   8,  64,  36,   14,  -49 }, // '|'
+	  {  5372,  22,  56,  26,    3,  -46 }  // '}'
+};
+const GFXfont Open_Sans_Bold_64_RLE PROGMEM = {
+(uint8_t  *)Open_Sans_Bold_64_RLEBitmaps,(GFXglyph *)Open_Sans_Bold_64_RLEGlyphs,0x20, 0x7D, 88};
@@ -23,7 +23,8 @@
 
 #include <Thermal_Printer.h>
 #include "FreeSerif12pt7b.h"
-#include "OpenSansBold64.h"
+// The 64pt font was compressed with tools/fontcomp (15.8K -> 5.4K of flash)
+#include "OpenSansBold64_rle.h"
  
 void setup() {
   int iWidth;
@@ -51,7 +52,8 @@ void setup() {
       // into your graphics buffer instead of sending directly to the printer
       tpPrintCustomText((GFXfont *)&FreeSerif12pt7b, 0, (char *)"You too can print nice looking fonts");
       tpPrintCustomText((GFXfont *)&FreeSerif12pt7b, 0, (char *)"with Adafruit_GFX bitmap format.");
-      tpPrintCustomText((GFXfont *)&Open_Sans_Bold_64, 0, (char *)"Huge fonts!");
+      tpSetFontFormat((GFXfont *)&Open_Sans_Bold_64_RLE, FONT_FORMAT_RLE);
+      tpPrintCustomText((GFXfont *)&Open_Sans_Bold_64_RLE, 0, (char *)"Huge fonts!");
       tpFeed(48); // feed the paper out a little from the print head to see what was printed
       Serial.println((char *)"Disconnecting");
       tpDisconnect();
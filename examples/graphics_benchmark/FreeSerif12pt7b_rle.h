@@ -0,0 +1,198 @@
+// FreeSerif12pt7b converted by fontcomp to FONT_FORMAT_RLE (1699 bytes of glyph data instead of 1839)
+// Call tpSetFontFormat((GFXfont *)&FreeSerif12pt7b_RLE, FONT_FORMAT_RLE) before using it
+const uint8_t FreeSerif12pt7b_RLEBitmaps[] PROGMEM = {
+	0x02,0xD0,0x16,0x13,0x24, // '!'
+	0x02,0x22,0xD6,0x13,0x16, // '"'
+	0x42,0x31,0xD6,0x1D,0x11,0xD3,0x31,0x32,0x21,0x22,0x31,0x3D,0x31,0xD6,0x31,0x41,0x21,0x31,0x32,0x23,0x15,0x1E,0x01,0x18, // '#'
+	0x51,0x72,0x12,0x34,0x11,0x11,0x11,0x11,0x41,0xD7,0x13,0x26,0x13,0x16,0x23,0x16,0x22,0x27,0x1A,0x11,0x2D,0x71,0xA1,0x41,0x13,0x12,0x11,0x11,0x33,0x12,0x20, // '$'
+	0xD0,0x18,0x35,0x17,0x21,0x71,0x15,0x12,0x12,0x11,0x39,0x17,0x25,0x1D,0x61,0x42,0x12,0xC1,0x22,0xC1,0x11,0x54,0x11,0x15,0x12,0x21,0x14,0x14,0x61,0x11,0xB2,0x11,0xD0,0x15,0x1C,0x18,0x25,0x2D,0xD2,0x52,0x41,0x14,0x20, // '%'
+	0x64,0xC4,0x11,0xA1,0x41,0xE0,0x42,0xC4,0x15,0x51,0x31,0x21,0x31,0x51,0x71,0x11,0x44,0x61,0x51,0x11,0x41,0x41,0x51,0x31,0x21,0x12,0x41,0xDA,0x12,0x27,0x15,0x12,0x18,0x14,0x13,0x13,0x32,0x72,0x40, // '&'
+	0x02,0x71,0x20, // '''
+	0x51,0x42,0x32,0x32,0x31,0x61,0x31,0xE0,0xC1,0xD0,0x14,0x16,0x25,0x25,0x20, // '('
+	0x01,0x52,0x52,0x52,0x61,0x41,0xD0,0x1E,0x0C,0x13,0x16,0x13,0x23,0x23,0x24, // ')'
+	0x22,0x41,0x52,0x12,0x21,0x21,0x52,0x12,0x12,0x31,0x31,0x21,0x11,0x17,0x32,0xA1,0x50, // '*'
+	0x51,0xE1,0x45,0x1A,0x15,0xE0,0xF0, // '+'
+	0x02,0x31,0x32,0x24,0x10, // ','
+	0x06, // '-'
+	0x02,0x40, // '.'
+	0x52,0xD0,0x14,0x1D,0x11,0x41,0xD1,0x14,0x1D,0x11,0x41,0xD1,0x14,0x1D,0x00, // '/'
+	0x34,0x51,0x12,0x11,0x31,0x11,0x21,0x11,0xB1,0x11,0x41,0xB1,0xE2,0x91,0x11,0x41,0x11,0xB1,0x11,0x21,0x11,0x31,0x12,0x11,0x20, // '0'
+	0x31,0x32,0x41,0xE3,0x52,0x22, // '1'
+	0x34,0x45,0x11,0x41,0x31,0x11,0x12,0x81,0xDE,0x17,0x1A,0x17,0x27,0x18,0x11,0x16,0x11,0x16,0x11,0x15,0x22,0x70, // '2'
+	0x34,0x45,0x12,0x13,0x31,0x31,0xD4,0x17,0x26,0x21,0x15,0x14,0x14,0x33,0x16,0x1A,0x1E,0x00,0x11,0x45,0x11,0x12,0x52, // '3'
+	0x71,0x81,0x81,0x82,0xD4,0x27,0x2D,0x42,0x72,0xD6,0x52,0x82,0x2E,0x01, // '4'
+	0xD1,0x63,0x7D,0x11,0x71,0x22,0x52,0x32,0x52,0xA1,0x21,0x71,0xE0,0xC1,0x71,0x23,0x31,0x11,0x11,0x25,0x20, // '5'
+	0x73,0x43,0x12,0x31,0x22,0x41,0x12,0x51,0xB1,0x61,0x34,0x53,0x21,0x32,0x21,0x21,0x71,0xE0,0x31,0x11,0xD3,0x11,0x11,0x13,0x14,0x11,0x51, // '6'
+	0x28,0x17,0x22,0x72,0x61,0xD7,0x1D,0x41,0xA1,0xDE,0x2D,0xE2,0xD1, // '7'
+	0x35,0x36,0x11,0x11,0x11,0x41,0x11,0xD9,0x14,0x11,0x22,0x12,0x11,0x12,0x12,0x44,0x13,0x15,0x32,0x22,0x13,0x14,0x11,0x13,0x12,0x17,0x1D,0x91,0x11,0x41,0x11,0x16,0x11,0x10, // '8'
+	0x34,0x54,0x11,0x31,0x41,0x11,0x11,0x11,0x41,0xB1,0xE0,0x31,0x71,0x21,0x31,0x31,0x24,0x46,0x11,0xD3,0x11,0x16,0x18,0x12,0x14,0x21,0x24,0x11,0x25, // '9'
+	0x02,0x42,0xA2,0x40, // ':'
+	0x02,0xA2,0xDA,0x24,0x15,0x23,0x21,0x21, // ';'
+	0xD8,0x37,0x22,0x15,0x22,0x24,0x22,0x24,0x21,0x35,0x11,0x2A,0x28,0x22,0x28,0x22,0x28,0x22,0x28,0x31,0x29,0x21, // '<'
+	0x0D,0xBE,0x07,0xC0, // '='
+	0x01,0xC2,0x92,0x13,0x82,0x22,0x82,0x22,0x82,0x22,0x82,0xA2,0x11,0x53,0x12,0x42,0x22,0x42,0x22,0x51,0x22,0x73,0x90, // '>'
+	0x15,0x25,0x11,0x61,0x11,0x11,0x62,0xD6,0x11,0x14,0x11,0x16,0x1D,0x02,0xD1,0x1D,0x12,0xD7, // '?'
+	0x66,0x9A,0x61,0x11,0x63,0x41,0x11,0x92,0x21,0x11,0x43,0x12,0xA1,0x13,0x11,0x13,0x11,0x31,0x11,0xD2,0x1D,0x11,0xDA,0x1D,0x11,0x43,0x11,0xB2,0x61,0x14,0x13,0x31,0x11,0x24,0x13,0x54,0x71,0x7A,0x30, // '@'
+	0x81,0xD4,0x1D,0x11,0xE0,0x32,0x21,0xD1,0x1D,0x01,0x51,0xB1,0x21,0xD6,0x18,0x24,0x1B,0x62,0x16,0x11,0x6A,0x16,0x12,0x14,0x1E,0x00,0x11,0x22,0x16,0x14,0x10, // 'A'
+	0x09,0x32,0x24,0x11,0xA1,0x11,0xE1,0x01,0x11,0x56,0x67,0x91,0xC1,0x11,0xE0,0x41,0xA1,0x23,0x24,0x21,0x10, // 'B'
+	0x56,0x31,0x32,0x18,0x31,0x12,0x51,0x41,0x11,0x81,0xD2,0x11,0x11,0x1B,0x1E,0x2E,0x11,0x1D,0xF1,0x11,0xA1,0x21,0x12,0x63,0x32,0x18,0x10, // 'C'
+	0x0A,0x62,0x25,0x13,0xC2,0x21,0xD0,0x12,0x1D,0x01,0xD3,0x11,0x1E,0x40,0x11,0x1D,0xF1,0x11,0xA3,0x11,0x22,0x25,0x13,0x30, // 'D'
+	0x0D,0x32,0x8D,0x11,0xD1,0x1D,0xC1,0xC1,0x76,0x86,0xD1,0x1D,0x11,0xDF,0x1D,0xC2,0x22,0x26,0x40, // 'E'
+	0x0D,0x32,0x8D,0x11,0xD1,0x1D,0xC1,0xC1,0x76,0x86,0xD1,0x1D,0x11,0xE1,0xD2,0x22,0x80, // 'F'
+	0x56,0x21,0x52,0x14,0x12,0x51,0x12,0x42,0x51,0x11,0xDB,0x13,0x11,0x1A,0x1D,0xF6,0xA2,0x22,0xE0,0x31,0x11,0xE0,0x11,0x11,0xD1,0x11,0x25,0x17,0x21,0x82, // 'G'
+	0x06,0x48,0x22,0x42,0x22,0xE3,0x78,0x88,0xE4,0x72,0x22,0x42,0x22, // 'H'
+	0x08,0x22,0xE3,0x12,0x22, // 'I'
+	0x26,0x22,0x22,0xE4,0x32,0x31,0x43,0x30, // 'J'
+	0x06,0x27,0x12,0x22,0x22,0x32,0xC2,0xC2,0xD0,0x2C,0x3C,0x11,0x1C,0x1D,0x21,0x21,0xD0,0x12,0x1D,0x01,0x21,0xD0,0x12,0x1D,0x01,0x21,0xD0,0x12,0x1D,0x31,0x22,0x22,0x31,0x42, // 'K'
+	0x06,0x92,0x22,0xE9,0x01,0xD0,0x2B,0x22,0x22,0x74, // 'L'
+	0x05,0xA6,0xC1,0x22,0xDB,0x17,0x18,0x1A,0x1A,0x15,0x1A,0x18,0x1C,0x1D,0x92,0xB1,0x21,0xD7,0x1D,0x11,0x41,0xD3,0x1D,0x31,0x21,0x91,0x11,0xD2,0x13,0x14,0x13,0x22,0x20, // 'M'
+	0x04,0x76,0x31,0x61,0x31,0x11,0x31,0x61,0x11,0x71,0xC1,0xD3,0x12,0x1D,0x01,0x21,0xD3,0x1C,0x13,0x1C,0x1D,0x31,0x21,0xD0,0x12,0x1D,0x01,0xD3,0x15,0x11,0x1C,0x13,0x17,0x13, // 'N'
+	0x55,0x89,0x51,0x11,0x51,0x11,0x31,0x11,0x71,0x11,0xD3,0x11,0x19,0x11,0x1E,0x2E,0x11,0x19,0x11,0x1D,0x31,0x11,0x71,0x11,0x31,0x11,0x51,0x11,0x59,0x30, // 'O'
+	0x09,0x32,0x24,0x12,0x91,0x21,0x91,0xE0,0x61,0x11,0x81,0x74,0x12,0x55,0xE2,0x22,0x22,0x60, // 'P'
+	0x47,0x81,0x15,0x11,0x61,0x11,0x51,0x11,0x41,0x11,0x71,0x11,0xD5,0x11,0x19,0x11,0x1E,0x34,0x11,0x19,0x11,0x1D,0x51,0x11,0x71,0x11,0x41,0x11,0x51,0x11,0x69,0x91,0xD3,0x13,0x1C,0x22,0x2C,0x22,0x30, // 'Q'
+	0x09,0x62,0x24,0x12,0xC1,0x21,0xC1,0xE0,0xF1,0xD0,0x12,0x17,0x41,0x28,0x2D,0x21,0x21,0xD2,0x1B,0x13,0x1B,0x1D,0x21,0x21,0x22,0x22,0x41,0x22, // 'R'
+	0x35,0x11,0x31,0x15,0x31,0x11,0x41,0xD3,0x15,0x24,0x15,0x11,0x13,0x17,0x13,0x26,0x23,0x26,0x2B,0x12,0x27,0x12,0x2D,0x92,0x41,0x11,0x26,0x11,0x10, // 'S'
+	0x0D,0x22,0x42,0x53,0x1D,0xD1,0x11,0xD0,0x1E,0x7D,0x22,0x25, // 'T'
+	0x06,0x57,0x22,0x51,0x31,0xC1,0x11,0xE8,0x61,0x11,0x72,0x71,0x51,0x72,0x17,0x30, // 'U'
+	0x07,0x57,0x32,0x51,0x22,0xD6,0x1B,0x17,0x1D,0x11,0x82,0x91,0xD1,0x16,0x1C,0x14,0x19,0x14,0x1D,0x11,0x21,0xB1,0xD6,0x1D,0x11,0x21,0xE0,0x31,0x70, // 'V'
+	0x06,0x26,0x45,0x41,0x21,0x32,0x41,0x21,0x11,0x71,0xD1,0x19,0x17,0x16,0x14,0x1D,0xB1,0x42,0x51,0x61,0xD4,0x14,0x1D,0x11,0x41,0x41,0x22,0xA1,0x21,0x11,0xDB,0x39,0x12,0x2D,0xC1,0xDB,0x1B,0x11,0x15,0x1E,0x00, // 'W'
+	0x17,0x36,0x11,0x42,0x32,0x22,0x21,0x91,0x11,0x51,0x21,0x41,0x11,0x71,0x21,0x41,0x91,0x42,0xD0,0x3C,0x1D,0x71,0xC1,0x11,0xD0,0x11,0x13,0x1B,0x12,0x12,0x18,0x24,0x12,0x16,0x2D,0x11,0xB1,0x22,0x22,0x41,0x42, // 'X'
+	0x07,0x46,0x42,0x41,0x22,0x11,0xB1,0x41,0x21,0x51,0x71,0x21,0x51,0x71,0x52,0xB1,0x11,0xB1,0x21,0x11,0xB1,0x21,0xE4,0xE2,0x22,0x50, // 'Y'
+	0x1C,0x11,0x18,0x21,0x21,0x71,0xC1,0x21,0x21,0x61,0x21,0xDA,0x12,0x19,0x12,0x1D,0xA1,0x21,0x91,0x21,0x91,0x21,0xD8,0x11,0x12,0x17,0x11,0x12,0x17,0x11,0x13,0x83, // 'Z'
+	0x05,0x23,0xE3,0xA3, // '['
+	0x02,0xC1,0x81,0xC1,0x81,0xC1,0x81,0xC1,0x81,0xC1,0x81,0x70, // 0x5C
+	0x08,0xE3,0xA3,0x20, // ']'
+	0x42,0x71,0xA1,0x11,0x51,0xA1,0x11,0x11,0x31,0xA1,0x31,0x11,0x11,0xA1,0x51,0x11, // '^'
+	0x0C, // '_'
+	0x02,0x51,0x22,0x11,0x31,0x11, // '`'
+	0x25,0x35,0xA1,0x11,0x22,0xD8,0x35,0x54,0x11,0x1D,0x91,0x41,0x14,0x21,0x10, // 'a'
+	0x21,0x72,0x81,0xE0,0xE4,0x54,0x11,0x41,0x51,0x71,0xE0,0xC1,0x71,0xA1,0x21,0x15,0x20, // 'b'
+	0x34,0x34,0x11,0x11,0x61,0x11,0x32,0xE0,0x51,0x42,0x21,0x22,0x11,0x23,0x10, // 'c'
+	0x81,0x72,0x81,0xE0,0x73,0x65,0x41,0x41,0x31,0x11,0xE1,0x41,0x71,0x21,0x21,0x41,0x23,0x21, // 'd'
+	0x34,0x54,0x12,0x22,0x31,0x31,0x15,0x57,0xDA,0x16,0x27,0x23,0x13,0x22,0x21,0x42, // 'e'
+	0x44,0x44,0x11,0x72,0x21,0xDC,0x12,0x24,0x12,0x2E,0x2E,0x22,0x23, // 'f'
+	0x35,0x61,0x13,0x14,0x11,0x11,0x31,0x22,0xDC,0x11,0x13,0x11,0x14,0x11,0x31,0x15,0x65,0x2B,0x84,0x9D,0x01,0xD7,0x23,0x15,0x22,0x21,0x63, // 'g'
+	0x22,0x72,0x92,0xE1,0x24,0x63,0x21,0x51,0x21,0xE3,0x41,0x21,0x21,0x21, // 'h'
+	0x22,0x82,0xD1,0x12,0x23,0x1E,0x09,0x22,0x10, // 'i'
+	0x42,0xA2,0xD3,0x23,0x15,0x1E,0x27,0x23,0x12,0x31, // 'j'
+	0x21,0x82,0x91,0xE1,0x45,0x61,0x13,0x62,0x82,0x73,0xA1,0x81,0x21,0x81,0x21,0x81,0xB1,0x12,0x11,0x21,0x21,0x31, // 'k'
+	0x31,0x22,0x31,0xE2,0x72,0x21, // 'l'
+	0x04,0x14,0x34,0x22,0x24,0x15,0x21,0x51,0x52,0x21,0xE6,0x51,0x21,0x21,0x21,0x31,0x21, // 'm'
+	0x04,0x14,0x22,0x24,0x11,0x51,0xE3,0x71,0x21,0x21,0x21, // 'n'
+	0x34,0x45,0x12,0x31,0x31,0x31,0x61,0x11,0xE0,0xB1,0x11,0x61,0x31,0x32,0x22,0x14,0x20, // 'o'
+	0x13,0x14,0x31,0x24,0x11,0x51,0x51,0x81,0xE1,0x91,0x11,0x41,0x41,0x55,0x73,0xE0,0x72,0x22,0x50, // 'p'
+	0x34,0x11,0x31,0x12,0x11,0x31,0x11,0x21,0x31,0x11,0xE1,0x41,0x71,0x51,0x41,0x14,0x54,0xE0,0xA2,0x21, // 'q'
+	0x22,0x13,0x11,0x22,0x31,0x21,0x12,0xE1,0xC1,0x22,0x20, // 'r'
+	0x14,0x17,0xD0,0x12,0x23,0x22,0x23,0x22,0x32,0x2A,0x14,0x11,0x51, // 's'
+	0x21,0x41,0x41,0x22,0x11,0x22,0xE1,0x31,0x11,0x13, // 't'
+	0x03,0x33,0x11,0x51,0xE2,0xF1,0x21,0x41,0x23,0x21, // 'u'
+	0x05,0x34,0x31,0x31,0x11,0x11,0xD4,0x23,0x11,0x1D,0x02,0x51,0x11,0xD7,0x11,0x2D,0x71,0x40, // 'v'
+	0x04,0x25,0x24,0x21,0x21,0x22,0x21,0x51,0x31,0x11,0x51,0x11,0xDE,0x23,0x11,0x12,0x21,0x1D,0x42,0x51,0x13,0x11,0x11,0xDD,0x15,0x17,0x15,0x15, // 'w'
+	0x05,0x14,0x12,0x21,0x11,0x21,0x31,0x11,0x31,0x73,0x61,0x21,0x81,0x11,0x81,0x21,0x63,0x72,0x21,0x11,0x31,0x71,0x11,0x21,0x21,0x31, // 'x'
+	0x05,0x34,0x31,0x31,0x11,0x11,0xD4,0x23,0x11,0x1D,0x71,0x11,0x12,0xD4,0x11,0x2D,0x61,0xA2,0xD6,0x26,0x3B,0x16, // 'y'
+	0x18,0x34,0x51,0x61,0x61,0x11,0x61,0xB1,0x61,0x81,0x21,0x81,0x41,0x11,0x61,0x11,0x34,0x11, // 'z'
+	0x32,0x21,0x11,0xE0,0xB4,0x14,0xE0,0xE1,0x11, // '{'
+	0x01,0xD3, // '|'
+	0x02,0x31,0x11,0xE0,0xE4,0x14,0xE0,0xB1,0x11,0x20, // '}'
+	0x23,0x81,0x14,0x31,0x31,0x26,0x10, // '~'
+};
+const GFXglyph FreeSerif12pt7b_RLEGlyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   0,   0,   6,    0,    1 }, // ' '
+	  {     0,   2,  16,   8,    3,  -15 }, // '!'
+	  {     5,   6,   6,  10,    1,  -15 }, // '"'
+	  {    10,  12,  16,  12,    0,  -15 }, // '#'
+	  {    34,  10,  18,  12,    1,  -16 }, // '$'
+	  {    65,  18,  17,  20,    1,  -16 }, // '%'
+	  {   108,  17,  16,  19,    1,  -15 }, // '&'
+	  {   147,   2,   6,   5,    1,  -15 }, // '''
+	  {   150,   6,  20,   8,    1,  -15 }, // '('
+	  {   165,   6,  20,   8,    1,  -15 }, // ')'
+	  {   180,   8,  10,  12,    3,  -14 }, // '*'
+	  {   197,  11,  11,  14,    1,  -10 }, // '+'
+	  {   204,   3,   6,   6,    2,   -2 }, // ','
+	  {   209,   6,   1,   8,    1,   -5 }, // '-'
+	  {   210,   2,   3,   6,    2,   -2 }, // '.'
+	  {   212,   7,  17,   7,    0,  -16 }, // '/'
+	  {   227,  10,  17,  12,    1,  -16 }, // '0'
+	  {   252,   6,  17,  12,    3,  -16 }, // '1'
+	  {   258,  10,  15,  12,    1,  -14 }, // '2'
+	  {   280,  10,  16,  12,    1,  -15 }, // '3'
+	  {   303,  10,  16,  12,    1,  -15 }, // '4'
+	  {   317,  10,  17,  12,    1,  -16 }, // '5'
+	  {   338,  10,  17,  12,    1,  -16 }, // '6'
+	  {   365,  10,  16,  12,    0,  -15 }, // '7'
+	  {   378,  10,  17,  12,    1,  -16 }, // '8'
+	  {   412,  10,  18,  12,    1,  -16 }, // '9'
+	  {   441,   2,  12,   6,    2,  -11 }, // ':'
+	  {   445,   4,  15,   6,    2,  -11 }, // ';'
+	  {   453,  12,  13,  14,    1,  -12 }, // '<'
+	  {   475,  12,   6,  14,    1,   -8 }, // '='
+	  {   479,  12,  13,  14,    1,  -11 }, // '>'
+	  {   502,   8,  17,  11,    2,  -16 }, // '?'
+	  {   520,  17,  16,  21,    2,  -15 }, // '@'
+	  {   559,  17,  16,  17,    0,  -15 }, // 'A'
+	  {   590,  12,  16,  15,    1,  -15 }, // 'B'
+	  {   611,  15,  16,  16,    1,  -15 }, // 'C'
+	  {   638,  16,  16,  17,    0,  -15 }, // 'D'
+	  {   662,  14,  16,  15,    0,  -15 }, // 'E'
+	  {   681,  14,  16,  14,    0,  -15 }, // 'F'
+	  {   698,  16,  16,  17,    1,  -15 }, // 'G'
+	  {   728,  16,  16,  17,    0,  -15 }, // 'H'
+	  {   741,   6,  16,   8,    1,  -15 }, // 'I'
+	  {   746,   8,  16,   9,    0,  -15 }, // 'J'
+	  {   754,  16,  16,  17,    1,  -15 }, // 'K'
+	  {   788,  15,  16,  15,    0,  -15 }, // 'L'
+	  {   798,  19,  16,  21,    1,  -15 }, // 'M'
+	  {   831,  16,  16,  17,    1,  -15 }, // 'N'
+	  {   865,  15,  16,  17,    1,  -15 }, // 'O'
+	  {   895,  12,  16,  14,    0,  -15 }, // 'P'
+	  {   913,  16,  20,  17,    1,  -15 }, // 'Q'
+	  {   952,  15,  16,  16,    0,  -15 }, // 'R'
+	  {   980,  11,  16,  13,    0,  -15 }, // 'S'
+	  {  1009,  15,  16,  15,    0,  -15 }, // 'T'
+	  {  1021,  16,  16,  17,    1,  -15 }, // 'U'
+	  {  1037,  17,  16,  17,    0,  -15 }, // 'V'
+	  {  1066,  22,  16,  23,    0,  -15 }, // 'W'
+	  {  1107,  17,  16,  17,    0,  -15 }, // 'X'
+	  {  1148,  16,  16,  17,    0,  -15 }, // 'Y'
+	  {  1174,  14,  16,  15,    1,  -15 }, // 'Z'
+	  {  1206,   5,  20,   8,    2,  -15 }, // '['
+	  {  1210,   7,  17,   7,    0,  -16 }, // 0x5C
+	  {  1222,   5,  20,   8,    1,  -15 }, // ']'
+	  {  1226,  10,   9,  11,    1,  -15 }, // '^'
+	  {  1242,  12,   1,  12,    0,    3 }, // '_'
+	  {  1243,   5,   4,   6,    0,  -15 }, // '`'
+	  {  1249,  10,  11,  10,    1,  -10 }, // 'a'
+	  {  1264,  10,  17,  12,    1,  -16 }, // 'b'
+	  {  1281,   8,  11,  11,    1,  -10 }, // 'c'
+	  {  1296,  10,  17,  12,    1,  -16 }, // 'd'
+	  {  1314,  10,  11,  11,    1,  -10 }, // 'e'
+	  {  1330,   9,  17,   9,    0,  -16 }, // 'f'
+	  {  1343,  12,  16,  11,    0,  -10 }, // 'g'
+	  {  1370,  11,  17,  12,    0,  -16 }, // 'h'
+	  {  1384,   5,  16,   7,    0,  -15 }, // 'i'
+	  {  1393,   6,  21,   8,    0,  -15 }, // 'j'
+	  {  1403,  11,  17,  12,    1,  -16 }, // 'k'
+	  {  1425,   5,  17,   6,    0,  -16 }, // 'l'
+	  {  1431,  18,  11,  19,    0,  -10 }, // 'm'
+	  {  1448,  11,  11,  12,    0,  -10 }, // 'n'
+	  {  1459,  10,  11,  12,    1,  -10 }, // 'o'
+	  {  1476,  11,  16,  12,    0,  -10 }, // 'p'
+	  {  1495,  10,  16,  12,    1,  -10 }, // 'q'
+	  {  1515,   8,  11,   8,    0,  -10 }, // 'r'
+	  {  1526,   7,  11,   9,    1,  -10 }, // 's'
+	  {  1539,   6,  13,   7,    1,  -12 }, // 't'
+	  {  1549,  10,  11,  12,    1,  -10 }, // 'u'
+	  {  1559,  11,  11,  11,    0,  -10 }, // 'v'
+	  {  1577,  16,  11,  16,    0,  -10 }, // 'w'
+	  {  1605,  11,  11,  12,    0,  -10 }, // 'x'
+	  {  1631,  11,  16,  11,    0,  -10 }, // 'y'
+	  {  1653,  10,  11,  10,    0,  -10 }, // 'z'
+	  {  1671,   5,  21,  12,    2,  -16 }, // '{'
+	  {  1680,   1,  17,   5,    2,  -16 }, // '|'
+	  {  1682,   5,  21,  12,    5,  -15 }, // '}'
+	  {  1692,  12,   3,  12,    0,   -6 }  // '~'
+};
+const GFXfont FreeSerif12pt7b_RLE PROGMEM = {
+(uint8_t  *)FreeSerif12pt7b_RLEBitmaps,(GFXglyph *)FreeSerif12pt7b_RLEGlyphs,0x20, 0x7E, 29};
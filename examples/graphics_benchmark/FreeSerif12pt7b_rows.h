@@ -0,0 +1,198 @@
+// FreeSerif12pt7b converted by fontcomp to FONT_FORMAT_ROWS (2428 bytes of glyph data instead of 1839)
+// Call tpSetFontFormat((GFXfont *)&FreeSerif12pt7b_ROWS, FONT_FORMAT_ROWS) before using it
+const uint8_t FreeSerif12pt7b_ROWSBitmaps[] PROGMEM = {
+	0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x80,0x80,0x00,0x00,0xC0,0xC0,0xC0, // '!'
+	0xCC,0xCC,0xCC,0xCC,0x88,0x88, // '"'
+	0x0C,0x40,0x0C,0x40,0x08,0x40,0x08,0xC0,0x08,0xC0,0x7F,0xF0,0x18,0x80,0x18,0x80,0x10,0x80,0x10,0x80,0xFF,0xE0,0x11,0x80,0x31,0x00,0x31,0x00,0x31,0x00,0x21,0x00, // '#'
+	0x04,0x00,0x1F,0x00,0x65,0x80,0xC4,0x80,0xC4,0x80,0xC4,0x00,0xF4,0x00,0x7C,0x00,0x1E,0x00,0x07,0x80,0x05,0x80,0x04,0xC0,0x84,0xC0,0x84,0xC0,0xC4,0xC0,0xE5,0x80,0x3F,0x00,0x04,0x00, // '$'
+	0x00,0x04,0x00,0x0E,0x0C,0x00,0x39,0xF8,0x00,0x70,0x88,0x00,0x60,0x90,0x00,0xE0,0x90,0x00,0xC1,0x20,0x00,0xC3,0x40,0x00,0xC6,0x47,0x80,0x78,0x8C,0x40,0x00,0x98,0x40,0x01,0x38,0x40,0x03,0x30,0x40,0x02,0x30,0x80,0x04,0x30,0x80,0x04,0x31,0x00,0x08,0x1E,0x00, // '%'
+	0x03,0xC0,0x00,0x04,0x60,0x00,0x0C,0x20,0x00,0x0C,0x20,0x00,0x0C,0x40,0x00,0x0F,0x9F,0x00,0x07,0x0E,0x00,0x0F,0x04,0x00,0x33,0x0C,0x00,0x63,0x88,0x00,0x41,0xD0,0x00,0xC1,0xD0,0x00,0xC0,0xE0,0x00,0xE0,0x70,0x00,0xF0,0xF8,0x80,0x3F,0x1F,0x00, // '&'
+	0xC0,0xC0,0xC0,0xC0,0x80,0x80, // '''
+	0x04,0x08,0x10,0x20,0x60,0x40,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x40,0x40,0x60,0x20,0x10,0x08,0x04, // '('
+	0x80,0x40,0x20,0x10,0x18,0x08,0x08,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x08,0x18,0x10,0x20,0x40,0x80, // ')'
+	0x30,0xB3,0xD7,0x54,0x38,0x7C,0xD3,0x30,0x30,0x10, // '*'
+	0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0xFF,0xE0,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00, // '+'
+	0xC0,0xE0,0xE0,0x20,0x40,0x80, // ','
+	0xFC, // '-'
+	0xC0,0xC0,0xC0, // '.'
+	0x06,0x06,0x04,0x0C,0x0C,0x08,0x18,0x18,0x10,0x30,0x30,0x20,0x60,0x60,0x40,0xC0,0xC0, // '/'
+	0x1E,0x00,0x33,0x00,0x61,0x80,0x61,0x80,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x61,0x80,0x61,0x80,0x33,0x00,0x1E,0x00, // '0'
+	0x10,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xFC, // '1'
+	0x1E,0x00,0x63,0x00,0x41,0x80,0x81,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x04,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x40,0xFF,0x80, // '2'
+	0x1E,0x00,0x63,0x80,0x81,0x80,0x01,0x80,0x01,0x00,0x02,0x00,0x0F,0x00,0x1F,0x80,0x03,0xC0,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x01,0x80,0xE1,0x00,0x7E,0x00, // '3'
+	0x01,0x00,0x03,0x00,0x07,0x00,0x0B,0x00,0x0B,0x00,0x13,0x00,0x23,0x00,0x23,0x00,0x43,0x00,0x83,0x00,0x83,0x00,0xFF,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00, // '4'
+	0x00,0x00,0x0F,0xC0,0x10,0x00,0x10,0x00,0x18,0x00,0x3E,0x00,0x0F,0x80,0x03,0x80,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0xE3,0x00,0x7C,0x00, // '5'
+	0x01,0xC0,0x0F,0x00,0x1C,0x00,0x30,0x00,0x70,0x00,0x60,0x00,0xEF,0x00,0xF3,0x80,0xC1,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x60,0xC0,0x60,0x80,0x31,0x80,0x1E,0x00, // '6'
+	0x3F,0xC0,0x40,0xC0,0x80,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x08,0x00, // '7'
+	0x1F,0x00,0x61,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xE1,0x80,0x73,0x00,0x3C,0x00,0x1E,0x00,0x27,0x80,0x63,0x80,0xC1,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x61,0x80,0x1F,0x00, // '8'
+	0x1E,0x00,0x23,0x00,0x61,0x80,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xE0,0xC0,0x71,0xC0,0x3E,0xC0,0x01,0x80,0x01,0x80,0x03,0x00,0x07,0x00,0x0E,0x00,0x38,0x00,0x60,0x00, // '9'
+	0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0, // ':'
+	0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x70,0x70,0x10,0x20,0x40, // ';'
+	0x00,0x00,0x00,0x70,0x01,0xE0,0x07,0x80,0x1E,0x00,0x70,0x00,0xC0,0x00,0xF0,0x00,0x3C,0x00,0x0F,0x00,0x03,0xC0,0x00,0x70,0x00,0x10, // '<'
+	0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0, // '='
+	0x80,0x00,0xE0,0x00,0x3C,0x00,0x0F,0x00,0x03,0xC0,0x00,0xF0,0x00,0x30,0x00,0xE0,0x07,0x80,0x1E,0x00,0x78,0x00,0xE0,0x00,0x00,0x00, // '>'
+	0x7C,0x86,0x83,0xC3,0x03,0x03,0x06,0x0C,0x08,0x08,0x10,0x10,0x00,0x00,0x30,0x30,0x30, // '?'
+	0x03,0xF0,0x00,0x0C,0x0C,0x00,0x18,0x02,0x00,0x30,0x01,0x00,0x60,0xED,0x00,0x61,0x98,0x80,0xC3,0x18,0x80,0xC2,0x18,0x80,0xC6,0x18,0x80,0xC6,0x10,0x80,0xC6,0x31,0x00,0x66,0x32,0x00,0x63,0xDC,0x00,0x30,0x00,0x00,0x0C,0x04,0x00,0x03,0xF8,0x00, // '@'
+	0x00,0x80,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x02,0xE0,0x00,0x02,0x60,0x00,0x06,0x70,0x00,0x04,0x30,0x00,0x04,0x38,0x00,0x08,0x18,0x00,0x0F,0xFC,0x00,0x18,0x1C,0x00,0x10,0x0E,0x00,0x30,0x0E,0x00,0x30,0x0F,0x00,0xF8,0x1F,0x80, // 'A'
+	0xFF,0x80,0x30,0xC0,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0xC0,0x3F,0x00,0x30,0xE0,0x30,0x60,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x70,0x30,0xE0,0xFF,0xC0, // 'B'
+	0x07,0xE2,0x1C,0x1E,0x30,0x0E,0x60,0x06,0x60,0x02,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x30,0x02,0x1C,0x0C,0x07,0xF0, // 'C'
+	0xFF,0xC0,0x30,0x78,0x30,0x1C,0x30,0x0E,0x30,0x06,0x30,0x03,0x30,0x03,0x30,0x03,0x30,0x03,0x30,0x03,0x30,0x03,0x30,0x06,0x30,0x06,0x30,0x0C,0x30,0x78,0xFF,0xC0, // 'D'
+	0xFF,0xFC,0x30,0x0C,0x30,0x04,0x30,0x00,0x30,0x00,0x30,0x10,0x30,0x30,0x3F,0xF0,0x30,0x30,0x30,0x10,0x30,0x00,0x30,0x00,0x30,0x08,0x30,0x08,0x30,0x38,0xFF,0xF8, // 'E'
+	0xFF,0xFC,0x30,0x0C,0x30,0x04,0x30,0x00,0x30,0x00,0x30,0x10,0x30,0x30,0x3F,0xF0,0x30,0x30,0x30,0x10,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00, // 'F'
+	0x07,0xE4,0x1C,0x3C,0x30,0x0C,0x60,0x0C,0x60,0x04,0xC0,0x00,0xC0,0x00,0xC0,0x3F,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0x60,0x0C,0x60,0x0C,0x30,0x0C,0x1C,0x1C,0x07,0xE0, // 'G'
+	0xFC,0x3F,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0xFC,0x3F, // 'H'
+	0xFC,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xFC, // 'I'
+	0x3F,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0xC8,0xF0, // 'J'
+	0xFC,0xFE,0x30,0x38,0x30,0x20,0x30,0x40,0x30,0x80,0x33,0x00,0x36,0x00,0x3E,0x00,0x37,0x00,0x33,0x80,0x31,0xC0,0x30,0xE0,0x30,0x70,0x30,0x38,0x30,0x3C,0xFC,0x7F, // 'K'
+	0xFC,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x02,0x30,0x04,0x30,0x1C,0xFF,0xFC, // 'L'
+	0xF8,0x01,0xE0,0x38,0x03,0x80,0x38,0x03,0x80,0x3C,0x07,0x80,0x2C,0x05,0x80,0x2E,0x0D,0x80,0x26,0x09,0x80,0x27,0x09,0x80,0x27,0x11,0x80,0x23,0x91,0x80,0x23,0xB1,0x80,0x21,0xA1,0x80,0x21,0xE1,0x80,0x20,0xC1,0x80,0x70,0xC1,0x80,0xF8,0x87,0xE0, // 'M'
+	0xF0,0x1F,0x78,0x0E,0x3C,0x04,0x3E,0x04,0x2E,0x04,0x27,0x04,0x23,0x84,0x23,0xC4,0x21,0xE4,0x20,0xE4,0x20,0x74,0x20,0x3C,0x20,0x1C,0x20,0x0C,0x70,0x0C,0xF8,0x04, // 'N'
+	0x07,0xC0,0x18,0x30,0x30,0x18,0x60,0x0C,0x60,0x0C,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0x60,0x0C,0x60,0x0C,0x30,0x18,0x18,0x30,0x07,0xC0, // 'O'
+	0xFF,0x80,0x30,0xE0,0x30,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x60,0x30,0xE0,0x3F,0x80,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00, // 'P'
+	0x0F,0xE0,0x18,0x30,0x30,0x18,0x60,0x0C,0x60,0x0C,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0x60,0x0C,0x60,0x0C,0x30,0x18,0x18,0x30,0x07,0xC0,0x03,0xC0,0x01,0xE0,0x00,0x78,0x00,0x1F, // 'Q'
+	0xFF,0x80,0x30,0xE0,0x30,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x70,0x30,0xE0,0x3F,0x80,0x33,0x80,0x31,0xC0,0x31,0xE0,0x30,0xF0,0x30,0x70,0x30,0x38,0xFC,0x1E, // 'R'
+	0x1F,0x40,0x30,0xC0,0x60,0x40,0x60,0x40,0x70,0x20,0x78,0x00,0x3C,0x00,0x1F,0x00,0x07,0xC0,0x01,0xC0,0x00,0xE0,0x80,0x60,0x40,0x60,0x40,0x60,0x70,0xC0,0x4F,0x80, // 'S'
+	0xFF,0xFE,0xC3,0x06,0x83,0x06,0x83,0x02,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0, // 'T'
+	0xFC,0x1F,0x30,0x0E,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x30,0x04,0x18,0x08,0x1C,0x18,0x07,0xE0, // 'U'
+	0xFE,0x0F,0x80,0x38,0x06,0x00,0x38,0x06,0x00,0x18,0x04,0x00,0x1C,0x04,0x00,0x0C,0x08,0x00,0x0E,0x08,0x00,0x06,0x18,0x00,0x07,0x10,0x00,0x03,0x30,0x00,0x03,0xA0,0x00,0x01,0xA0,0x00,0x01,0xE0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00, // 'V'
+	0xFC,0xFC,0x3C,0x78,0x70,0x18,0x38,0x30,0x18,0x18,0x38,0x10,0x1C,0x18,0x10,0x1C,0x1C,0x20,0x0C,0x3C,0x20,0x0E,0x2C,0x20,0x06,0x6E,0x40,0x07,0x46,0x40,0x07,0x47,0x80,0x03,0x87,0x80,0x03,0x83,0x80,0x03,0x83,0x00,0x01,0x01,0x00,0x01,0x01,0x00, // 'W'
+	0x7F,0x1F,0x80,0x3C,0x06,0x00,0x1C,0x0C,0x00,0x0E,0x18,0x00,0x07,0x10,0x00,0x03,0x20,0x00,0x03,0xC0,0x00,0x01,0xC0,0x00,0x01,0xE0,0x00,0x03,0x60,0x00,0x06,0x70,0x00,0x04,0x38,0x00,0x08,0x1C,0x00,0x10,0x1C,0x00,0x30,0x1E,0x00,0xFC,0x3F,0x80, // 'X'
+	0xFE,0x1F,0x78,0x0C,0x38,0x08,0x1C,0x18,0x0E,0x10,0x06,0x20,0x07,0x60,0x03,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0, // 'Y'
+	0x7F,0xF8,0xC0,0x30,0x80,0x70,0x80,0xE0,0x01,0xC0,0x01,0xC0,0x03,0x80,0x07,0x00,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x38,0x04,0x70,0x0C,0xE0,0x18,0xFF,0xF8, // 'Z'
+	0xF8,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xF8, // '['
+	0xC0,0xC0,0x40,0x60,0x60,0x20,0x30,0x30,0x10,0x18,0x18,0x08,0x0C,0x0C,0x04,0x06,0x06, // 0x5C
+	0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8, // ']'
+	0x0C,0x00,0x1C,0x00,0x16,0x00,0x36,0x00,0x23,0x00,0x63,0x00,0x41,0x80,0xC1,0x80,0x80,0xC0, // '^'
+	0xFF,0xF0, // '_'
+	0xC0,0xE0,0x30,0x18, // '`'
+	0x3E,0x00,0xC6,0x00,0xC3,0x00,0x03,0x00,0x03,0x00,0x1F,0x00,0x63,0x00,0xC3,0x00,0xC3,0x00,0xC7,0x00,0x7B,0x80, // 'a'
+	0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x6F,0x00,0x71,0x80,0x61,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x60,0x80,0x61,0x80,0x61,0x00,0x3E,0x00, // 'b'
+	0x1E,0x23,0x63,0xC0,0xC0,0xC0,0xC0,0xC0,0xE1,0x72,0x3C, // 'c'
+	0x00,0x80,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1D,0x80,0x23,0x80,0x61,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xE1,0x80,0x73,0x80,0x3D,0xC0, // 'd'
+	0x1E,0x00,0x23,0x80,0x41,0x80,0xFF,0x80,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xE0,0x40,0x60,0x80,0x71,0x00,0x1E,0x00, // 'e'
+	0x0F,0x00,0x11,0x80,0x10,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x7C,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00, // 'f'
+	0x1F,0x00,0x31,0xF0,0x60,0xC0,0x60,0xC0,0x60,0xC0,0x31,0x80,0x1F,0x00,0x20,0x00,0x40,0x00,0x7F,0xC0,0x40,0x20,0x40,0x20,0xC0,0x20,0xC0,0x40,0xE0,0x80,0x3F,0x00, // 'g'
+	0x30,0x00,0xF0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x37,0x80,0x39,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x79,0xE0, // 'h'
+	0x30,0x30,0x00,0x00,0x00,0x10,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xF8, // 'i'
+	0x0C,0x0C,0x00,0x00,0x00,0x0C,0x1C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0xC8,0xF0, // 'j'
+	0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x63,0xE0,0x61,0x00,0x62,0x00,0x64,0x00,0x78,0x00,0x7C,0x00,0x6E,0x00,0x67,0x00,0x63,0x00,0x61,0xC0,0xF3,0xE0, // 'k'
+	0x10,0x70,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xF8, // 'l'
+	0xF7,0x8F,0x00,0x38,0xF3,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x30,0xC1,0x80,0x79,0xE3,0xC0, // 'm'
+	0xF7,0x80,0x38,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x79,0xE0, // 'n'
+	0x1E,0x00,0x63,0x80,0x41,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x60,0x80,0x71,0x00,0x1E,0x00, // 'o'
+	0x77,0x80,0x38,0xC0,0x30,0xE0,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0x60,0x30,0xC0,0x38,0x80,0x37,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00, // 'p'
+	0x1E,0x80,0x33,0x80,0x61,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xC1,0x80,0xE1,0x80,0x63,0x80,0x3D,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xC0, // 'q'
+	0x37,0x7B,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x7C, // 'r'
+	0x7A,0x86,0x86,0x82,0xE0,0x78,0x1E,0x86,0x86,0xC4,0xB8, // 's'
+	0x20,0x60,0xF8,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x64,0x38, // 't'
+	0xE3,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x73,0x80,0x3D,0xC0, // 'u'
+	0xF8,0xE0,0x70,0x40,0x30,0x40,0x30,0x80,0x18,0x80,0x19,0x00,0x0D,0x00,0x0D,0x00,0x06,0x00,0x06,0x00,0x04,0x00, // 'v'
+	0xF3,0xE7,0x61,0x83,0x70,0xC2,0x30,0xC2,0x30,0xC4,0x19,0x64,0x19,0x68,0x0E,0x38,0x0E,0x38,0x0C,0x30,0x04,0x10, // 'w'
+	0xFB,0xC0,0x31,0x80,0x19,0x00,0x1E,0x00,0x0C,0x00,0x06,0x00,0x0F,0x00,0x13,0x00,0x21,0x80,0x61,0xC0,0xF3,0xE0, // 'x'
+	0xF8,0xE0,0x70,0x40,0x30,0x40,0x30,0x80,0x18,0x80,0x18,0x80,0x0D,0x00,0x0D,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x78,0x00,0x70,0x00, // 'y'
+	0x7F,0x80,0x43,0x80,0x03,0x00,0x06,0x00,0x0E,0x00,0x0C,0x00,0x1C,0x00,0x38,0x00,0x30,0x40,0x70,0xC0,0xFF,0x80, // 'z'
+	0x18,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xC0,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x18, // '{'
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80, // '|'
+	0xC0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x18,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xC0, // '}'
+	0x38,0x00,0x66,0x20,0x41,0xC0, // '~'
+};
+const GFXglyph FreeSerif12pt7b_ROWSGlyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   0,   0,   6,    0,    1 }, // ' '
+	  {     0,   2,  16,   8,    3,  -15 }, // '!'
+	  {    16,   6,   6,  10,    1,  -15 }, // '"'
+	  {    22,  12,  16,  12,    0,  -15 }, // '#'
+	  {    54,  10,  18,  12,    1,  -16 }, // '$'
+	  {    90,  18,  17,  20,    1,  -16 }, // '%'
+	  {   141,  17,  16,  19,    1,  -15 }, // '&'
+	  {   189,   2,   6,   5,    1,  -15 }, // '''
+	  {   195,   6,  20,   8,    1,  -15 }, // '('
+	  {   215,   6,  20,   8,    1,  -15 }, // ')'
+	  {   235,   8,  10,  12,    3,  -14 }, // '*'
+	  {   245,  11,  11,  14,    1,  -10 }, // '+'
+	  {   267,   3,   6,   6,    2,   -2 }, // ','
+	  {   273,   6,   1,   8,    1,   -5 }, // '-'
+	  {   274,   2,   3,   6,    2,   -2 }, // '.'
+	  {   277,   7,  17,   7,    0,  -16 }, // '/'
+	  {   294,  10,  17,  12,    1,  -16 }, // '0'
+	  {   328,   6,  17,  12,    3,  -16 }, // '1'
+	  {   345,  10,  15,  12,    1,  -14 }, // '2'
+	  {   375,  10,  16,  12,    1,  -15 }, // '3'
+	  {   407,  10,  16,  12,    1,  -15 }, // '4'
+	  {   439,  10,  17,  12,    1,  -16 }, // '5'
+	  {   473,  10,  17,  12,    1,  -16 }, // '6'
+	  {   507,  10,  16,  12,    0,  -15 }, // '7'
+	  {   539,  10,  17,  12,    1,  -16 }, // '8'
+	  {   573,  10,  18,  12,    1,  -16 }, // '9'
+	  {   609,   2,  12,   6,    2,  -11 }, // ':'
+	  {   621,   4,  15,   6,    2,  -11 }, // ';'
+	  {   636,  12,  13,  14,    1,  -12 }, // '<'
+	  {   662,  12,   6,  14,    1,   -8 }, // '='
+	  {   674,  12,  13,  14,    1,  -11 }, // '>'
+	  {   700,   8,  17,  11,    2,  -16 }, // '?'
+	  {   717,  17,  16,  21,    2,  -15 }, // '@'
+	  {   765,  17,  16,  17,    0,  -15 }, // 'A'
+	  {   813,  12,  16,  15,    1,  -15 }, // 'B'
+	  {   845,  15,  16,  16,    1,  -15 }, // 'C'
+	  {   877,  16,  16,  17,    0,  -15 }, // 'D'
+	  {   909,  14,  16,  15,    0,  -15 }, // 'E'
+	  {   941,  14,  16,  14,    0,  -15 }, // 'F'
+	  {   973,  16,  16,  17,    1,  -15 }, // 'G'
+	  {  1005,  16,  16,  17,    0,  -15 }, // 'H'
+	  {  1037,   6,  16,   8,    1,  -15 }, // 'I'
+	  {  1053,   8,  16,   9,    0,  -15 }, // 'J'
+	  {  1069,  16,  16,  17,    1,  -15 }, // 'K'
+	  {  1101,  15,  16,  15,    0,  -15 }, // 'L'
+	  {  1133,  19,  16,  21,    1,  -15 }, // 'M'
+	  {  1181,  16,  16,  17,    1,  -15 }, // 'N'
+	  {  1213,  15,  16,  17,    1,  -15 }, // 'O'
+	  {  1245,  12,  16,  14,    0,  -15 }, // 'P'
+	  {  1277,  16,  20,  17,    1,  -15 }, // 'Q'
+	  {  1317,  15,  16,  16,    0,  -15 }, // 'R'
+	  {  1349,  11,  16,  13,    0,  -15 }, // 'S'
+	  {  1381,  15,  16,  15,    0,  -15 }, // 'T'
+	  {  1413,  16,  16,  17,    1,  -15 }, // 'U'
+	  {  1445,  17,  16,  17,    0,  -15 }, // 'V'
+	  {  1493,  22,  16,  23,    0,  -15 }, // 'W'
+	  {  1541,  17,  16,  17,    0,  -15 }, // 'X'
+	  {  1589,  16,  16,  17,    0,  -15 }, // 'Y'
+	  {  1621,  14,  16,  15,    1,  -15 }, // 'Z'
+	  {  1653,   5,  20,   8,    2,  -15 }, // '['
+	  {  1673,   7,  17,   7,    0,  -16 }, // 0x5C
+	  {  1690,   5,  20,   8,    1,  -15 }, // ']'
+	  {  1710,  10,   9,  11,    1,  -15 }, // '^'
+	  {  1728,  12,   1,  12,    0,    3 }, // '_'
+	  {  1730,   5,   4,   6,    0,  -15 }, // '`'
+	  {  1734,  10,  11,  10,    1,  -10 }, // 'a'
+	  {  1756,  10,  17,  12,    1,  -16 }, // 'b'
+	  {  1790,   8,  11,  11,    1,  -10 }, // 'c'
+	  {  1801,  10,  17,  12,    1,  -16 }, // 'd'
+	  {  1835,  10,  11,  11,    1,  -10 }, // 'e'
+	  {  1857,   9,  17,   9,    0,  -16 }, // 'f'
+	  {  1891,  12,  16,  11,    0,  -10 }, // 'g'
+	  {  1923,  11,  17,  12,    0,  -16 }, // 'h'
+	  {  1957,   5,  16,   7,    0,  -15 }, // 'i'
+	  {  1973,   6,  21,   8,    0,  -15 }, // 'j'
+	  {  1994,  11,  17,  12,    1,  -16 }, // 'k'
+	  {  2028,   5,  17,   6,    0,  -16 }, // 'l'
+	  {  2045,  18,  11,  19,    0,  -10 }, // 'm'
+	  {  2078,  11,  11,  12,    0,  -10 }, // 'n'
+	  {  2100,  10,  11,  12,    1,  -10 }, // 'o'
+	  {  2122,  11,  16,  12,    0,  -10 }, // 'p'
+	  {  2154,  10,  16,  12,    1,  -10 }, // 'q'
+	  {  2186,   8,  11,   8,    0,  -10 }, // 'r'
+	  {  2197,   7,  11,   9,    1,  -10 }, // 's'
+	  {  2208,   6,  13,   7,    1,  -12 }, // 't'
+	  {  2221,  10,  11,  12,    1,  -10 }, // 'u'
+	  {  2243,  11,  11,  11,    0,  -10 }, // 'v'
+	  {  2265,  16,  11,  16,    0,  -10 }, // 'w'
+	  {  2287,  11,  11,  12,    0,  -10 }, // 'x'
+	  {  2309,  11,  16,  11,    0,  -10 }, // 'y'
+	  {  2341,  10,  11,  10,    0,  -10 }, // 'z'
+	  {  2363,   5,  21,  12,    2,  -16 }, // '{'
+	  {  2384,   1,  17,   5,    2,  -16 }, // '|'
+	  {  2401,   5,  21,  12,    5,  -15 }, // '}'
+	  {  2422,  12,   3,  12,    0,   -6 }  // '~'
+};
+const GFXfont FreeSerif12pt7b_ROWS PROGMEM = {
+(uint8_t  *)FreeSerif12pt7b_ROWSBitmaps,(GFXglyph *)FreeSerif12pt7b_ROWSGlyphs,0x20, 0x7E, 29};
@@ -0,0 +1,198 @@
+// FreeSerif12pt7b converted by fontcomp to FONT_FORMAT_ROWS_SHIFTED (29336 bytes of glyph data instead of 1839)
+// Call tpSetFontFormat((GFXfont *)&FreeSerif12pt7b_SHIFTED, FONT_FORMAT_ROWS_SHIFTED) before using it
+const uint8_t FreeSerif12pt7b_SHIFTEDBitmaps[] PROGMEM = {
+	0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80, // '!'
+	0xCC,0x00,0xCC,0x00,0xCC,0x00,0xCC,0x00,0x88,0x00,0x88,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x66,0x00,0x44,0x00,0x44,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x22,0x00,0x22,0x00,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x11,0x00,0x11,0x00,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x08,0x80,0x08,0x80,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x04,0x40,0x04,0x40,0x03,0x30,0x03,0x30,0x03,0x30,0x03,0x30,0x02,0x20,0x02,0x20,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x98,0x01,0x10,0x01,0x10, // '"'
+	0x0C,0x40,0x00,0x0C,0x40,0x00,0x08,0x40,0x00,0x08,0xC0,0x00,0x08,0xC0,0x00,0x7F,0xF0,0x00,0x18,0x80,0x00,0x18,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0xFF,0xE0,0x00,0x11,0x80,0x00,0x31,0x00,0x00,0x31,0x00,0x00,0x31,0x00,0x00,0x21,0x00,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x04,0x20,0x00,0x04,0x60,0x00,0x04,0x60,0x00,0x3F,0xF8,0x00,0x0C,0x40,0x00,0x0C,0x40,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x7F,0xF0,0x00,0x08,0xC0,0x00,0x18,0x80,0x00,0x18,0x80,0x00,0x18,0x80,0x00,0x10,0x80,0x00,0x03,0x10,0x00,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x30,0x00,0x02,0x30,0x00,0x1F,0xFC,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x3F,0xF8,0x00,0x04,0x60,0x00,0x0C,0x40,0x00,0x0C,0x40,0x00,0x0C,0x40,0x00,0x08,0x40,0x00,0x01,0x88,0x00,0x01,0x88,0x00,0x01,0x08,0x00,0x01,0x18,0x00,0x01,0x18,0x00,0x0F,0xFE,0x00,0x03,0x10,0x00,0x03,0x10,0x00,0x02,0x10,0x00,0x02,0x10,0x00,0x1F,0xFC,0x00,0x02,0x30,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x04,0x20,0x00,0x00,0xC4,0x00,0x00,0xC4,0x00,0x00,0x84,0x00,0x00,0x8C,0x00,0x00,0x8C,0x00,0x07,0xFF,0x00,0x01,0x88,0x00,0x01,0x88,0x00,0x01,0x08,0x00,0x01,0x08,0x00,0x0F,0xFE,0x00,0x01,0x18,0x00,0x03,0x10,0x00,0x03,0x10,0x00,0x03,0x10,0x00,0x02,0x10,0x00,0x00,0x62,0x00,0x00,0x62,0x00,0x00,0x42,0x00,0x00,0x46,0x00,0x00,0x46,0x00,0x03,0xFF,0x80,0x00,0xC4,0x00,0x00,0xC4,0x00,0x00,0x84,0x00,0x00,0x84,0x00,0x07,0xFF,0x00,0x00,0x8C,0x00,0x01,0x88,0x00,0x01,0x88,0x00,0x01,0x88,0x00,0x01,0x08,0x00,0x00,0x31,0x00,0x00,0x31,0x00,0x00,0x21,0x00,0x00,0x23,0x00,0x00,0x23,0x00,0x01,0xFF,0xC0,0x00,0x62,0x00,0x00,0x62,0x00,0x00,0x42,0x00,0x00,0x42,0x00,0x03,0xFF,0x80,0x00,0x46,0x00,0x00,0xC4,0x00,0x00,0xC4,0x00,0x00,0xC4,0x00,0x00,0x84,0x00,0x00,0x18,0x80,0x00,0x18,0x80,0x00,0x10,0x80,0x00,0x11,0x80,0x00,0x11,0x80,0x00,0xFF,0xE0,0x00,0x31,0x00,0x00,0x31,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x01,0xFF,0xC0,0x00,0x23,0x00,0x00,0x62,0x00,0x00,0x62,0x00,0x00,0x62,0x00,0x00,0x42,0x00, // '#'
+	0x04,0x00,0x00,0x1F,0x00,0x00,0x65,0x80,0x00,0xC4,0x80,0x00,0xC4,0x80,0x00,0xC4,0x00,0x00,0xF4,0x00,0x00,0x7C,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x05,0x80,0x00,0x04,0xC0,0x00,0x84,0xC0,0x00,0x84,0xC0,0x00,0xC4,0xC0,0x00,0xE5,0x80,0x00,0x3F,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x0F,0x80,0x00,0x32,0xC0,0x00,0x62,0x40,0x00,0x62,0x40,0x00,0x62,0x00,0x00,0x7A,0x00,0x00,0x3E,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x02,0xC0,0x00,0x02,0x60,0x00,0x42,0x60,0x00,0x42,0x60,0x00,0x62,0x60,0x00,0x72,0xC0,0x00,0x1F,0x80,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x07,0xC0,0x00,0x19,0x60,0x00,0x31,0x20,0x00,0x31,0x20,0x00,0x31,0x00,0x00,0x3D,0x00,0x00,0x1F,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x01,0x60,0x00,0x01,0x30,0x00,0x21,0x30,0x00,0x21,0x30,0x00,0x31,0x30,0x00,0x39,0x60,0x00,0x0F,0xC0,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x03,0xE0,0x00,0x0C,0xB0,0x00,0x18,0x90,0x00,0x18,0x90,0x00,0x18,0x80,0x00,0x1E,0x80,0x00,0x0F,0x80,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0xB0,0x00,0x00,0x98,0x00,0x10,0x98,0x00,0x10,0x98,0x00,0x18,0x98,0x00,0x1C,0xB0,0x00,0x07,0xE0,0x00,0x00,0x80,0x00,0x00,0x40,0x00,0x01,0xF0,0x00,0x06,0x58,0x00,0x0C,0x48,0x00,0x0C,0x48,0x00,0x0C,0x40,0x00,0x0F,0x40,0x00,0x07,0xC0,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x58,0x00,0x00,0x4C,0x00,0x08,0x4C,0x00,0x08,0x4C,0x00,0x0C,0x4C,0x00,0x0E,0x58,0x00,0x03,0xF0,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0x00,0xF8,0x00,0x03,0x2C,0x00,0x06,0x24,0x00,0x06,0x24,0x00,0x06,0x20,0x00,0x07,0xA0,0x00,0x03,0xE0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x2C,0x00,0x00,0x26,0x00,0x04,0x26,0x00,0x04,0x26,0x00,0x06,0x26,0x00,0x07,0x2C,0x00,0x01,0xF8,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x7C,0x00,0x01,0x96,0x00,0x03,0x12,0x00,0x03,0x12,0x00,0x03,0x10,0x00,0x03,0xD0,0x00,0x01,0xF0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x16,0x00,0x00,0x13,0x00,0x02,0x13,0x00,0x02,0x13,0x00,0x03,0x13,0x00,0x03,0x96,0x00,0x00,0xFC,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x3E,0x00,0x00,0xCB,0x00,0x01,0x89,0x00,0x01,0x89,0x00,0x01,0x88,0x00,0x01,0xE8,0x00,0x00,0xF8,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x0B,0x00,0x00,0x09,0x80,0x01,0x09,0x80,0x01,0x09,0x80,0x01,0x89,0x80,0x01,0xCB,0x00,0x00,0x7E,0x00,0x00,0x08,0x00, // '$'
+	0x00,0x04,0x00,0x00,0x0E,0x0C,0x00,0x00,0x39,0xF8,0x00,0x00,0x70,0x88,0x00,0x00,0x60,0x90,0x00,0x00,0xE0,0x90,0x00,0x00,0xC1,0x20,0x00,0x00,0xC3,0x40,0x00,0x00,0xC6,0x47,0x80,0x00,0x78,0x8C,0x40,0x00,0x00,0x98,0x40,0x00,0x01,0x38,0x40,0x00,0x03,0x30,0x40,0x00,0x02,0x30,0x80,0x00,0x04,0x30,0x80,0x00,0x04,0x31,0x00,0x00,0x08,0x1E,0x00,0x00,0x00,0x02,0x00,0x00,0x07,0x06,0x00,0x00,0x1C,0xFC,0x00,0x00,0x38,0x44,0x00,0x00,0x30,0x48,0x00,0x00,0x70,0x48,0x00,0x00,0x60,0x90,0x00,0x00,0x61,0xA0,0x00,0x00,0x63,0x23,0xC0,0x00,0x3C,0x46,0x20,0x00,0x00,0x4C,0x20,0x00,0x00,0x9C,0x20,0x00,0x01,0x98,0x20,0x00,0x01,0x18,0x40,0x00,0x02,0x18,0x40,0x00,0x02,0x18,0x80,0x00,0x04,0x0F,0x00,0x00,0x00,0x01,0x00,0x00,0x03,0x83,0x00,0x00,0x0E,0x7E,0x00,0x00,0x1C,0x22,0x00,0x00,0x18,0x24,0x00,0x00,0x38,0x24,0x00,0x00,0x30,0x48,0x00,0x00,0x30,0xD0,0x00,0x00,0x31,0x91,0xE0,0x00,0x1E,0x23,0x10,0x00,0x00,0x26,0x10,0x00,0x00,0x4E,0x10,0x00,0x00,0xCC,0x10,0x00,0x00,0x8C,0x20,0x00,0x01,0x0C,0x20,0x00,0x01,0x0C,0x40,0x00,0x02,0x07,0x80,0x00,0x00,0x00,0x80,0x00,0x01,0xC1,0x80,0x00,0x07,0x3F,0x00,0x00,0x0E,0x11,0x00,0x00,0x0C,0x12,0x00,0x00,0x1C,0x12,0x00,0x00,0x18,0x24,0x00,0x00,0x18,0x68,0x00,0x00,0x18,0xC8,0xF0,0x00,0x0F,0x11,0x88,0x00,0x00,0x13,0x08,0x00,0x00,0x27,0x08,0x00,0x00,0x66,0x08,0x00,0x00,0x46,0x10,0x00,0x00,0x86,0x10,0x00,0x00,0x86,0x20,0x00,0x01,0x03,0xC0,0x00,0x00,0x00,0x40,0x00,0x00,0xE0,0xC0,0x00,0x03,0x9F,0x80,0x00,0x07,0x08,0x80,0x00,0x06,0x09,0x00,0x00,0x0E,0x09,0x00,0x00,0x0C,0x12,0x00,0x00,0x0C,0x34,0x00,0x00,0x0C,0x64,0x78,0x00,0x07,0x88,0xC4,0x00,0x00,0x09,0x84,0x00,0x00,0x13,0x84,0x00,0x00,0x33,0x04,0x00,0x00,0x23,0x08,0x00,0x00,0x43,0x08,0x00,0x00,0x43,0x10,0x00,0x00,0x81,0xE0,0x00,0x00,0x00,0x20,0x00,0x00,0x70,0x60,0x00,0x01,0xCF,0xC0,0x00,0x03,0x84,0x40,0x00,0x03,0x04,0x80,0x00,0x07,0x04,0x80,0x00,0x06,0x09,0x00,0x00,0x06,0x1A,0x00,0x00,0x06,0x32,0x3C,0x00,0x03,0xC4,0x62,0x00,0x00,0x04,0xC2,0x00,0x00,0x09,0xC2,0x00,0x00,0x19,0x82,0x00,0x00,0x11,0x84,0x00,0x00,0x21,0x84,0x00,0x00,0x21,0x88,0x00,0x00,0x40,0xF0,0x00,0x00,0x00,0x10,0x00,0x00,0x38,0x30,0x00,0x00,0xE7,0xE0,0x00,0x01,0xC2,0x20,0x00,0x01,0x82,0x40,0x00,0x03,0x82,0x40,0x00,0x03,0x04,0x80,0x00,0x03,0x0D,0x00,0x00,0x03,0x19,0x1E,0x00,0x01,0xE2,0x31,0x00,0x00,0x02,0x61,0x00,0x00,0x04,0xE1,0x00,0x00,0x0C,0xC1,0x00,0x00,0x08,0xC2,0x00,0x00,0x10,0xC2,0x00,0x00,0x10,0xC4,0x00,0x00,0x20,0x78,0x00,0x00,0x00,0x08,0x00,0x00,0x1C,0x18,0x00,0x00,0x73,0xF0,0x00,0x00,0xE1,0x10,0x00,0x00,0xC1,0x20,0x00,0x01,0xC1,0x20,0x00,0x01,0x82,0x40,0x00,0x01,0x86,0x80,0x00,0x01,0x8C,0x8F,0x00,0x00,0xF1,0x18,0x80,0x00,0x01,0x30,0x80,0x00,0x02,0x70,0x80,0x00,0x06,0x60,0x80,0x00,0x04,0x61,0x00,0x00,0x08,0x61,0x00,0x00,0x08,0x62,0x00,0x00,0x10,0x3C,0x00, // '%'
+	0x03,0xC0,0x00,0x04,0x60,0x00,0x0C,0x20,0x00,0x0C,0x20,0x00,0x0C,0x40,0x00,0x0F,0x9F,0x00,0x07,0x0E,0x00,0x0F,0x04,0x00,0x33,0x0C,0x00,0x63,0x88,0x00,0x41,0xD0,0x00,0xC1,0xD0,0x00,0xC0,0xE0,0x00,0xE0,0x70,0x00,0xF0,0xF8,0x80,0x3F,0x1F,0x00,0x01,0xE0,0x00,0x02,0x30,0x00,0x06,0x10,0x00,0x06,0x10,0x00,0x06,0x20,0x00,0x07,0xCF,0x80,0x03,0x87,0x00,0x07,0x82,0x00,0x19,0x86,0x00,0x31,0xC4,0x00,0x20,0xE8,0x00,0x60,0xE8,0x00,0x60,0x70,0x00,0x70,0x38,0x00,0x78,0x7C,0x40,0x1F,0x8F,0x80,0x00,0xF0,0x00,0x01,0x18,0x00,0x03,0x08,0x00,0x03,0x08,0x00,0x03,0x10,0x00,0x03,0xE7,0xC0,0x01,0xC3,0x80,0x03,0xC1,0x00,0x0C,0xC3,0x00,0x18,0xE2,0x00,0x10,0x74,0x00,0x30,0x74,0x00,0x30,0x38,0x00,0x38,0x1C,0x00,0x3C,0x3E,0x20,0x0F,0xC7,0xC0,0x00,0x78,0x00,0x00,0x8C,0x00,0x01,0x84,0x00,0x01,0x84,0x00,0x01,0x88,0x00,0x01,0xF3,0xE0,0x00,0xE1,0xC0,0x01,0xE0,0x80,0x06,0x61,0x80,0x0C,0x71,0x00,0x08,0x3A,0x00,0x18,0x3A,0x00,0x18,0x1C,0x00,0x1C,0x0E,0x00,0x1E,0x1F,0x10,0x07,0xE3,0xE0,0x00,0x3C,0x00,0x00,0x46,0x00,0x00,0xC2,0x00,0x00,0xC2,0x00,0x00,0xC4,0x00,0x00,0xF9,0xF0,0x00,0x70,0xE0,0x00,0xF0,0x40,0x03,0x30,0xC0,0x06,0x38,0x80,0x04,0x1D,0x00,0x0C,0x1D,0x00,0x0C,0x0E,0x00,0x0E,0x07,0x00,0x0F,0x0F,0x88,0x03,0xF1,0xF0,0x00,0x1E,0x00,0x00,0x23,0x00,0x00,0x61,0x00,0x00,0x61,0x00,0x00,0x62,0x00,0x00,0x7C,0xF8,0x00,0x38,0x70,0x00,0x78,0x20,0x01,0x98,0x60,0x03,0x1C,0x40,0x02,0x0E,0x80,0x06,0x0E,0x80,0x06,0x07,0x00,0x07,0x03,0x80,0x07,0x87,0xC4,0x01,0xF8,0xF8,0x00,0x0F,0x00,0x00,0x11,0x80,0x00,0x30,0x80,0x00,0x30,0x80,0x00,0x31,0x00,0x00,0x3E,0x7C,0x00,0x1C,0x38,0x00,0x3C,0x10,0x00,0xCC,0x30,0x01,0x8E,0x20,0x01,0x07,0x40,0x03,0x07,0x40,0x03,0x03,0x80,0x03,0x81,0xC0,0x03,0xC3,0xE2,0x00,0xFC,0x7C,0x00,0x07,0x80,0x00,0x08,0xC0,0x00,0x18,0x40,0x00,0x18,0x40,0x00,0x18,0x80,0x00,0x1F,0x3E,0x00,0x0E,0x1C,0x00,0x1E,0x08,0x00,0x66,0x18,0x00,0xC7,0x10,0x00,0x83,0xA0,0x01,0x83,0xA0,0x01,0x81,0xC0,0x01,0xC0,0xE0,0x01,0xE1,0xF1,0x00,0x7E,0x3E, // '&'
+	0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x80,0x00,0x80,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x40,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x20,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x08,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x02,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x01,0x00, // '''
+	0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x00,0x40,0x00,0x80,0x01,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x04,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0xC0,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08, // '('
+	0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x0C,0x00,0x04,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x06,0x00,0x02,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x01,0x80,0x00,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x00,0xC0,0x00,0x40,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0x80,0x01,0x00,0x02,0x00,0x04,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x00,0x40,0x00,0x60,0x00,0x20,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x40,0x00,0x80,0x01,0x00,0x02,0x00,0x01,0x00,0x00,0x80,0x00,0x40,0x00,0x20,0x00,0x30,0x00,0x10,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x20,0x00,0x40,0x00,0x80,0x01,0x00, // ')'
+	0x30,0x00,0xB3,0x00,0xD7,0x00,0x54,0x00,0x38,0x00,0x7C,0x00,0xD3,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x59,0x80,0x6B,0x80,0x2A,0x00,0x1C,0x00,0x3E,0x00,0x69,0x80,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x2C,0xC0,0x35,0xC0,0x15,0x00,0x0E,0x00,0x1F,0x00,0x34,0xC0,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x16,0x60,0x1A,0xE0,0x0A,0x80,0x07,0x00,0x0F,0x80,0x1A,0x60,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x0B,0x30,0x0D,0x70,0x05,0x40,0x03,0x80,0x07,0xC0,0x0D,0x30,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x05,0x98,0x06,0xB8,0x02,0xA0,0x01,0xC0,0x03,0xE0,0x06,0x98,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x02,0xCC,0x03,0x5C,0x01,0x50,0x00,0xE0,0x01,0xF0,0x03,0x4C,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x01,0x66,0x01,0xAE,0x00,0xA8,0x00,0x70,0x00,0xF8,0x01,0xA6,0x00,0x60,0x00,0x60,0x00,0x20, // '*'
+	0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0xFF,0xE0,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x7F,0xF0,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x3F,0xF8,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x1F,0xFC,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x0F,0xFE,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x07,0xFF,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x03,0xFF,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x01,0xFF,0xC0,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00, // '+'
+	0xC0,0x00,0xE0,0x00,0xE0,0x00,0x20,0x00,0x40,0x00,0x80,0x00,0x60,0x00,0x70,0x00,0x70,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x30,0x00,0x38,0x00,0x38,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x18,0x00,0x1C,0x00,0x1C,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x0C,0x00,0x0E,0x00,0x0E,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x03,0x00,0x03,0x80,0x03,0x80,0x00,0x80,0x01,0x00,0x02,0x00,0x01,0x80,0x01,0xC0,0x01,0xC0,0x00,0x40,0x00,0x80,0x01,0x00, // ','
+	0xFC,0x00,0x7E,0x00,0x3F,0x00,0x1F,0x80,0x0F,0xC0,0x07,0xE0,0x03,0xF0,0x01,0xF8, // '-'
+	0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x01,0x80, // '.'
+	0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x04,0x00,0x0C,0x00,0x0C,0x00,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x00,0x03,0x00,0x03,0x00,0x00,0x0C,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x30,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0x80,0x01,0x80,0x01,0x80, // '/'
+	0x1E,0x00,0x00,0x33,0x00,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0xC0,0x80,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x33,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x19,0x80,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x60,0x40,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x19,0x80,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x0C,0xC0,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x30,0x20,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x0C,0xC0,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x06,0x60,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x18,0x10,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x06,0x60,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x03,0x30,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x0C,0x08,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x03,0x30,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x01,0x98,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x06,0x04,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x01,0x98,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0xCC,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x03,0x02,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x00,0xCC,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x66,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x01,0x81,0x00,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0x66,0x00,0x00,0x3C,0x00, // '0'
+	0x10,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00,0x08,0x00,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00,0x04,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0x00,0x02,0x00,0x0E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x80,0x01,0x00,0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,0x00,0x80,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x00,0x40,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0xF0,0x00,0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x01,0xF8, // '1'
+	0x1E,0x00,0x00,0x63,0x00,0x00,0x41,0x80,0x00,0x81,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x60,0x40,0x00,0xFF,0x80,0x00,0x0F,0x00,0x00,0x31,0x80,0x00,0x20,0xC0,0x00,0x40,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x30,0x20,0x00,0x7F,0xC0,0x00,0x07,0x80,0x00,0x18,0xC0,0x00,0x10,0x60,0x00,0x20,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x18,0x10,0x00,0x3F,0xE0,0x00,0x03,0xC0,0x00,0x0C,0x60,0x00,0x08,0x30,0x00,0x10,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x0C,0x08,0x00,0x1F,0xF0,0x00,0x01,0xE0,0x00,0x06,0x30,0x00,0x04,0x18,0x00,0x08,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x06,0x04,0x00,0x0F,0xF8,0x00,0x00,0xF0,0x00,0x03,0x18,0x00,0x02,0x0C,0x00,0x04,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0x03,0x02,0x00,0x07,0xFC,0x00,0x00,0x78,0x00,0x01,0x8C,0x00,0x01,0x06,0x00,0x02,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0x81,0x00,0x03,0xFE,0x00,0x00,0x3C,0x00,0x00,0xC6,0x00,0x00,0x83,0x00,0x01,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x80,0x01,0xFF,0x00, // '2'
+	0x1E,0x00,0x00,0x63,0x80,0x00,0x81,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x0F,0x00,0x00,0x1F,0x80,0x00,0x03,0xC0,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0xE1,0x00,0x00,0x7E,0x00,0x00,0x0F,0x00,0x00,0x31,0xC0,0x00,0x40,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x07,0x80,0x00,0x0F,0xC0,0x00,0x01,0xE0,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x70,0x80,0x00,0x3F,0x00,0x00,0x07,0x80,0x00,0x18,0xE0,0x00,0x20,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x03,0xC0,0x00,0x07,0xE0,0x00,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x38,0x40,0x00,0x1F,0x80,0x00,0x03,0xC0,0x00,0x0C,0x70,0x00,0x10,0x30,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x01,0xE0,0x00,0x03,0xF0,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x1C,0x20,0x00,0x0F,0xC0,0x00,0x01,0xE0,0x00,0x06,0x38,0x00,0x08,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0xF0,0x00,0x01,0xF8,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x0E,0x10,0x00,0x07,0xE0,0x00,0x00,0xF0,0x00,0x03,0x1C,0x00,0x04,0x0C,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x07,0x08,0x00,0x03,0xF0,0x00,0x00,0x78,0x00,0x01,0x8E,0x00,0x02,0x06,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x0F,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x03,0x84,0x00,0x01,0xF8,0x00,0x00,0x3C,0x00,0x00,0xC7,0x00,0x01,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x1E,0x00,0x00,0x3F,0x00,0x00,0x07,0x80,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x03,0x00,0x01,0xC2,0x00,0x00,0xFC,0x00, // '3'
+	0x01,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0B,0x00,0x00,0x0B,0x00,0x00,0x13,0x00,0x00,0x23,0x00,0x00,0x23,0x00,0x00,0x43,0x00,0x00,0x83,0x00,0x00,0x83,0x00,0x00,0xFF,0xC0,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x05,0x80,0x00,0x09,0x80,0x00,0x11,0x80,0x00,0x11,0x80,0x00,0x21,0x80,0x00,0x41,0x80,0x00,0x41,0x80,0x00,0x7F,0xE0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x02,0xC0,0x00,0x02,0xC0,0x00,0x04,0xC0,0x00,0x08,0xC0,0x00,0x08,0xC0,0x00,0x10,0xC0,0x00,0x20,0xC0,0x00,0x20,0xC0,0x00,0x3F,0xF0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x01,0x60,0x00,0x01,0x60,0x00,0x02,0x60,0x00,0x04,0x60,0x00,0x04,0x60,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x60,0x00,0x1F,0xF8,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0xB0,0x00,0x00,0xB0,0x00,0x01,0x30,0x00,0x02,0x30,0x00,0x02,0x30,0x00,0x04,0x30,0x00,0x08,0x30,0x00,0x08,0x30,0x00,0x0F,0xFC,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x58,0x00,0x00,0x58,0x00,0x00,0x98,0x00,0x01,0x18,0x00,0x01,0x18,0x00,0x02,0x18,0x00,0x04,0x18,0x00,0x04,0x18,0x00,0x07,0xFE,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x2C,0x00,0x00,0x2C,0x00,0x00,0x4C,0x00,0x00,0x8C,0x00,0x00,0x8C,0x00,0x01,0x0C,0x00,0x02,0x0C,0x00,0x02,0x0C,0x00,0x03,0xFF,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x16,0x00,0x00,0x16,0x00,0x00,0x26,0x00,0x00,0x46,0x00,0x00,0x46,0x00,0x00,0x86,0x00,0x01,0x06,0x00,0x01,0x06,0x00,0x01,0xFF,0x80,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00, // '4'
+	0x00,0x00,0x00,0x0F,0xC0,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x3E,0x00,0x00,0x0F,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x01,0x80,0x00,0xE3,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x1F,0x00,0x00,0x07,0xC0,0x00,0x01,0xC0,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x71,0x80,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x03,0xF0,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x06,0x00,0x00,0x0F,0x80,0x00,0x03,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x38,0xC0,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0x07,0xC0,0x00,0x01,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x1C,0x60,0x00,0x0F,0x80,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x03,0xE0,0x00,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x0E,0x30,0x00,0x07,0xC0,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0xC0,0x00,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x07,0x18,0x00,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0xF8,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x03,0x8C,0x00,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,0x1F,0x80,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x30,0x00,0x00,0x7C,0x00,0x00,0x1F,0x00,0x00,0x07,0x00,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x03,0x00,0x01,0xC6,0x00,0x00,0xF8,0x00, // '5'
+	0x01,0xC0,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0xEF,0x00,0x00,0xF3,0x80,0x00,0xC1,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0x60,0xC0,0x00,0x60,0x80,0x00,0x31,0x80,0x00,0x1E,0x00,0x00,0x00,0xE0,0x00,0x07,0x80,0x00,0x0E,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x30,0x00,0x00,0x77,0x80,0x00,0x79,0xC0,0x00,0x60,0xE0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x30,0x60,0x00,0x30,0x40,0x00,0x18,0xC0,0x00,0x0F,0x00,0x00,0x00,0x70,0x00,0x03,0xC0,0x00,0x07,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x3B,0xC0,0x00,0x3C,0xE0,0x00,0x30,0x70,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x18,0x30,0x00,0x18,0x20,0x00,0x0C,0x60,0x00,0x07,0x80,0x00,0x00,0x38,0x00,0x01,0xE0,0x00,0x03,0x80,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x1D,0xE0,0x00,0x1E,0x70,0x00,0x18,0x38,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x18,0x00,0x0C,0x10,0x00,0x06,0x30,0x00,0x03,0xC0,0x00,0x00,0x1C,0x00,0x00,0xF0,0x00,0x01,0xC0,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x0E,0xF0,0x00,0x0F,0x38,0x00,0x0C,0x1C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x06,0x0C,0x00,0x06,0x08,0x00,0x03,0x18,0x00,0x01,0xE0,0x00,0x00,0x0E,0x00,0x00,0x78,0x00,0x00,0xE0,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x07,0x78,0x00,0x07,0x9C,0x00,0x06,0x0E,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x03,0x06,0x00,0x03,0x04,0x00,0x01,0x8C,0x00,0x00,0xF0,0x00,0x00,0x07,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0x80,0x00,0x03,0xBC,0x00,0x03,0xCE,0x00,0x03,0x07,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x01,0x83,0x00,0x01,0x82,0x00,0x00,0xC6,0x00,0x00,0x78,0x00,0x00,0x03,0x80,0x00,0x1E,0x00,0x00,0x38,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x01,0xDE,0x00,0x01,0xE7,0x00,0x01,0x83,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x00,0xC1,0x80,0x00,0xC1,0x00,0x00,0x63,0x00,0x00,0x3C,0x00, // '6'
+	0x3F,0xC0,0x00,0x40,0xC0,0x00,0x80,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1F,0xE0,0x00,0x20,0x60,0x00,0x40,0x40,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x0F,0xF0,0x00,0x10,0x30,0x00,0x20,0x20,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x07,0xF8,0x00,0x08,0x18,0x00,0x10,0x10,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0xFC,0x00,0x04,0x0C,0x00,0x08,0x08,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0xFE,0x00,0x02,0x06,0x00,0x04,0x04,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0xFF,0x00,0x01,0x03,0x00,0x02,0x02,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x7F,0x80,0x00,0x81,0x80,0x01,0x01,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00, // '7'
+	0x1F,0x00,0x00,0x61,0x80,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xE1,0x80,0x00,0x73,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x27,0x80,0x00,0x63,0x80,0x00,0xC1,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0x61,0x80,0x00,0x1F,0x00,0x00,0x0F,0x80,0x00,0x30,0xC0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x70,0xC0,0x00,0x39,0x80,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x13,0xC0,0x00,0x31,0xC0,0x00,0x60,0xE0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x30,0xC0,0x00,0x0F,0x80,0x00,0x07,0xC0,0x00,0x18,0x60,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x38,0x60,0x00,0x1C,0xC0,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x09,0xE0,0x00,0x18,0xE0,0x00,0x30,0x70,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x18,0x60,0x00,0x07,0xC0,0x00,0x03,0xE0,0x00,0x0C,0x30,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x1C,0x30,0x00,0x0E,0x60,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x04,0xF0,0x00,0x0C,0x70,0x00,0x18,0x38,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x30,0x00,0x03,0xE0,0x00,0x01,0xF0,0x00,0x06,0x18,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0E,0x18,0x00,0x07,0x30,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x02,0x78,0x00,0x06,0x38,0x00,0x0C,0x1C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x06,0x18,0x00,0x01,0xF0,0x00,0x00,0xF8,0x00,0x03,0x0C,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x07,0x0C,0x00,0x03,0x98,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x01,0x3C,0x00,0x03,0x1C,0x00,0x06,0x0E,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x03,0x0C,0x00,0x00,0xF8,0x00,0x00,0x7C,0x00,0x01,0x86,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x86,0x00,0x01,0xCC,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x9E,0x00,0x01,0x8E,0x00,0x03,0x07,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x01,0x86,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0xC3,0x00,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0xC3,0x00,0x00,0xE6,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x4F,0x00,0x00,0xC7,0x00,0x01,0x83,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x00,0xC3,0x00,0x00,0x3E,0x00, // '8'
+	0x1E,0x00,0x00,0x23,0x00,0x00,0x61,0x80,0x00,0xC0,0x80,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xE0,0xC0,0x00,0x71,0xC0,0x00,0x3E,0xC0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x38,0x00,0x00,0x60,0x00,0x00,0x0F,0x00,0x00,0x11,0x80,0x00,0x30,0xC0,0x00,0x60,0x40,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x70,0x60,0x00,0x38,0xE0,0x00,0x1F,0x60,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x1C,0x00,0x00,0x30,0x00,0x00,0x07,0x80,0x00,0x08,0xC0,0x00,0x18,0x60,0x00,0x30,0x20,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x38,0x30,0x00,0x1C,0x70,0x00,0x0F,0xB0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x0E,0x00,0x00,0x18,0x00,0x00,0x03,0xC0,0x00,0x04,0x60,0x00,0x0C,0x30,0x00,0x18,0x10,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x1C,0x18,0x00,0x0E,0x38,0x00,0x07,0xD8,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x07,0x00,0x00,0x0C,0x00,0x00,0x01,0xE0,0x00,0x02,0x30,0x00,0x06,0x18,0x00,0x0C,0x08,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0E,0x0C,0x00,0x07,0x1C,0x00,0x03,0xEC,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x03,0x80,0x00,0x06,0x00,0x00,0x00,0xF0,0x00,0x01,0x18,0x00,0x03,0x0C,0x00,0x06,0x04,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x07,0x06,0x00,0x03,0x8E,0x00,0x01,0xF6,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x01,0xC0,0x00,0x03,0x00,0x00,0x00,0x78,0x00,0x00,0x8C,0x00,0x01,0x86,0x00,0x03,0x02,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x83,0x00,0x01,0xC7,0x00,0x00,0xFB,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0xE0,0x00,0x01,0x80,0x00,0x00,0x3C,0x00,0x00,0x46,0x00,0x00,0xC3,0x00,0x01,0x81,0x00,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0xC1,0x80,0x00,0xE3,0x80,0x00,0x7D,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x70,0x00,0x00,0xC0,0x00, // '9'
+	0xC0,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80, // ':'
+	0xC0,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x70,0x00,0x70,0x00,0x10,0x00,0x20,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x38,0x00,0x38,0x00,0x08,0x00,0x10,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x1C,0x00,0x1C,0x00,0x04,0x00,0x08,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0E,0x00,0x0E,0x00,0x02,0x00,0x04,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x01,0x00,0x02,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x80,0x03,0x80,0x00,0x80,0x01,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0xC0,0x01,0xC0,0x00,0x40,0x00,0x80,0x01,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xE0,0x00,0xE0,0x00,0x20,0x00,0x40,0x00,0x80, // ';'
+	0x00,0x00,0x00,0x00,0x70,0x00,0x01,0xE0,0x00,0x07,0x80,0x00,0x1E,0x00,0x00,0x70,0x00,0x00,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0x70,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0xF0,0x00,0x03,0xC0,0x00,0x0F,0x00,0x00,0x38,0x00,0x00,0x60,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x38,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x78,0x00,0x01,0xE0,0x00,0x07,0x80,0x00,0x1C,0x00,0x00,0x30,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x1C,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x3C,0x00,0x00,0xF0,0x00,0x03,0xC0,0x00,0x0E,0x00,0x00,0x18,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x0E,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x1E,0x00,0x00,0x78,0x00,0x01,0xE0,0x00,0x07,0x00,0x00,0x0C,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x07,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0xF0,0x00,0x03,0x80,0x00,0x06,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x03,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0xC0,0x00,0x07,0x80,0x00,0x1E,0x00,0x00,0x78,0x00,0x01,0xC0,0x00,0x03,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x01,0xC0,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0xE0,0x00,0x03,0xC0,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0xE0,0x00,0x01,0x80,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x00,0xE0,0x00,0x00,0x20, // '<'
+	0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x00,0x7F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF8,0x00,0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x00,0x1F,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFE,0x00,0x0F,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0x00,0x07,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x80,0x03,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xC0,0x01,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xE0, // '='
+	0x80,0x00,0x00,0xE0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x30,0x00,0x00,0xE0,0x00,0x07,0x80,0x00,0x1E,0x00,0x00,0x78,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x70,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x18,0x00,0x00,0x70,0x00,0x03,0xC0,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x38,0x00,0x01,0xE0,0x00,0x07,0x80,0x00,0x1E,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x1C,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x1C,0x00,0x00,0xF0,0x00,0x03,0xC0,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x0E,0x00,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x03,0x00,0x00,0x0E,0x00,0x00,0x78,0x00,0x01,0xE0,0x00,0x07,0x80,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x07,0x00,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x01,0x80,0x00,0x07,0x00,0x00,0x3C,0x00,0x00,0xF0,0x00,0x03,0xC0,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x03,0x80,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0xC0,0x00,0x03,0x80,0x00,0x1E,0x00,0x00,0x78,0x00,0x01,0xE0,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0xC0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x60,0x00,0x01,0xC0,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0xF0,0x00,0x01,0xC0,0x00,0x00,0x00,0x00, // '>'
+	0x7C,0x00,0x86,0x00,0x83,0x00,0xC3,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x08,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3E,0x00,0x43,0x00,0x41,0x80,0x61,0x80,0x01,0x80,0x01,0x80,0x03,0x00,0x06,0x00,0x04,0x00,0x04,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1F,0x00,0x21,0x80,0x20,0xC0,0x30,0xC0,0x00,0xC0,0x00,0xC0,0x01,0x80,0x03,0x00,0x02,0x00,0x02,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0F,0x80,0x10,0xC0,0x10,0x60,0x18,0x60,0x00,0x60,0x00,0x60,0x00,0xC0,0x01,0x80,0x01,0x00,0x01,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0xC0,0x08,0x60,0x08,0x30,0x0C,0x30,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x00,0x80,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0xE0,0x04,0x30,0x04,0x18,0x06,0x18,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x40,0x00,0x40,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xF0,0x02,0x18,0x02,0x0C,0x03,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x20,0x00,0x20,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xF8,0x01,0x0C,0x01,0x06,0x01,0x86,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60, // '?'
+	0x03,0xF0,0x00,0x0C,0x0C,0x00,0x18,0x02,0x00,0x30,0x01,0x00,0x60,0xED,0x00,0x61,0x98,0x80,0xC3,0x18,0x80,0xC2,0x18,0x80,0xC6,0x18,0x80,0xC6,0x10,0x80,0xC6,0x31,0x00,0x66,0x32,0x00,0x63,0xDC,0x00,0x30,0x00,0x00,0x0C,0x04,0x00,0x03,0xF8,0x00,0x01,0xF8,0x00,0x06,0x06,0x00,0x0C,0x01,0x00,0x18,0x00,0x80,0x30,0x76,0x80,0x30,0xCC,0x40,0x61,0x8C,0x40,0x61,0x0C,0x40,0x63,0x0C,0x40,0x63,0x08,0x40,0x63,0x18,0x80,0x33,0x19,0x00,0x31,0xEE,0x00,0x18,0x00,0x00,0x06,0x02,0x00,0x01,0xFC,0x00,0x00,0xFC,0x00,0x03,0x03,0x00,0x06,0x00,0x80,0x0C,0x00,0x40,0x18,0x3B,0x40,0x18,0x66,0x20,0x30,0xC6,0x20,0x30,0x86,0x20,0x31,0x86,0x20,0x31,0x84,0x20,0x31,0x8C,0x40,0x19,0x8C,0x80,0x18,0xF7,0x00,0x0C,0x00,0x00,0x03,0x01,0x00,0x00,0xFE,0x00,0x00,0x7E,0x00,0x01,0x81,0x80,0x03,0x00,0x40,0x06,0x00,0x20,0x0C,0x1D,0xA0,0x0C,0x33,0x10,0x18,0x63,0x10,0x18,0x43,0x10,0x18,0xC3,0x10,0x18,0xC2,0x10,0x18,0xC6,0x20,0x0C,0xC6,0x40,0x0C,0x7B,0x80,0x06,0x00,0x00,0x01,0x80,0x80,0x00,0x7F,0x00,0x00,0x3F,0x00,0x00,0xC0,0xC0,0x01,0x80,0x20,0x03,0x00,0x10,0x06,0x0E,0xD0,0x06,0x19,0x88,0x0C,0x31,0x88,0x0C,0x21,0x88,0x0C,0x61,0x88,0x0C,0x61,0x08,0x0C,0x63,0x10,0x06,0x63,0x20,0x06,0x3D,0xC0,0x03,0x00,0x00,0x00,0xC0,0x40,0x00,0x3F,0x80,0x00,0x1F,0x80,0x00,0x60,0x60,0x00,0xC0,0x10,0x01,0x80,0x08,0x03,0x07,0x68,0x03,0x0C,0xC4,0x06,0x18,0xC4,0x06,0x10,0xC4,0x06,0x30,0xC4,0x06,0x30,0x84,0x06,0x31,0x88,0x03,0x31,0x90,0x03,0x1E,0xE0,0x01,0x80,0x00,0x00,0x60,0x20,0x00,0x1F,0xC0,0x00,0x0F,0xC0,0x00,0x30,0x30,0x00,0x60,0x08,0x00,0xC0,0x04,0x01,0x83,0xB4,0x01,0x86,0x62,0x03,0x0C,0x62,0x03,0x08,0x62,0x03,0x18,0x62,0x03,0x18,0x42,0x03,0x18,0xC4,0x01,0x98,0xC8,0x01,0x8F,0x70,0x00,0xC0,0x00,0x00,0x30,0x10,0x00,0x0F,0xE0,0x00,0x07,0xE0,0x00,0x18,0x18,0x00,0x30,0x04,0x00,0x60,0x02,0x00,0xC1,0xDA,0x00,0xC3,0x31,0x01,0x86,0x31,0x01,0x84,0x31,0x01,0x8C,0x31,0x01,0x8C,0x21,0x01,0x8C,0x62,0x00,0xCC,0x64,0x00,0xC7,0xB8,0x00,0x60,0x00,0x00,0x18,0x08,0x00,0x07,0xF0, // '@'
+	0x00,0x80,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x02,0xE0,0x00,0x02,0x60,0x00,0x06,0x70,0x00,0x04,0x30,0x00,0x04,0x38,0x00,0x08,0x18,0x00,0x0F,0xFC,0x00,0x18,0x1C,0x00,0x10,0x0E,0x00,0x30,0x0E,0x00,0x30,0x0F,0x00,0xF8,0x1F,0x80,0x00,0x40,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0x70,0x00,0x01,0x30,0x00,0x03,0x38,0x00,0x02,0x18,0x00,0x02,0x1C,0x00,0x04,0x0C,0x00,0x07,0xFE,0x00,0x0C,0x0E,0x00,0x08,0x07,0x00,0x18,0x07,0x00,0x18,0x07,0x80,0x7C,0x0F,0xC0,0x00,0x20,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xB8,0x00,0x00,0x98,0x00,0x01,0x9C,0x00,0x01,0x0C,0x00,0x01,0x0E,0x00,0x02,0x06,0x00,0x03,0xFF,0x00,0x06,0x07,0x00,0x04,0x03,0x80,0x0C,0x03,0x80,0x0C,0x03,0xC0,0x3E,0x07,0xE0,0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x5C,0x00,0x00,0x4C,0x00,0x00,0xCE,0x00,0x00,0x86,0x00,0x00,0x87,0x00,0x01,0x03,0x00,0x01,0xFF,0x80,0x03,0x03,0x80,0x02,0x01,0xC0,0x06,0x01,0xC0,0x06,0x01,0xE0,0x1F,0x03,0xF0,0x00,0x08,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x2E,0x00,0x00,0x26,0x00,0x00,0x67,0x00,0x00,0x43,0x00,0x00,0x43,0x80,0x00,0x81,0x80,0x00,0xFF,0xC0,0x01,0x81,0xC0,0x01,0x00,0xE0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x0F,0x81,0xF8,0x00,0x04,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x17,0x00,0x00,0x13,0x00,0x00,0x33,0x80,0x00,0x21,0x80,0x00,0x21,0xC0,0x00,0x40,0xC0,0x00,0x7F,0xE0,0x00,0xC0,0xE0,0x00,0x80,0x70,0x01,0x80,0x70,0x01,0x80,0x78,0x07,0xC0,0xFC,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0B,0x80,0x00,0x09,0x80,0x00,0x19,0xC0,0x00,0x10,0xC0,0x00,0x10,0xE0,0x00,0x20,0x60,0x00,0x3F,0xF0,0x00,0x60,0x70,0x00,0x40,0x38,0x00,0xC0,0x38,0x00,0xC0,0x3C,0x03,0xE0,0x7E,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0xC0,0x00,0x04,0xC0,0x00,0x0C,0xE0,0x00,0x08,0x60,0x00,0x08,0x70,0x00,0x10,0x30,0x00,0x1F,0xF8,0x00,0x30,0x38,0x00,0x20,0x1C,0x00,0x60,0x1C,0x00,0x60,0x1E,0x01,0xF0,0x3F, // 'A'
+	0xFF,0x80,0x00,0x30,0xC0,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0xC0,0x00,0x3F,0x00,0x00,0x30,0xE0,0x00,0x30,0x60,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x70,0x00,0x30,0xE0,0x00,0xFF,0xC0,0x00,0x7F,0xC0,0x00,0x18,0x60,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x60,0x00,0x1F,0x80,0x00,0x18,0x70,0x00,0x18,0x30,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x38,0x00,0x18,0x70,0x00,0x7F,0xE0,0x00,0x3F,0xE0,0x00,0x0C,0x30,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x30,0x00,0x0F,0xC0,0x00,0x0C,0x38,0x00,0x0C,0x18,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x1C,0x00,0x0C,0x38,0x00,0x3F,0xF0,0x00,0x1F,0xF0,0x00,0x06,0x18,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x18,0x00,0x07,0xE0,0x00,0x06,0x1C,0x00,0x06,0x0C,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0E,0x00,0x06,0x1C,0x00,0x1F,0xF8,0x00,0x0F,0xF8,0x00,0x03,0x0C,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x0C,0x00,0x03,0xF0,0x00,0x03,0x0E,0x00,0x03,0x06,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x07,0x00,0x03,0x0E,0x00,0x0F,0xFC,0x00,0x07,0xFC,0x00,0x01,0x86,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x86,0x00,0x01,0xF8,0x00,0x01,0x87,0x00,0x01,0x83,0x00,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x83,0x80,0x01,0x87,0x00,0x07,0xFE,0x00,0x03,0xFE,0x00,0x00,0xC3,0x00,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC3,0x00,0x00,0xFC,0x00,0x00,0xC3,0x80,0x00,0xC1,0x80,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC1,0xC0,0x00,0xC3,0x80,0x03,0xFF,0x00,0x01,0xFF,0x00,0x00,0x61,0x80,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x61,0x80,0x00,0x7E,0x00,0x00,0x61,0xC0,0x00,0x60,0xC0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0xE0,0x00,0x61,0xC0,0x01,0xFF,0x80, // 'B'
+	0x07,0xE2,0x00,0x1C,0x1E,0x00,0x30,0x0E,0x00,0x60,0x06,0x00,0x60,0x02,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x30,0x02,0x00,0x1C,0x0C,0x00,0x07,0xF0,0x00,0x03,0xF1,0x00,0x0E,0x0F,0x00,0x18,0x07,0x00,0x30,0x03,0x00,0x30,0x01,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x18,0x01,0x00,0x0E,0x06,0x00,0x03,0xF8,0x00,0x01,0xF8,0x80,0x07,0x07,0x80,0x0C,0x03,0x80,0x18,0x01,0x80,0x18,0x00,0x80,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x80,0x07,0x03,0x00,0x01,0xFC,0x00,0x00,0xFC,0x40,0x03,0x83,0xC0,0x06,0x01,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0x40,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x40,0x03,0x81,0x80,0x00,0xFE,0x00,0x00,0x7E,0x20,0x01,0xC1,0xE0,0x03,0x00,0xE0,0x06,0x00,0x60,0x06,0x00,0x20,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x20,0x01,0xC0,0xC0,0x00,0x7F,0x00,0x00,0x3F,0x10,0x00,0xE0,0xF0,0x01,0x80,0x70,0x03,0x00,0x30,0x03,0x00,0x10,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x01,0x80,0x10,0x00,0xE0,0x60,0x00,0x3F,0x80,0x00,0x1F,0x88,0x00,0x70,0x78,0x00,0xC0,0x38,0x01,0x80,0x18,0x01,0x80,0x08,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x00,0xC0,0x08,0x00,0x70,0x30,0x00,0x1F,0xC0,0x00,0x0F,0xC4,0x00,0x38,0x3C,0x00,0x60,0x1C,0x00,0xC0,0x0C,0x00,0xC0,0x04,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x60,0x04,0x00,0x38,0x18,0x00,0x0F,0xE0, // 'C'
+	0xFF,0xC0,0x00,0x30,0x78,0x00,0x30,0x1C,0x00,0x30,0x0E,0x00,0x30,0x06,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x0C,0x00,0x30,0x78,0x00,0xFF,0xC0,0x00,0x7F,0xE0,0x00,0x18,0x3C,0x00,0x18,0x0E,0x00,0x18,0x07,0x00,0x18,0x03,0x00,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x06,0x00,0x18,0x3C,0x00,0x7F,0xE0,0x00,0x3F,0xF0,0x00,0x0C,0x1E,0x00,0x0C,0x07,0x00,0x0C,0x03,0x80,0x0C,0x01,0x80,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x03,0x00,0x0C,0x1E,0x00,0x3F,0xF0,0x00,0x1F,0xF8,0x00,0x06,0x0F,0x00,0x06,0x03,0x80,0x06,0x01,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x01,0x80,0x06,0x0F,0x00,0x1F,0xF8,0x00,0x0F,0xFC,0x00,0x03,0x07,0x80,0x03,0x01,0xC0,0x03,0x00,0xE0,0x03,0x00,0x60,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0xC0,0x03,0x07,0x80,0x0F,0xFC,0x00,0x07,0xFE,0x00,0x01,0x83,0xC0,0x01,0x80,0xE0,0x01,0x80,0x70,0x01,0x80,0x30,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x60,0x01,0x83,0xC0,0x07,0xFE,0x00,0x03,0xFF,0x00,0x00,0xC1,0xE0,0x00,0xC0,0x70,0x00,0xC0,0x38,0x00,0xC0,0x18,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x30,0x00,0xC1,0xE0,0x03,0xFF,0x00,0x01,0xFF,0x80,0x00,0x60,0xF0,0x00,0x60,0x38,0x00,0x60,0x1C,0x00,0x60,0x0C,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x18,0x00,0x60,0xF0,0x01,0xFF,0x80, // 'D'
+	0xFF,0xFC,0x00,0x30,0x0C,0x00,0x30,0x04,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x10,0x00,0x30,0x30,0x00,0x3F,0xF0,0x00,0x30,0x30,0x00,0x30,0x10,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x08,0x00,0x30,0x08,0x00,0x30,0x38,0x00,0xFF,0xF8,0x00,0x7F,0xFE,0x00,0x18,0x06,0x00,0x18,0x02,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x08,0x00,0x18,0x18,0x00,0x1F,0xF8,0x00,0x18,0x18,0x00,0x18,0x08,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x04,0x00,0x18,0x04,0x00,0x18,0x1C,0x00,0x7F,0xFC,0x00,0x3F,0xFF,0x00,0x0C,0x03,0x00,0x0C,0x01,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x04,0x00,0x0C,0x0C,0x00,0x0F,0xFC,0x00,0x0C,0x0C,0x00,0x0C,0x04,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x02,0x00,0x0C,0x02,0x00,0x0C,0x0E,0x00,0x3F,0xFE,0x00,0x1F,0xFF,0x80,0x06,0x01,0x80,0x06,0x00,0x80,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x02,0x00,0x06,0x06,0x00,0x07,0xFE,0x00,0x06,0x06,0x00,0x06,0x02,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x01,0x00,0x06,0x01,0x00,0x06,0x07,0x00,0x1F,0xFF,0x00,0x0F,0xFF,0xC0,0x03,0x00,0xC0,0x03,0x00,0x40,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x01,0x00,0x03,0x03,0x00,0x03,0xFF,0x00,0x03,0x03,0x00,0x03,0x01,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x03,0x80,0x0F,0xFF,0x80,0x07,0xFF,0xE0,0x01,0x80,0x60,0x01,0x80,0x20,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x80,0x01,0x81,0x80,0x01,0xFF,0x80,0x01,0x81,0x80,0x01,0x80,0x80,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x40,0x01,0x80,0x40,0x01,0x81,0xC0,0x07,0xFF,0xC0,0x03,0xFF,0xF0,0x00,0xC0,0x30,0x00,0xC0,0x10,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x40,0x00,0xC0,0xC0,0x00,0xFF,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0x40,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x20,0x00,0xC0,0x20,0x00,0xC0,0xE0,0x03,0xFF,0xE0,0x01,0xFF,0xF8,0x00,0x60,0x18,0x00,0x60,0x08,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x20,0x00,0x60,0x60,0x00,0x7F,0xE0,0x00,0x60,0x60,0x00,0x60,0x20,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x10,0x00,0x60,0x10,0x00,0x60,0x70,0x01,0xFF,0xF0, // 'E'
+	0xFF,0xFC,0x00,0x30,0x0C,0x00,0x30,0x04,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x10,0x00,0x30,0x30,0x00,0x3F,0xF0,0x00,0x30,0x30,0x00,0x30,0x10,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x00,0x00,0x7F,0xFE,0x00,0x18,0x06,0x00,0x18,0x02,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x08,0x00,0x18,0x18,0x00,0x1F,0xF8,0x00,0x18,0x18,0x00,0x18,0x08,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7E,0x00,0x00,0x3F,0xFF,0x00,0x0C,0x03,0x00,0x0C,0x01,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x04,0x00,0x0C,0x0C,0x00,0x0F,0xFC,0x00,0x0C,0x0C,0x00,0x0C,0x04,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0x00,0x00,0x1F,0xFF,0x80,0x06,0x01,0x80,0x06,0x00,0x80,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x02,0x00,0x06,0x06,0x00,0x07,0xFE,0x00,0x06,0x06,0x00,0x06,0x02,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1F,0x80,0x00,0x0F,0xFF,0xC0,0x03,0x00,0xC0,0x03,0x00,0x40,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x01,0x00,0x03,0x03,0x00,0x03,0xFF,0x00,0x03,0x03,0x00,0x03,0x01,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0xC0,0x00,0x07,0xFF,0xE0,0x01,0x80,0x60,0x01,0x80,0x20,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x80,0x01,0x81,0x80,0x01,0xFF,0x80,0x01,0x81,0x80,0x01,0x80,0x80,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xE0,0x00,0x03,0xFF,0xF0,0x00,0xC0,0x30,0x00,0xC0,0x10,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x40,0x00,0xC0,0xC0,0x00,0xFF,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0x40,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x03,0xF0,0x00,0x01,0xFF,0xF8,0x00,0x60,0x18,0x00,0x60,0x08,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x20,0x00,0x60,0x60,0x00,0x7F,0xE0,0x00,0x60,0x60,0x00,0x60,0x20,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x01,0xF8,0x00, // 'F'
+	0x07,0xE4,0x00,0x1C,0x3C,0x00,0x30,0x0C,0x00,0x60,0x0C,0x00,0x60,0x04,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x3F,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x0C,0x00,0x1C,0x1C,0x00,0x07,0xE0,0x00,0x03,0xF2,0x00,0x0E,0x1E,0x00,0x18,0x06,0x00,0x30,0x06,0x00,0x30,0x02,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x1F,0x80,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x18,0x06,0x00,0x0E,0x0E,0x00,0x03,0xF0,0x00,0x01,0xF9,0x00,0x07,0x0F,0x00,0x0C,0x03,0x00,0x18,0x03,0x00,0x18,0x01,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x0F,0xC0,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x0C,0x03,0x00,0x07,0x07,0x00,0x01,0xF8,0x00,0x00,0xFC,0x80,0x03,0x87,0x80,0x06,0x01,0x80,0x0C,0x01,0x80,0x0C,0x00,0x80,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x07,0xE0,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x06,0x01,0x80,0x03,0x83,0x80,0x00,0xFC,0x00,0x00,0x7E,0x40,0x01,0xC3,0xC0,0x03,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x40,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x03,0xF0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x03,0x00,0xC0,0x01,0xC1,0xC0,0x00,0x7E,0x00,0x00,0x3F,0x20,0x00,0xE1,0xE0,0x01,0x80,0x60,0x03,0x00,0x60,0x03,0x00,0x20,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x01,0xF8,0x06,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x01,0x80,0x60,0x00,0xE0,0xE0,0x00,0x3F,0x00,0x00,0x1F,0x90,0x00,0x70,0xF0,0x00,0xC0,0x30,0x01,0x80,0x30,0x01,0x80,0x10,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0xFC,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x00,0xC0,0x30,0x00,0x70,0x70,0x00,0x1F,0x80,0x00,0x0F,0xC8,0x00,0x38,0x78,0x00,0x60,0x18,0x00,0xC0,0x18,0x00,0xC0,0x08,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x7E,0x01,0x80,0x18,0x01,0x80,0x18,0x01,0x80,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0x60,0x18,0x00,0x38,0x38,0x00,0x0F,0xC0, // 'G'
+	0xFC,0x3F,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x3F,0xFC,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0x30,0x0C,0x00,0xFC,0x3F,0x00,0x7E,0x1F,0x80,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x1F,0xFE,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x18,0x06,0x00,0x7E,0x1F,0x80,0x3F,0x0F,0xC0,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0F,0xFF,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x0C,0x03,0x00,0x3F,0x0F,0xC0,0x1F,0x87,0xE0,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x07,0xFF,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x06,0x01,0x80,0x1F,0x87,0xE0,0x0F,0xC3,0xF0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0xFF,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x0F,0xC3,0xF0,0x07,0xE1,0xF8,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0xFF,0xE0,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x01,0x80,0x60,0x07,0xE1,0xF8,0x03,0xF0,0xFC,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xFF,0xF0,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x00,0xC0,0x30,0x03,0xF0,0xFC,0x01,0xF8,0x7E,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x7F,0xF8,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x00,0x60,0x18,0x01,0xF8,0x7E, // 'H'
+	0xFC,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00,0x7E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00,0x3F,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0x00,0x1F,0x80,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x80,0x0F,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x03,0xF0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0xF0,0x01,0xF8,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x01,0xF8, // 'I'
+	0x3F,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xC8,0x00,0xF0,0x00,0x1F,0x80,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x64,0x00,0x78,0x00,0x0F,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x32,0x00,0x3C,0x00,0x07,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x19,0x00,0x1E,0x00,0x03,0xF0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x0C,0x80,0x0F,0x00,0x01,0xF8,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x06,0x40,0x07,0x80,0x00,0xFC,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x03,0x20,0x03,0xC0,0x00,0x7E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x01,0x90,0x01,0xE0, // 'J'
+	0xFC,0xFE,0x00,0x30,0x38,0x00,0x30,0x20,0x00,0x30,0x40,0x00,0x30,0x80,0x00,0x33,0x00,0x00,0x36,0x00,0x00,0x3E,0x00,0x00,0x37,0x00,0x00,0x33,0x80,0x00,0x31,0xC0,0x00,0x30,0xE0,0x00,0x30,0x70,0x00,0x30,0x38,0x00,0x30,0x3C,0x00,0xFC,0x7F,0x00,0x7E,0x7F,0x00,0x18,0x1C,0x00,0x18,0x10,0x00,0x18,0x20,0x00,0x18,0x40,0x00,0x19,0x80,0x00,0x1B,0x00,0x00,0x1F,0x00,0x00,0x1B,0x80,0x00,0x19,0xC0,0x00,0x18,0xE0,0x00,0x18,0x70,0x00,0x18,0x38,0x00,0x18,0x1C,0x00,0x18,0x1E,0x00,0x7E,0x3F,0x80,0x3F,0x3F,0x80,0x0C,0x0E,0x00,0x0C,0x08,0x00,0x0C,0x10,0x00,0x0C,0x20,0x00,0x0C,0xC0,0x00,0x0D,0x80,0x00,0x0F,0x80,0x00,0x0D,0xC0,0x00,0x0C,0xE0,0x00,0x0C,0x70,0x00,0x0C,0x38,0x00,0x0C,0x1C,0x00,0x0C,0x0E,0x00,0x0C,0x0F,0x00,0x3F,0x1F,0xC0,0x1F,0x9F,0xC0,0x06,0x07,0x00,0x06,0x04,0x00,0x06,0x08,0x00,0x06,0x10,0x00,0x06,0x60,0x00,0x06,0xC0,0x00,0x07,0xC0,0x00,0x06,0xE0,0x00,0x06,0x70,0x00,0x06,0x38,0x00,0x06,0x1C,0x00,0x06,0x0E,0x00,0x06,0x07,0x00,0x06,0x07,0x80,0x1F,0x8F,0xE0,0x0F,0xCF,0xE0,0x03,0x03,0x80,0x03,0x02,0x00,0x03,0x04,0x00,0x03,0x08,0x00,0x03,0x30,0x00,0x03,0x60,0x00,0x03,0xE0,0x00,0x03,0x70,0x00,0x03,0x38,0x00,0x03,0x1C,0x00,0x03,0x0E,0x00,0x03,0x07,0x00,0x03,0x03,0x80,0x03,0x03,0xC0,0x0F,0xC7,0xF0,0x07,0xE7,0xF0,0x01,0x81,0xC0,0x01,0x81,0x00,0x01,0x82,0x00,0x01,0x84,0x00,0x01,0x98,0x00,0x01,0xB0,0x00,0x01,0xF0,0x00,0x01,0xB8,0x00,0x01,0x9C,0x00,0x01,0x8E,0x00,0x01,0x87,0x00,0x01,0x83,0x80,0x01,0x81,0xC0,0x01,0x81,0xE0,0x07,0xE3,0xF8,0x03,0xF3,0xF8,0x00,0xC0,0xE0,0x00,0xC0,0x80,0x00,0xC1,0x00,0x00,0xC2,0x00,0x00,0xCC,0x00,0x00,0xD8,0x00,0x00,0xF8,0x00,0x00,0xDC,0x00,0x00,0xCE,0x00,0x00,0xC7,0x00,0x00,0xC3,0x80,0x00,0xC1,0xC0,0x00,0xC0,0xE0,0x00,0xC0,0xF0,0x03,0xF1,0xFC,0x01,0xF9,0xFC,0x00,0x60,0x70,0x00,0x60,0x40,0x00,0x60,0x80,0x00,0x61,0x00,0x00,0x66,0x00,0x00,0x6C,0x00,0x00,0x7C,0x00,0x00,0x6E,0x00,0x00,0x67,0x00,0x00,0x63,0x80,0x00,0x61,0xC0,0x00,0x60,0xE0,0x00,0x60,0x70,0x00,0x60,0x78,0x01,0xF8,0xFE, // 'K'
+	0xFC,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x02,0x00,0x30,0x04,0x00,0x30,0x1C,0x00,0xFF,0xFC,0x00,0x7E,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x01,0x00,0x18,0x02,0x00,0x18,0x0E,0x00,0x7F,0xFE,0x00,0x3F,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x80,0x0C,0x01,0x00,0x0C,0x07,0x00,0x3F,0xFF,0x00,0x1F,0x80,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x40,0x06,0x00,0x80,0x06,0x03,0x80,0x1F,0xFF,0x80,0x0F,0xC0,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x20,0x03,0x00,0x40,0x03,0x01,0xC0,0x0F,0xFF,0xC0,0x07,0xE0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x10,0x01,0x80,0x20,0x01,0x80,0xE0,0x07,0xFF,0xE0,0x03,0xF0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x08,0x00,0xC0,0x10,0x00,0xC0,0x70,0x03,0xFF,0xF0,0x01,0xF8,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x04,0x00,0x60,0x08,0x00,0x60,0x38,0x01,0xFF,0xF8, // 'L'
+	0xF8,0x01,0xE0,0x00,0x38,0x03,0x80,0x00,0x38,0x03,0x80,0x00,0x3C,0x07,0x80,0x00,0x2C,0x05,0x80,0x00,0x2E,0x0D,0x80,0x00,0x26,0x09,0x80,0x00,0x27,0x09,0x80,0x00,0x27,0x11,0x80,0x00,0x23,0x91,0x80,0x00,0x23,0xB1,0x80,0x00,0x21,0xA1,0x80,0x00,0x21,0xE1,0x80,0x00,0x20,0xC1,0x80,0x00,0x70,0xC1,0x80,0x00,0xF8,0x87,0xE0,0x00,0x7C,0x00,0xF0,0x00,0x1C,0x01,0xC0,0x00,0x1C,0x01,0xC0,0x00,0x1E,0x03,0xC0,0x00,0x16,0x02,0xC0,0x00,0x17,0x06,0xC0,0x00,0x13,0x04,0xC0,0x00,0x13,0x84,0xC0,0x00,0x13,0x88,0xC0,0x00,0x11,0xC8,0xC0,0x00,0x11,0xD8,0xC0,0x00,0x10,0xD0,0xC0,0x00,0x10,0xF0,0xC0,0x00,0x10,0x60,0xC0,0x00,0x38,0x60,0xC0,0x00,0x7C,0x43,0xF0,0x00,0x3E,0x00,0x78,0x00,0x0E,0x00,0xE0,0x00,0x0E,0x00,0xE0,0x00,0x0F,0x01,0xE0,0x00,0x0B,0x01,0x60,0x00,0x0B,0x83,0x60,0x00,0x09,0x82,0x60,0x00,0x09,0xC2,0x60,0x00,0x09,0xC4,0x60,0x00,0x08,0xE4,0x60,0x00,0x08,0xEC,0x60,0x00,0x08,0x68,0x60,0x00,0x08,0x78,0x60,0x00,0x08,0x30,0x60,0x00,0x1C,0x30,0x60,0x00,0x3E,0x21,0xF8,0x00,0x1F,0x00,0x3C,0x00,0x07,0x00,0x70,0x00,0x07,0x00,0x70,0x00,0x07,0x80,0xF0,0x00,0x05,0x80,0xB0,0x00,0x05,0xC1,0xB0,0x00,0x04,0xC1,0x30,0x00,0x04,0xE1,0x30,0x00,0x04,0xE2,0x30,0x00,0x04,0x72,0x30,0x00,0x04,0x76,0x30,0x00,0x04,0x34,0x30,0x00,0x04,0x3C,0x30,0x00,0x04,0x18,0x30,0x00,0x0E,0x18,0x30,0x00,0x1F,0x10,0xFC,0x00,0x0F,0x80,0x1E,0x00,0x03,0x80,0x38,0x00,0x03,0x80,0x38,0x00,0x03,0xC0,0x78,0x00,0x02,0xC0,0x58,0x00,0x02,0xE0,0xD8,0x00,0x02,0x60,0x98,0x00,0x02,0x70,0x98,0x00,0x02,0x71,0x18,0x00,0x02,0x39,0x18,0x00,0x02,0x3B,0x18,0x00,0x02,0x1A,0x18,0x00,0x02,0x1E,0x18,0x00,0x02,0x0C,0x18,0x00,0x07,0x0C,0x18,0x00,0x0F,0x88,0x7E,0x00,0x07,0xC0,0x0F,0x00,0x01,0xC0,0x1C,0x00,0x01,0xC0,0x1C,0x00,0x01,0xE0,0x3C,0x00,0x01,0x60,0x2C,0x00,0x01,0x70,0x6C,0x00,0x01,0x30,0x4C,0x00,0x01,0x38,0x4C,0x00,0x01,0x38,0x8C,0x00,0x01,0x1C,0x8C,0x00,0x01,0x1D,0x8C,0x00,0x01,0x0D,0x0C,0x00,0x01,0x0F,0x0C,0x00,0x01,0x06,0x0C,0x00,0x03,0x86,0x0C,0x00,0x07,0xC4,0x3F,0x00,0x03,0xE0,0x07,0x80,0x00,0xE0,0x0E,0x00,0x00,0xE0,0x0E,0x00,0x00,0xF0,0x1E,0x00,0x00,0xB0,0x16,0x00,0x00,0xB8,0x36,0x00,0x00,0x98,0x26,0x00,0x00,0x9C,0x26,0x00,0x00,0x9C,0x46,0x00,0x00,0x8E,0x46,0x00,0x00,0x8E,0xC6,0x00,0x00,0x86,0x86,0x00,0x00,0x87,0x86,0x00,0x00,0x83,0x06,0x00,0x01,0xC3,0x06,0x00,0x03,0xE2,0x1F,0x80,0x01,0xF0,0x03,0xC0,0x00,0x70,0x07,0x00,0x00,0x70,0x07,0x00,0x00,0x78,0x0F,0x00,0x00,0x58,0x0B,0x00,0x00,0x5C,0x1B,0x00,0x00,0x4C,0x13,0x00,0x00,0x4E,0x13,0x00,0x00,0x4E,0x23,0x00,0x00,0x47,0x23,0x00,0x00,0x47,0x63,0x00,0x00,0x43,0x43,0x00,0x00,0x43,0xC3,0x00,0x00,0x41,0x83,0x00,0x00,0xE1,0x83,0x00,0x01,0xF1,0x0F,0xC0, // 'M'
+	0xF0,0x1F,0x00,0x78,0x0E,0x00,0x3C,0x04,0x00,0x3E,0x04,0x00,0x2E,0x04,0x00,0x27,0x04,0x00,0x23,0x84,0x00,0x23,0xC4,0x00,0x21,0xE4,0x00,0x20,0xE4,0x00,0x20,0x74,0x00,0x20,0x3C,0x00,0x20,0x1C,0x00,0x20,0x0C,0x00,0x70,0x0C,0x00,0xF8,0x04,0x00,0x78,0x0F,0x80,0x3C,0x07,0x00,0x1E,0x02,0x00,0x1F,0x02,0x00,0x17,0x02,0x00,0x13,0x82,0x00,0x11,0xC2,0x00,0x11,0xE2,0x00,0x10,0xF2,0x00,0x10,0x72,0x00,0x10,0x3A,0x00,0x10,0x1E,0x00,0x10,0x0E,0x00,0x10,0x06,0x00,0x38,0x06,0x00,0x7C,0x02,0x00,0x3C,0x07,0xC0,0x1E,0x03,0x80,0x0F,0x01,0x00,0x0F,0x81,0x00,0x0B,0x81,0x00,0x09,0xC1,0x00,0x08,0xE1,0x00,0x08,0xF1,0x00,0x08,0x79,0x00,0x08,0x39,0x00,0x08,0x1D,0x00,0x08,0x0F,0x00,0x08,0x07,0x00,0x08,0x03,0x00,0x1C,0x03,0x00,0x3E,0x01,0x00,0x1E,0x03,0xE0,0x0F,0x01,0xC0,0x07,0x80,0x80,0x07,0xC0,0x80,0x05,0xC0,0x80,0x04,0xE0,0x80,0x04,0x70,0x80,0x04,0x78,0x80,0x04,0x3C,0x80,0x04,0x1C,0x80,0x04,0x0E,0x80,0x04,0x07,0x80,0x04,0x03,0x80,0x04,0x01,0x80,0x0E,0x01,0x80,0x1F,0x00,0x80,0x0F,0x01,0xF0,0x07,0x80,0xE0,0x03,0xC0,0x40,0x03,0xE0,0x40,0x02,0xE0,0x40,0x02,0x70,0x40,0x02,0x38,0x40,0x02,0x3C,0x40,0x02,0x1E,0x40,0x02,0x0E,0x40,0x02,0x07,0x40,0x02,0x03,0xC0,0x02,0x01,0xC0,0x02,0x00,0xC0,0x07,0x00,0xC0,0x0F,0x80,0x40,0x07,0x80,0xF8,0x03,0xC0,0x70,0x01,0xE0,0x20,0x01,0xF0,0x20,0x01,0x70,0x20,0x01,0x38,0x20,0x01,0x1C,0x20,0x01,0x1E,0x20,0x01,0x0F,0x20,0x01,0x07,0x20,0x01,0x03,0xA0,0x01,0x01,0xE0,0x01,0x00,0xE0,0x01,0x00,0x60,0x03,0x80,0x60,0x07,0xC0,0x20,0x03,0xC0,0x7C,0x01,0xE0,0x38,0x00,0xF0,0x10,0x00,0xF8,0x10,0x00,0xB8,0x10,0x00,0x9C,0x10,0x00,0x8E,0x10,0x00,0x8F,0x10,0x00,0x87,0x90,0x00,0x83,0x90,0x00,0x81,0xD0,0x00,0x80,0xF0,0x00,0x80,0x70,0x00,0x80,0x30,0x01,0xC0,0x30,0x03,0xE0,0x10,0x01,0xE0,0x3E,0x00,0xF0,0x1C,0x00,0x78,0x08,0x00,0x7C,0x08,0x00,0x5C,0x08,0x00,0x4E,0x08,0x00,0x47,0x08,0x00,0x47,0x88,0x00,0x43,0xC8,0x00,0x41,0xC8,0x00,0x40,0xE8,0x00,0x40,0x78,0x00,0x40,0x38,0x00,0x40,0x18,0x00,0xE0,0x18,0x01,0xF0,0x08, // 'N'
+	0x07,0xC0,0x00,0x18,0x30,0x00,0x30,0x18,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x18,0x00,0x18,0x30,0x00,0x07,0xC0,0x00,0x03,0xE0,0x00,0x0C,0x18,0x00,0x18,0x0C,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x18,0x0C,0x00,0x0C,0x18,0x00,0x03,0xE0,0x00,0x01,0xF0,0x00,0x06,0x0C,0x00,0x0C,0x06,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x18,0x03,0x00,0x18,0x03,0x00,0x0C,0x06,0x00,0x06,0x0C,0x00,0x01,0xF0,0x00,0x00,0xF8,0x00,0x03,0x06,0x00,0x06,0x03,0x00,0x0C,0x01,0x80,0x0C,0x01,0x80,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x0C,0x01,0x80,0x0C,0x01,0x80,0x06,0x03,0x00,0x03,0x06,0x00,0x00,0xF8,0x00,0x00,0x7C,0x00,0x01,0x83,0x00,0x03,0x01,0x80,0x06,0x00,0xC0,0x06,0x00,0xC0,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x06,0x00,0xC0,0x06,0x00,0xC0,0x03,0x01,0x80,0x01,0x83,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0xC1,0x80,0x01,0x80,0xC0,0x03,0x00,0x60,0x03,0x00,0x60,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x03,0x00,0x60,0x03,0x00,0x60,0x01,0x80,0xC0,0x00,0xC1,0x80,0x00,0x3E,0x00,0x00,0x1F,0x00,0x00,0x60,0xC0,0x00,0xC0,0x60,0x01,0x80,0x30,0x01,0x80,0x30,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x01,0x80,0x30,0x01,0x80,0x30,0x00,0xC0,0x60,0x00,0x60,0xC0,0x00,0x1F,0x00,0x00,0x0F,0x80,0x00,0x30,0x60,0x00,0x60,0x30,0x00,0xC0,0x18,0x00,0xC0,0x18,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0x60,0x30,0x00,0x30,0x60,0x00,0x0F,0x80, // 'O'
+	0xFF,0x80,0x00,0x30,0xE0,0x00,0x30,0x70,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x60,0x00,0x30,0xE0,0x00,0x3F,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x00,0x00,0x7F,0xC0,0x00,0x18,0x70,0x00,0x18,0x38,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x30,0x00,0x18,0x70,0x00,0x1F,0xC0,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7E,0x00,0x00,0x3F,0xE0,0x00,0x0C,0x38,0x00,0x0C,0x1C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x18,0x00,0x0C,0x38,0x00,0x0F,0xE0,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0x00,0x00,0x1F,0xF0,0x00,0x06,0x1C,0x00,0x06,0x0E,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0C,0x00,0x06,0x1C,0x00,0x07,0xF0,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1F,0x80,0x00,0x0F,0xF8,0x00,0x03,0x0E,0x00,0x03,0x07,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x06,0x00,0x03,0x0E,0x00,0x03,0xF8,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0xC0,0x00,0x07,0xFC,0x00,0x01,0x87,0x00,0x01,0x83,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x83,0x00,0x01,0x87,0x00,0x01,0xFC,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xE0,0x00,0x03,0xFE,0x00,0x00,0xC3,0x80,0x00,0xC1,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC1,0x80,0x00,0xC3,0x80,0x00,0xFE,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x03,0xF0,0x00,0x01,0xFF,0x00,0x00,0x61,0xC0,0x00,0x60,0xE0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0xC0,0x00,0x61,0xC0,0x00,0x7F,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x01,0xF8,0x00, // 'P'
+	0x0F,0xE0,0x00,0x18,0x30,0x00,0x30,0x18,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x30,0x18,0x00,0x18,0x30,0x00,0x07,0xC0,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x1F,0x00,0x07,0xF0,0x00,0x0C,0x18,0x00,0x18,0x0C,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x60,0x03,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x18,0x0C,0x00,0x0C,0x18,0x00,0x03,0xE0,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x00,0x3C,0x00,0x00,0x0F,0x80,0x03,0xF8,0x00,0x06,0x0C,0x00,0x0C,0x06,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x30,0x01,0x80,0x18,0x03,0x00,0x18,0x03,0x00,0x0C,0x06,0x00,0x06,0x0C,0x00,0x01,0xF0,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0x00,0x07,0xC0,0x01,0xFC,0x00,0x03,0x06,0x00,0x06,0x03,0x00,0x0C,0x01,0x80,0x0C,0x01,0x80,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0xC0,0x0C,0x01,0x80,0x0C,0x01,0x80,0x06,0x03,0x00,0x03,0x06,0x00,0x00,0xF8,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x0F,0x00,0x00,0x03,0xE0,0x00,0xFE,0x00,0x01,0x83,0x00,0x03,0x01,0x80,0x06,0x00,0xC0,0x06,0x00,0xC0,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x0C,0x00,0x60,0x06,0x00,0xC0,0x06,0x00,0xC0,0x03,0x01,0x80,0x01,0x83,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x07,0x80,0x00,0x01,0xF0,0x00,0x7F,0x00,0x00,0xC1,0x80,0x01,0x80,0xC0,0x03,0x00,0x60,0x03,0x00,0x60,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x06,0x00,0x30,0x03,0x00,0x60,0x03,0x00,0x60,0x01,0x80,0xC0,0x00,0xC1,0x80,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x03,0xC0,0x00,0x00,0xF8,0x00,0x3F,0x80,0x00,0x60,0xC0,0x00,0xC0,0x60,0x01,0x80,0x30,0x01,0x80,0x30,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x03,0x00,0x18,0x01,0x80,0x30,0x01,0x80,0x30,0x00,0xC0,0x60,0x00,0x60,0xC0,0x00,0x1F,0x00,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x7C,0x00,0x1F,0xC0,0x00,0x30,0x60,0x00,0x60,0x30,0x00,0xC0,0x18,0x00,0xC0,0x18,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x01,0x80,0x0C,0x00,0xC0,0x18,0x00,0xC0,0x18,0x00,0x60,0x30,0x00,0x30,0x60,0x00,0x0F,0x80,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x00,0xF0,0x00,0x00,0x3E, // 'Q'
+	0xFF,0x80,0x00,0x30,0xE0,0x00,0x30,0x70,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x70,0x00,0x30,0xE0,0x00,0x3F,0x80,0x00,0x33,0x80,0x00,0x31,0xC0,0x00,0x31,0xE0,0x00,0x30,0xF0,0x00,0x30,0x70,0x00,0x30,0x38,0x00,0xFC,0x1E,0x00,0x7F,0xC0,0x00,0x18,0x70,0x00,0x18,0x38,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x38,0x00,0x18,0x70,0x00,0x1F,0xC0,0x00,0x19,0xC0,0x00,0x18,0xE0,0x00,0x18,0xF0,0x00,0x18,0x78,0x00,0x18,0x38,0x00,0x18,0x1C,0x00,0x7E,0x0F,0x00,0x3F,0xE0,0x00,0x0C,0x38,0x00,0x0C,0x1C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x1C,0x00,0x0C,0x38,0x00,0x0F,0xE0,0x00,0x0C,0xE0,0x00,0x0C,0x70,0x00,0x0C,0x78,0x00,0x0C,0x3C,0x00,0x0C,0x1C,0x00,0x0C,0x0E,0x00,0x3F,0x07,0x80,0x1F,0xF0,0x00,0x06,0x1C,0x00,0x06,0x0E,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x0E,0x00,0x06,0x1C,0x00,0x07,0xF0,0x00,0x06,0x70,0x00,0x06,0x38,0x00,0x06,0x3C,0x00,0x06,0x1E,0x00,0x06,0x0E,0x00,0x06,0x07,0x00,0x1F,0x83,0xC0,0x0F,0xF8,0x00,0x03,0x0E,0x00,0x03,0x07,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x07,0x00,0x03,0x0E,0x00,0x03,0xF8,0x00,0x03,0x38,0x00,0x03,0x1C,0x00,0x03,0x1E,0x00,0x03,0x0F,0x00,0x03,0x07,0x00,0x03,0x03,0x80,0x0F,0xC1,0xE0,0x07,0xFC,0x00,0x01,0x87,0x00,0x01,0x83,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x83,0x80,0x01,0x87,0x00,0x01,0xFC,0x00,0x01,0x9C,0x00,0x01,0x8E,0x00,0x01,0x8F,0x00,0x01,0x87,0x80,0x01,0x83,0x80,0x01,0x81,0xC0,0x07,0xE0,0xF0,0x03,0xFE,0x00,0x00,0xC3,0x80,0x00,0xC1,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC1,0xC0,0x00,0xC3,0x80,0x00,0xFE,0x00,0x00,0xCE,0x00,0x00,0xC7,0x00,0x00,0xC7,0x80,0x00,0xC3,0xC0,0x00,0xC1,0xC0,0x00,0xC0,0xE0,0x03,0xF0,0x78,0x01,0xFF,0x00,0x00,0x61,0xC0,0x00,0x60,0xE0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0xE0,0x00,0x61,0xC0,0x00,0x7F,0x00,0x00,0x67,0x00,0x00,0x63,0x80,0x00,0x63,0xC0,0x00,0x61,0xE0,0x00,0x60,0xE0,0x00,0x60,0x70,0x01,0xF8,0x3C, // 'R'
+	0x1F,0x40,0x00,0x30,0xC0,0x00,0x60,0x40,0x00,0x60,0x40,0x00,0x70,0x20,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x1F,0x00,0x00,0x07,0xC0,0x00,0x01,0xC0,0x00,0x00,0xE0,0x00,0x80,0x60,0x00,0x40,0x60,0x00,0x40,0x60,0x00,0x70,0xC0,0x00,0x4F,0x80,0x00,0x0F,0xA0,0x00,0x18,0x60,0x00,0x30,0x20,0x00,0x30,0x20,0x00,0x38,0x10,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x0F,0x80,0x00,0x03,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x40,0x30,0x00,0x20,0x30,0x00,0x20,0x30,0x00,0x38,0x60,0x00,0x27,0xC0,0x00,0x07,0xD0,0x00,0x0C,0x30,0x00,0x18,0x10,0x00,0x18,0x10,0x00,0x1C,0x08,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x07,0xC0,0x00,0x01,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x20,0x18,0x00,0x10,0x18,0x00,0x10,0x18,0x00,0x1C,0x30,0x00,0x13,0xE0,0x00,0x03,0xE8,0x00,0x06,0x18,0x00,0x0C,0x08,0x00,0x0C,0x08,0x00,0x0E,0x04,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x03,0xE0,0x00,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x10,0x0C,0x00,0x08,0x0C,0x00,0x08,0x0C,0x00,0x0E,0x18,0x00,0x09,0xF0,0x00,0x01,0xF4,0x00,0x03,0x0C,0x00,0x06,0x04,0x00,0x06,0x04,0x00,0x07,0x02,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x01,0xF0,0x00,0x00,0x7C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x08,0x06,0x00,0x04,0x06,0x00,0x04,0x06,0x00,0x07,0x0C,0x00,0x04,0xF8,0x00,0x00,0xFA,0x00,0x01,0x86,0x00,0x03,0x02,0x00,0x03,0x02,0x00,0x03,0x81,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF8,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x04,0x03,0x00,0x02,0x03,0x00,0x02,0x03,0x00,0x03,0x86,0x00,0x02,0x7C,0x00,0x00,0x7D,0x00,0x00,0xC3,0x00,0x01,0x81,0x00,0x01,0x81,0x00,0x01,0xC0,0x80,0x01,0xE0,0x00,0x00,0xF0,0x00,0x00,0x7C,0x00,0x00,0x1F,0x00,0x00,0x07,0x00,0x00,0x03,0x80,0x02,0x01,0x80,0x01,0x01,0x80,0x01,0x01,0x80,0x01,0xC3,0x00,0x01,0x3E,0x00,0x00,0x3E,0x80,0x00,0x61,0x80,0x00,0xC0,0x80,0x00,0xC0,0x80,0x00,0xE0,0x40,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x3E,0x00,0x00,0x0F,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x01,0x00,0xC0,0x00,0x80,0xC0,0x00,0x80,0xC0,0x00,0xE1,0x80,0x00,0x9F,0x00, // 'S'
+	0xFF,0xFE,0x00,0xC3,0x06,0x00,0x83,0x06,0x00,0x83,0x02,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0xC0,0x00,0x7F,0xFF,0x00,0x61,0x83,0x00,0x41,0x83,0x00,0x41,0x81,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xE0,0x00,0x3F,0xFF,0x80,0x30,0xC1,0x80,0x20,0xC1,0x80,0x20,0xC0,0x80,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x03,0xF0,0x00,0x1F,0xFF,0xC0,0x18,0x60,0xC0,0x10,0x60,0xC0,0x10,0x60,0x40,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x01,0xF8,0x00,0x0F,0xFF,0xE0,0x0C,0x30,0x60,0x08,0x30,0x60,0x08,0x30,0x20,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x00,0x07,0xFF,0xF0,0x06,0x18,0x30,0x04,0x18,0x30,0x04,0x18,0x10,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7E,0x00,0x03,0xFF,0xF8,0x03,0x0C,0x18,0x02,0x0C,0x18,0x02,0x0C,0x08,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0x00,0x01,0xFF,0xFC,0x01,0x86,0x0C,0x01,0x06,0x0C,0x01,0x06,0x04,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1F,0x80, // 'T'
+	0xFC,0x1F,0x00,0x30,0x0E,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x30,0x04,0x00,0x18,0x08,0x00,0x1C,0x18,0x00,0x07,0xE0,0x00,0x7E,0x0F,0x80,0x18,0x07,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x18,0x02,0x00,0x0C,0x04,0x00,0x0E,0x0C,0x00,0x03,0xF0,0x00,0x3F,0x07,0xC0,0x0C,0x03,0x80,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x0C,0x01,0x00,0x06,0x02,0x00,0x07,0x06,0x00,0x01,0xF8,0x00,0x1F,0x83,0xE0,0x06,0x01,0xC0,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x06,0x00,0x80,0x03,0x01,0x00,0x03,0x83,0x00,0x00,0xFC,0x00,0x0F,0xC1,0xF0,0x03,0x00,0xE0,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x03,0x00,0x40,0x01,0x80,0x80,0x01,0xC1,0x80,0x00,0x7E,0x00,0x07,0xE0,0xF8,0x01,0x80,0x70,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x01,0x80,0x20,0x00,0xC0,0x40,0x00,0xE0,0xC0,0x00,0x3F,0x00,0x03,0xF0,0x7C,0x00,0xC0,0x38,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0xC0,0x10,0x00,0x60,0x20,0x00,0x70,0x60,0x00,0x1F,0x80,0x01,0xF8,0x3E,0x00,0x60,0x1C,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x60,0x08,0x00,0x30,0x10,0x00,0x38,0x30,0x00,0x0F,0xC0, // 'U'
+	0xFE,0x0F,0x80,0x38,0x06,0x00,0x38,0x06,0x00,0x18,0x04,0x00,0x1C,0x04,0x00,0x0C,0x08,0x00,0x0E,0x08,0x00,0x06,0x18,0x00,0x07,0x10,0x00,0x03,0x30,0x00,0x03,0xA0,0x00,0x01,0xA0,0x00,0x01,0xE0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x7F,0x07,0xC0,0x1C,0x03,0x00,0x1C,0x03,0x00,0x0C,0x02,0x00,0x0E,0x02,0x00,0x06,0x04,0x00,0x07,0x04,0x00,0x03,0x0C,0x00,0x03,0x88,0x00,0x01,0x98,0x00,0x01,0xD0,0x00,0x00,0xD0,0x00,0x00,0xF0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x3F,0x83,0xE0,0x0E,0x01,0x80,0x0E,0x01,0x80,0x06,0x01,0x00,0x07,0x01,0x00,0x03,0x02,0x00,0x03,0x82,0x00,0x01,0x86,0x00,0x01,0xC4,0x00,0x00,0xCC,0x00,0x00,0xE8,0x00,0x00,0x68,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x1F,0xC1,0xF0,0x07,0x00,0xC0,0x07,0x00,0xC0,0x03,0x00,0x80,0x03,0x80,0x80,0x01,0x81,0x00,0x01,0xC1,0x00,0x00,0xC3,0x00,0x00,0xE2,0x00,0x00,0x66,0x00,0x00,0x74,0x00,0x00,0x34,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x0F,0xE0,0xF8,0x03,0x80,0x60,0x03,0x80,0x60,0x01,0x80,0x40,0x01,0xC0,0x40,0x00,0xC0,0x80,0x00,0xE0,0x80,0x00,0x61,0x80,0x00,0x71,0x00,0x00,0x33,0x00,0x00,0x3A,0x00,0x00,0x1A,0x00,0x00,0x1E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x08,0x00,0x07,0xF0,0x7C,0x01,0xC0,0x30,0x01,0xC0,0x30,0x00,0xC0,0x20,0x00,0xE0,0x20,0x00,0x60,0x40,0x00,0x70,0x40,0x00,0x30,0xC0,0x00,0x38,0x80,0x00,0x19,0x80,0x00,0x1D,0x00,0x00,0x0D,0x00,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x03,0xF8,0x3E,0x00,0xE0,0x18,0x00,0xE0,0x18,0x00,0x60,0x10,0x00,0x70,0x10,0x00,0x30,0x20,0x00,0x38,0x20,0x00,0x18,0x60,0x00,0x1C,0x40,0x00,0x0C,0xC0,0x00,0x0E,0x80,0x00,0x06,0x80,0x00,0x07,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x01,0xFC,0x1F,0x00,0x70,0x0C,0x00,0x70,0x0C,0x00,0x30,0x08,0x00,0x38,0x08,0x00,0x18,0x10,0x00,0x1C,0x10,0x00,0x0C,0x30,0x00,0x0E,0x20,0x00,0x06,0x60,0x00,0x07,0x40,0x00,0x03,0x40,0x00,0x03,0xC0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x00, // 'V'
+	0xFC,0xFC,0x3C,0x00,0x78,0x70,0x18,0x00,0x38,0x30,0x18,0x00,0x18,0x38,0x10,0x00,0x1C,0x18,0x10,0x00,0x1C,0x1C,0x20,0x00,0x0C,0x3C,0x20,0x00,0x0E,0x2C,0x20,0x00,0x06,0x6E,0x40,0x00,0x07,0x46,0x40,0x00,0x07,0x47,0x80,0x00,0x03,0x87,0x80,0x00,0x03,0x83,0x80,0x00,0x03,0x83,0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x01,0x00,0x00,0x7E,0x7E,0x1E,0x00,0x3C,0x38,0x0C,0x00,0x1C,0x18,0x0C,0x00,0x0C,0x1C,0x08,0x00,0x0E,0x0C,0x08,0x00,0x0E,0x0E,0x10,0x00,0x06,0x1E,0x10,0x00,0x07,0x16,0x10,0x00,0x03,0x37,0x20,0x00,0x03,0xA3,0x20,0x00,0x03,0xA3,0xC0,0x00,0x01,0xC3,0xC0,0x00,0x01,0xC1,0xC0,0x00,0x01,0xC1,0x80,0x00,0x00,0x80,0x80,0x00,0x00,0x80,0x80,0x00,0x3F,0x3F,0x0F,0x00,0x1E,0x1C,0x06,0x00,0x0E,0x0C,0x06,0x00,0x06,0x0E,0x04,0x00,0x07,0x06,0x04,0x00,0x07,0x07,0x08,0x00,0x03,0x0F,0x08,0x00,0x03,0x8B,0x08,0x00,0x01,0x9B,0x90,0x00,0x01,0xD1,0x90,0x00,0x01,0xD1,0xE0,0x00,0x00,0xE1,0xE0,0x00,0x00,0xE0,0xE0,0x00,0x00,0xE0,0xC0,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x1F,0x9F,0x87,0x80,0x0F,0x0E,0x03,0x00,0x07,0x06,0x03,0x00,0x03,0x07,0x02,0x00,0x03,0x83,0x02,0x00,0x03,0x83,0x84,0x00,0x01,0x87,0x84,0x00,0x01,0xC5,0x84,0x00,0x00,0xCD,0xC8,0x00,0x00,0xE8,0xC8,0x00,0x00,0xE8,0xF0,0x00,0x00,0x70,0xF0,0x00,0x00,0x70,0x70,0x00,0x00,0x70,0x60,0x00,0x00,0x20,0x20,0x00,0x00,0x20,0x20,0x00,0x0F,0xCF,0xC3,0xC0,0x07,0x87,0x01,0x80,0x03,0x83,0x01,0x80,0x01,0x83,0x81,0x00,0x01,0xC1,0x81,0x00,0x01,0xC1,0xC2,0x00,0x00,0xC3,0xC2,0x00,0x00,0xE2,0xC2,0x00,0x00,0x66,0xE4,0x00,0x00,0x74,0x64,0x00,0x00,0x74,0x78,0x00,0x00,0x38,0x78,0x00,0x00,0x38,0x38,0x00,0x00,0x38,0x30,0x00,0x00,0x10,0x10,0x00,0x00,0x10,0x10,0x00,0x07,0xE7,0xE1,0xE0,0x03,0xC3,0x80,0xC0,0x01,0xC1,0x80,0xC0,0x00,0xC1,0xC0,0x80,0x00,0xE0,0xC0,0x80,0x00,0xE0,0xE1,0x00,0x00,0x61,0xE1,0x00,0x00,0x71,0x61,0x00,0x00,0x33,0x72,0x00,0x00,0x3A,0x32,0x00,0x00,0x3A,0x3C,0x00,0x00,0x1C,0x3C,0x00,0x00,0x1C,0x1C,0x00,0x00,0x1C,0x18,0x00,0x00,0x08,0x08,0x00,0x00,0x08,0x08,0x00,0x03,0xF3,0xF0,0xF0,0x01,0xE1,0xC0,0x60,0x00,0xE0,0xC0,0x60,0x00,0x60,0xE0,0x40,0x00,0x70,0x60,0x40,0x00,0x70,0x70,0x80,0x00,0x30,0xF0,0x80,0x00,0x38,0xB0,0x80,0x00,0x19,0xB9,0x00,0x00,0x1D,0x19,0x00,0x00,0x1D,0x1E,0x00,0x00,0x0E,0x1E,0x00,0x00,0x0E,0x0E,0x00,0x00,0x0E,0x0C,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x01,0xF9,0xF8,0x78,0x00,0xF0,0xE0,0x30,0x00,0x70,0x60,0x30,0x00,0x30,0x70,0x20,0x00,0x38,0x30,0x20,0x00,0x38,0x38,0x40,0x00,0x18,0x78,0x40,0x00,0x1C,0x58,0x40,0x00,0x0C,0xDC,0x80,0x00,0x0E,0x8C,0x80,0x00,0x0E,0x8F,0x00,0x00,0x07,0x0F,0x00,0x00,0x07,0x07,0x00,0x00,0x07,0x06,0x00,0x00,0x02,0x02,0x00,0x00,0x02,0x02,0x00, // 'W'
+	0x7F,0x1F,0x80,0x3C,0x06,0x00,0x1C,0x0C,0x00,0x0E,0x18,0x00,0x07,0x10,0x00,0x03,0x20,0x00,0x03,0xC0,0x00,0x01,0xC0,0x00,0x01,0xE0,0x00,0x03,0x60,0x00,0x06,0x70,0x00,0x04,0x38,0x00,0x08,0x1C,0x00,0x10,0x1C,0x00,0x30,0x1E,0x00,0xFC,0x3F,0x80,0x3F,0x8F,0xC0,0x1E,0x03,0x00,0x0E,0x06,0x00,0x07,0x0C,0x00,0x03,0x88,0x00,0x01,0x90,0x00,0x01,0xE0,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0x01,0xB0,0x00,0x03,0x38,0x00,0x02,0x1C,0x00,0x04,0x0E,0x00,0x08,0x0E,0x00,0x18,0x0F,0x00,0x7E,0x1F,0xC0,0x1F,0xC7,0xE0,0x0F,0x01,0x80,0x07,0x03,0x00,0x03,0x86,0x00,0x01,0xC4,0x00,0x00,0xC8,0x00,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0xD8,0x00,0x01,0x9C,0x00,0x01,0x0E,0x00,0x02,0x07,0x00,0x04,0x07,0x00,0x0C,0x07,0x80,0x3F,0x0F,0xE0,0x0F,0xE3,0xF0,0x07,0x80,0xC0,0x03,0x81,0x80,0x01,0xC3,0x00,0x00,0xE2,0x00,0x00,0x64,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x6C,0x00,0x00,0xCE,0x00,0x00,0x87,0x00,0x01,0x03,0x80,0x02,0x03,0x80,0x06,0x03,0xC0,0x1F,0x87,0xF0,0x07,0xF1,0xF8,0x03,0xC0,0x60,0x01,0xC0,0xC0,0x00,0xE1,0x80,0x00,0x71,0x00,0x00,0x32,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x36,0x00,0x00,0x67,0x00,0x00,0x43,0x80,0x00,0x81,0xC0,0x01,0x01,0xC0,0x03,0x01,0xE0,0x0F,0xC3,0xF8,0x03,0xF8,0xFC,0x01,0xE0,0x30,0x00,0xE0,0x60,0x00,0x70,0xC0,0x00,0x38,0x80,0x00,0x19,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x00,0x1B,0x00,0x00,0x33,0x80,0x00,0x21,0xC0,0x00,0x40,0xE0,0x00,0x80,0xE0,0x01,0x80,0xF0,0x07,0xE1,0xFC,0x01,0xFC,0x7E,0x00,0xF0,0x18,0x00,0x70,0x30,0x00,0x38,0x60,0x00,0x1C,0x40,0x00,0x0C,0x80,0x00,0x0F,0x00,0x00,0x07,0x00,0x00,0x07,0x80,0x00,0x0D,0x80,0x00,0x19,0xC0,0x00,0x10,0xE0,0x00,0x20,0x70,0x00,0x40,0x70,0x00,0xC0,0x78,0x03,0xF0,0xFE,0x00,0xFE,0x3F,0x00,0x78,0x0C,0x00,0x38,0x18,0x00,0x1C,0x30,0x00,0x0E,0x20,0x00,0x06,0x40,0x00,0x07,0x80,0x00,0x03,0x80,0x00,0x03,0xC0,0x00,0x06,0xC0,0x00,0x0C,0xE0,0x00,0x08,0x70,0x00,0x10,0x38,0x00,0x20,0x38,0x00,0x60,0x3C,0x01,0xF8,0x7F, // 'X'
+	0xFE,0x1F,0x00,0x78,0x0C,0x00,0x38,0x08,0x00,0x1C,0x18,0x00,0x0E,0x10,0x00,0x06,0x20,0x00,0x07,0x60,0x00,0x03,0xC0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xE0,0x00,0x7F,0x0F,0x80,0x3C,0x06,0x00,0x1C,0x04,0x00,0x0E,0x0C,0x00,0x07,0x08,0x00,0x03,0x10,0x00,0x03,0xB0,0x00,0x01,0xE0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x03,0xF0,0x00,0x3F,0x87,0xC0,0x1E,0x03,0x00,0x0E,0x02,0x00,0x07,0x06,0x00,0x03,0x84,0x00,0x01,0x88,0x00,0x01,0xD8,0x00,0x00,0xF0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x01,0xF8,0x00,0x1F,0xC3,0xE0,0x0F,0x01,0x80,0x07,0x01,0x00,0x03,0x83,0x00,0x01,0xC2,0x00,0x00,0xC4,0x00,0x00,0xEC,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x00,0x0F,0xE1,0xF0,0x07,0x80,0xC0,0x03,0x80,0x80,0x01,0xC1,0x80,0x00,0xE1,0x00,0x00,0x62,0x00,0x00,0x76,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7E,0x00,0x07,0xF0,0xF8,0x03,0xC0,0x60,0x01,0xC0,0x40,0x00,0xE0,0xC0,0x00,0x70,0x80,0x00,0x31,0x00,0x00,0x3B,0x00,0x00,0x1E,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0x00,0x03,0xF8,0x7C,0x01,0xE0,0x30,0x00,0xE0,0x20,0x00,0x70,0x60,0x00,0x38,0x40,0x00,0x18,0x80,0x00,0x1D,0x80,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1F,0x80,0x01,0xFC,0x3E,0x00,0xF0,0x18,0x00,0x70,0x10,0x00,0x38,0x30,0x00,0x1C,0x20,0x00,0x0C,0x40,0x00,0x0E,0xC0,0x00,0x07,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0xC0, // 'Y'
+	0x7F,0xF8,0x00,0xC0,0x30,0x00,0x80,0x70,0x00,0x80,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x04,0x00,0x70,0x0C,0x00,0xE0,0x18,0x00,0xFF,0xF8,0x00,0x3F,0xFC,0x00,0x60,0x18,0x00,0x40,0x38,0x00,0x40,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x02,0x00,0x38,0x06,0x00,0x70,0x0C,0x00,0x7F,0xFC,0x00,0x1F,0xFE,0x00,0x30,0x0C,0x00,0x20,0x1C,0x00,0x20,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x01,0x00,0x1C,0x03,0x00,0x38,0x06,0x00,0x3F,0xFE,0x00,0x0F,0xFF,0x00,0x18,0x06,0x00,0x10,0x0E,0x00,0x10,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x0E,0x01,0x80,0x1C,0x03,0x00,0x1F,0xFF,0x00,0x07,0xFF,0x80,0x0C,0x03,0x00,0x08,0x07,0x00,0x08,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x40,0x07,0x00,0xC0,0x0E,0x01,0x80,0x0F,0xFF,0x80,0x03,0xFF,0xC0,0x06,0x01,0x80,0x04,0x03,0x80,0x04,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x20,0x03,0x80,0x60,0x07,0x00,0xC0,0x07,0xFF,0xC0,0x01,0xFF,0xE0,0x03,0x00,0xC0,0x02,0x01,0xC0,0x02,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x10,0x01,0xC0,0x30,0x03,0x80,0x60,0x03,0xFF,0xE0,0x00,0xFF,0xF0,0x01,0x80,0x60,0x01,0x00,0xE0,0x01,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x08,0x00,0xE0,0x18,0x01,0xC0,0x30,0x01,0xFF,0xF0, // 'Z'
+	0xF8,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xF8,0x00,0x7C,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x7C,0x00,0x3E,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x3E,0x00,0x1F,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1F,0x00,0x0F,0x80,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0F,0x80,0x07,0xC0,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0xC0,0x03,0xE0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0xE0,0x01,0xF0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xF0, // '['
+	0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x0C,0x00,0x0C,0x00,0x04,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x60,0x06,0x00,0x06,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x03,0x00,0x03,0x00,0x01,0x00,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x18,0x01,0x80,0x01,0x80,0x00,0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x20,0x00,0x30,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x0C, // 0x5C
+	0xF8,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0xF8,0x00,0x7C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x7C,0x00,0x3E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x3E,0x00,0x1F,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x1F,0x00,0x0F,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x0F,0x80,0x07,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x07,0xC0,0x03,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x03,0xE0,0x01,0xF0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x01,0xF0, // ']'
+	0x0C,0x00,0x00,0x1C,0x00,0x00,0x16,0x00,0x00,0x36,0x00,0x00,0x23,0x00,0x00,0x63,0x00,0x00,0x41,0x80,0x00,0xC1,0x80,0x00,0x80,0xC0,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0B,0x00,0x00,0x1B,0x00,0x00,0x11,0x80,0x00,0x31,0x80,0x00,0x20,0xC0,0x00,0x60,0xC0,0x00,0x40,0x60,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x05,0x80,0x00,0x0D,0x80,0x00,0x08,0xC0,0x00,0x18,0xC0,0x00,0x10,0x60,0x00,0x30,0x60,0x00,0x20,0x30,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x02,0xC0,0x00,0x06,0xC0,0x00,0x04,0x60,0x00,0x0C,0x60,0x00,0x08,0x30,0x00,0x18,0x30,0x00,0x10,0x18,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0x60,0x00,0x03,0x60,0x00,0x02,0x30,0x00,0x06,0x30,0x00,0x04,0x18,0x00,0x0C,0x18,0x00,0x08,0x0C,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xB0,0x00,0x01,0xB0,0x00,0x01,0x18,0x00,0x03,0x18,0x00,0x02,0x0C,0x00,0x06,0x0C,0x00,0x04,0x06,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x58,0x00,0x00,0xD8,0x00,0x00,0x8C,0x00,0x01,0x8C,0x00,0x01,0x06,0x00,0x03,0x06,0x00,0x02,0x03,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x2C,0x00,0x00,0x6C,0x00,0x00,0x46,0x00,0x00,0xC6,0x00,0x00,0x83,0x00,0x01,0x83,0x00,0x01,0x01,0x80, // '^'
+	0xFF,0xF0,0x00,0x7F,0xF8,0x00,0x3F,0xFC,0x00,0x1F,0xFE,0x00,0x0F,0xFF,0x00,0x07,0xFF,0x80,0x03,0xFF,0xC0,0x01,0xFF,0xE0, // '_'
+	0xC0,0x00,0xE0,0x00,0x30,0x00,0x18,0x00,0x60,0x00,0x70,0x00,0x18,0x00,0x0C,0x00,0x30,0x00,0x38,0x00,0x0C,0x00,0x06,0x00,0x18,0x00,0x1C,0x00,0x06,0x00,0x03,0x00,0x0C,0x00,0x0E,0x00,0x03,0x00,0x01,0x80,0x06,0x00,0x07,0x00,0x01,0x80,0x00,0xC0,0x03,0x00,0x03,0x80,0x00,0xC0,0x00,0x60,0x01,0x80,0x01,0xC0,0x00,0x60,0x00,0x30, // '`'
+	0x3E,0x00,0x00,0xC6,0x00,0x00,0xC3,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x1F,0x00,0x00,0x63,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC7,0x00,0x00,0x7B,0x80,0x00,0x1F,0x00,0x00,0x63,0x00,0x00,0x61,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x0F,0x80,0x00,0x31,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x63,0x80,0x00,0x3D,0xC0,0x00,0x0F,0x80,0x00,0x31,0x80,0x00,0x30,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x07,0xC0,0x00,0x18,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x31,0xC0,0x00,0x1E,0xE0,0x00,0x07,0xC0,0x00,0x18,0xC0,0x00,0x18,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x03,0xE0,0x00,0x0C,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0xE0,0x00,0x0F,0x70,0x00,0x03,0xE0,0x00,0x0C,0x60,0x00,0x0C,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x01,0xF0,0x00,0x06,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x70,0x00,0x07,0xB8,0x00,0x01,0xF0,0x00,0x06,0x30,0x00,0x06,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0xF8,0x00,0x03,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x38,0x00,0x03,0xDC,0x00,0x00,0xF8,0x00,0x03,0x18,0x00,0x03,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x7C,0x00,0x01,0x8C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x1C,0x00,0x01,0xEE,0x00,0x00,0x7C,0x00,0x01,0x8C,0x00,0x01,0x86,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x3E,0x00,0x00,0xC6,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x8E,0x00,0x00,0xF7,0x00, // 'a'
+	0x20,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x6F,0x00,0x00,0x71,0x80,0x00,0x61,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0x80,0x00,0x61,0x80,0x00,0x61,0x00,0x00,0x3E,0x00,0x00,0x10,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x37,0x80,0x00,0x38,0xC0,0x00,0x30,0xE0,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x40,0x00,0x30,0xC0,0x00,0x30,0x80,0x00,0x1F,0x00,0x00,0x08,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1B,0xC0,0x00,0x1C,0x60,0x00,0x18,0x70,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x20,0x00,0x18,0x60,0x00,0x18,0x40,0x00,0x0F,0x80,0x00,0x04,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0D,0xE0,0x00,0x0E,0x30,0x00,0x0C,0x38,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x10,0x00,0x0C,0x30,0x00,0x0C,0x20,0x00,0x07,0xC0,0x00,0x02,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0xF0,0x00,0x07,0x18,0x00,0x06,0x1C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x08,0x00,0x06,0x18,0x00,0x06,0x10,0x00,0x03,0xE0,0x00,0x01,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x78,0x00,0x03,0x8C,0x00,0x03,0x0E,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x04,0x00,0x03,0x0C,0x00,0x03,0x08,0x00,0x01,0xF0,0x00,0x00,0x80,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xBC,0x00,0x01,0xC6,0x00,0x01,0x87,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x82,0x00,0x01,0x86,0x00,0x01,0x84,0x00,0x00,0xF8,0x00,0x00,0x40,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xDE,0x00,0x00,0xE3,0x00,0x00,0xC3,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x00,0x00,0xC3,0x00,0x00,0xC2,0x00,0x00,0x7C,0x00, // 'b'
+	0x1E,0x00,0x23,0x00,0x63,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xE1,0x00,0x72,0x00,0x3C,0x00,0x0F,0x00,0x11,0x80,0x31,0x80,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x70,0x80,0x39,0x00,0x1E,0x00,0x07,0x80,0x08,0xC0,0x18,0xC0,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x38,0x40,0x1C,0x80,0x0F,0x00,0x03,0xC0,0x04,0x60,0x0C,0x60,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x1C,0x20,0x0E,0x40,0x07,0x80,0x01,0xE0,0x02,0x30,0x06,0x30,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0E,0x10,0x07,0x20,0x03,0xC0,0x00,0xF0,0x01,0x18,0x03,0x18,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x08,0x03,0x90,0x01,0xE0,0x00,0x78,0x00,0x8C,0x01,0x8C,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x84,0x01,0xC8,0x00,0xF0,0x00,0x3C,0x00,0x46,0x00,0xC6,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0xC2,0x00,0xE4,0x00,0x78, // 'c'
+	0x00,0x80,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x1D,0x80,0x00,0x23,0x80,0x00,0x61,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xE1,0x80,0x00,0x73,0x80,0x00,0x3D,0xC0,0x00,0x00,0x40,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x0E,0xC0,0x00,0x11,0xC0,0x00,0x30,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x70,0xC0,0x00,0x39,0xC0,0x00,0x1E,0xE0,0x00,0x00,0x20,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x07,0x60,0x00,0x08,0xE0,0x00,0x18,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x38,0x60,0x00,0x1C,0xE0,0x00,0x0F,0x70,0x00,0x00,0x10,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x03,0xB0,0x00,0x04,0x70,0x00,0x0C,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x1C,0x30,0x00,0x0E,0x70,0x00,0x07,0xB8,0x00,0x00,0x08,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x01,0xD8,0x00,0x02,0x38,0x00,0x06,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0E,0x18,0x00,0x07,0x38,0x00,0x03,0xDC,0x00,0x00,0x04,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0xEC,0x00,0x01,0x1C,0x00,0x03,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x07,0x0C,0x00,0x03,0x9C,0x00,0x01,0xEE,0x00,0x00,0x02,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x76,0x00,0x00,0x8E,0x00,0x01,0x86,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x86,0x00,0x01,0xCE,0x00,0x00,0xF7,0x00,0x00,0x01,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x3B,0x00,0x00,0x47,0x00,0x00,0xC3,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0xC3,0x00,0x00,0xE7,0x00,0x00,0x7B,0x80, // 'd'
+	0x1E,0x00,0x00,0x23,0x80,0x00,0x41,0x80,0x00,0xFF,0x80,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xE0,0x40,0x00,0x60,0x80,0x00,0x71,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x11,0xC0,0x00,0x20,0xC0,0x00,0x7F,0xC0,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x20,0x00,0x30,0x40,0x00,0x38,0x80,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x08,0xE0,0x00,0x10,0x60,0x00,0x3F,0xE0,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x38,0x10,0x00,0x18,0x20,0x00,0x1C,0x40,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x04,0x70,0x00,0x08,0x30,0x00,0x1F,0xF0,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x08,0x00,0x0C,0x10,0x00,0x0E,0x20,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x02,0x38,0x00,0x04,0x18,0x00,0x0F,0xF8,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0E,0x04,0x00,0x06,0x08,0x00,0x07,0x10,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x01,0x1C,0x00,0x02,0x0C,0x00,0x07,0xFC,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x07,0x02,0x00,0x03,0x04,0x00,0x03,0x88,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x8E,0x00,0x01,0x06,0x00,0x03,0xFE,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x81,0x00,0x01,0x82,0x00,0x01,0xC4,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x47,0x00,0x00,0x83,0x00,0x01,0xFF,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xC0,0x80,0x00,0xC1,0x00,0x00,0xE2,0x00,0x00,0x3C,0x00, // 'e'
+	0x0F,0x00,0x11,0x80,0x10,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x7C,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xFC,0x00,0x07,0x80,0x08,0xC0,0x08,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x3E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7E,0x00,0x03,0xC0,0x04,0x60,0x04,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x1F,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0x00,0x01,0xE0,0x02,0x30,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x0F,0x80,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x80,0x00,0xF0,0x01,0x18,0x01,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x07,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0xC0,0x00,0x78,0x00,0x8C,0x00,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xE0,0x00,0x3C,0x00,0x46,0x00,0x40,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x01,0xF0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0xF0,0x00,0x1E,0x00,0x23,0x00,0x20,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xF8,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x01,0xF8, // 'f'
+	0x1F,0x00,0x00,0x31,0xF0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x31,0x80,0x00,0x1F,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x7F,0xC0,0x00,0x40,0x20,0x00,0x40,0x20,0x00,0xC0,0x20,0x00,0xC0,0x40,0x00,0xE0,0x80,0x00,0x3F,0x00,0x00,0x0F,0x80,0x00,0x18,0xF8,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x18,0xC0,0x00,0x0F,0x80,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x3F,0xE0,0x00,0x20,0x10,0x00,0x20,0x10,0x00,0x60,0x10,0x00,0x60,0x20,0x00,0x70,0x40,0x00,0x1F,0x80,0x00,0x07,0xC0,0x00,0x0C,0x7C,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x0C,0x60,0x00,0x07,0xC0,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x1F,0xF0,0x00,0x10,0x08,0x00,0x10,0x08,0x00,0x30,0x08,0x00,0x30,0x10,0x00,0x38,0x20,0x00,0x0F,0xC0,0x00,0x03,0xE0,0x00,0x06,0x3E,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x06,0x30,0x00,0x03,0xE0,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x0F,0xF8,0x00,0x08,0x04,0x00,0x08,0x04,0x00,0x18,0x04,0x00,0x18,0x08,0x00,0x1C,0x10,0x00,0x07,0xE0,0x00,0x01,0xF0,0x00,0x03,0x1F,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x03,0x18,0x00,0x01,0xF0,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x07,0xFC,0x00,0x04,0x02,0x00,0x04,0x02,0x00,0x0C,0x02,0x00,0x0C,0x04,0x00,0x0E,0x08,0x00,0x03,0xF0,0x00,0x00,0xF8,0x00,0x01,0x8F,0x80,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x01,0x8C,0x00,0x00,0xF8,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x03,0xFE,0x00,0x02,0x01,0x00,0x02,0x01,0x00,0x06,0x01,0x00,0x06,0x02,0x00,0x07,0x04,0x00,0x01,0xF8,0x00,0x00,0x7C,0x00,0x00,0xC7,0xC0,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x00,0xC6,0x00,0x00,0x7C,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x01,0xFF,0x00,0x01,0x00,0x80,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x01,0x00,0x03,0x82,0x00,0x00,0xFC,0x00,0x00,0x3E,0x00,0x00,0x63,0xE0,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0x63,0x00,0x00,0x3E,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0xFF,0x80,0x00,0x80,0x40,0x00,0x80,0x40,0x01,0x80,0x40,0x01,0x80,0x80,0x01,0xC1,0x00,0x00,0x7E,0x00, // 'g'
+	0x30,0x00,0x00,0xF0,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x37,0x80,0x00,0x39,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x79,0xE0,0x00,0x18,0x00,0x00,0x78,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1B,0xC0,0x00,0x1C,0xE0,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x3C,0xF0,0x00,0x0C,0x00,0x00,0x3C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0D,0xE0,0x00,0x0E,0x70,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x1E,0x78,0x00,0x06,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0xF0,0x00,0x07,0x38,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x0F,0x3C,0x00,0x03,0x00,0x00,0x0F,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x78,0x00,0x03,0x9C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x07,0x9E,0x00,0x01,0x80,0x00,0x07,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0xBC,0x00,0x01,0xCE,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x03,0xCF,0x00,0x00,0xC0,0x00,0x03,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xDE,0x00,0x00,0xE7,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x01,0xE7,0x80,0x00,0x60,0x00,0x01,0xE0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x6F,0x00,0x00,0x73,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0xF3,0xC0, // 'h'
+	0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xF8,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7C,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3E,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0xE0,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x01,0xF0, // 'i'
+	0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xC8,0x00,0xF0,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x64,0x00,0x78,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x32,0x00,0x3C,0x00,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x19,0x00,0x1E,0x00,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x0C,0x80,0x0F,0x00,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x06,0x40,0x07,0x80,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x03,0x20,0x03,0xC0,0x00,0x18,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x01,0x90,0x01,0xE0, // 'j'
+	0x20,0x00,0x00,0xE0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x63,0xE0,0x00,0x61,0x00,0x00,0x62,0x00,0x00,0x64,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x00,0x6E,0x00,0x00,0x67,0x00,0x00,0x63,0x00,0x00,0x61,0xC0,0x00,0xF3,0xE0,0x00,0x10,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x31,0xF0,0x00,0x30,0x80,0x00,0x31,0x00,0x00,0x32,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0x00,0x37,0x00,0x00,0x33,0x80,0x00,0x31,0x80,0x00,0x30,0xE0,0x00,0x79,0xF0,0x00,0x08,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0xF8,0x00,0x18,0x40,0x00,0x18,0x80,0x00,0x19,0x00,0x00,0x1E,0x00,0x00,0x1F,0x00,0x00,0x1B,0x80,0x00,0x19,0xC0,0x00,0x18,0xC0,0x00,0x18,0x70,0x00,0x3C,0xF8,0x00,0x04,0x00,0x00,0x1C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x7C,0x00,0x0C,0x20,0x00,0x0C,0x40,0x00,0x0C,0x80,0x00,0x0F,0x00,0x00,0x0F,0x80,0x00,0x0D,0xC0,0x00,0x0C,0xE0,0x00,0x0C,0x60,0x00,0x0C,0x38,0x00,0x1E,0x7C,0x00,0x02,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x3E,0x00,0x06,0x10,0x00,0x06,0x20,0x00,0x06,0x40,0x00,0x07,0x80,0x00,0x07,0xC0,0x00,0x06,0xE0,0x00,0x06,0x70,0x00,0x06,0x30,0x00,0x06,0x1C,0x00,0x0F,0x3E,0x00,0x01,0x00,0x00,0x07,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x1F,0x00,0x03,0x08,0x00,0x03,0x10,0x00,0x03,0x20,0x00,0x03,0xC0,0x00,0x03,0xE0,0x00,0x03,0x70,0x00,0x03,0x38,0x00,0x03,0x18,0x00,0x03,0x0E,0x00,0x07,0x9F,0x00,0x00,0x80,0x00,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x8F,0x80,0x01,0x84,0x00,0x01,0x88,0x00,0x01,0x90,0x00,0x01,0xE0,0x00,0x01,0xF0,0x00,0x01,0xB8,0x00,0x01,0x9C,0x00,0x01,0x8C,0x00,0x01,0x87,0x00,0x03,0xCF,0x80,0x00,0x40,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC7,0xC0,0x00,0xC2,0x00,0x00,0xC4,0x00,0x00,0xC8,0x00,0x00,0xF0,0x00,0x00,0xF8,0x00,0x00,0xDC,0x00,0x00,0xCE,0x00,0x00,0xC6,0x00,0x00,0xC3,0x80,0x01,0xE7,0xC0, // 'k'
+	0x10,0x00,0x70,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xF8,0x00,0x08,0x00,0x38,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x7C,0x00,0x04,0x00,0x1C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3E,0x00,0x02,0x00,0x0E,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x1F,0x00,0x01,0x00,0x07,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0F,0x80,0x00,0x80,0x03,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x07,0xC0,0x00,0x40,0x01,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0xE0,0x00,0x20,0x00,0xE0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x01,0xF0, // 'l'
+	0xF7,0x8F,0x00,0x00,0x38,0xF3,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x30,0xC1,0x80,0x00,0x79,0xE3,0xC0,0x00,0x7B,0xC7,0x80,0x00,0x1C,0x79,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x18,0x60,0xC0,0x00,0x3C,0xF1,0xE0,0x00,0x3D,0xE3,0xC0,0x00,0x0E,0x3C,0xE0,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x0C,0x30,0x60,0x00,0x1E,0x78,0xF0,0x00,0x1E,0xF1,0xE0,0x00,0x07,0x1E,0x70,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x06,0x18,0x30,0x00,0x0F,0x3C,0x78,0x00,0x0F,0x78,0xF0,0x00,0x03,0x8F,0x38,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x03,0x0C,0x18,0x00,0x07,0x9E,0x3C,0x00,0x07,0xBC,0x78,0x00,0x01,0xC7,0x9C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x01,0x86,0x0C,0x00,0x03,0xCF,0x1E,0x00,0x03,0xDE,0x3C,0x00,0x00,0xE3,0xCE,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x00,0xC3,0x06,0x00,0x01,0xE7,0x8F,0x00,0x01,0xEF,0x1E,0x00,0x00,0x71,0xE7,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0x61,0x83,0x00,0x00,0xF3,0xC7,0x80, // 'm'
+	0xF7,0x80,0x00,0x38,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x79,0xE0,0x00,0x7B,0xC0,0x00,0x1C,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x3C,0xF0,0x00,0x3D,0xE0,0x00,0x0E,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x1E,0x78,0x00,0x1E,0xF0,0x00,0x07,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x0F,0x3C,0x00,0x0F,0x78,0x00,0x03,0x8C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x07,0x9E,0x00,0x07,0xBC,0x00,0x01,0xC6,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x03,0xCF,0x00,0x03,0xDE,0x00,0x00,0xE3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x01,0xE7,0x80,0x01,0xEF,0x00,0x00,0x71,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0xF3,0xC0, // 'n'
+	0x1E,0x00,0x00,0x63,0x80,0x00,0x41,0x80,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0xC0,0xC0,0x00,0x60,0x80,0x00,0x71,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x31,0xC0,0x00,0x20,0xC0,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x60,0x60,0x00,0x30,0x40,0x00,0x38,0x80,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x18,0xE0,0x00,0x10,0x60,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x30,0x30,0x00,0x18,0x20,0x00,0x1C,0x40,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x0C,0x70,0x00,0x08,0x30,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x18,0x18,0x00,0x0C,0x10,0x00,0x0E,0x20,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x06,0x38,0x00,0x04,0x18,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x06,0x08,0x00,0x07,0x10,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00,0x03,0x1C,0x00,0x02,0x0C,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x06,0x06,0x00,0x03,0x04,0x00,0x03,0x88,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x01,0x8E,0x00,0x01,0x06,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x03,0x03,0x00,0x01,0x82,0x00,0x01,0xC4,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0xC7,0x00,0x00,0x83,0x00,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x01,0x81,0x80,0x00,0xC1,0x00,0x00,0xE2,0x00,0x00,0x3C,0x00, // 'o'
+	0x77,0x80,0x00,0x38,0xC0,0x00,0x30,0xE0,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0xC0,0x00,0x38,0x80,0x00,0x37,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x00,0x00,0x3B,0xC0,0x00,0x1C,0x60,0x00,0x18,0x70,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x60,0x00,0x1C,0x40,0x00,0x1B,0x80,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7E,0x00,0x00,0x1D,0xE0,0x00,0x0E,0x30,0x00,0x0C,0x38,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x30,0x00,0x0E,0x20,0x00,0x0D,0xC0,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3F,0x00,0x00,0x0E,0xF0,0x00,0x07,0x18,0x00,0x06,0x1C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x18,0x00,0x07,0x10,0x00,0x06,0xE0,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1F,0x80,0x00,0x07,0x78,0x00,0x03,0x8C,0x00,0x03,0x0E,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x0C,0x00,0x03,0x88,0x00,0x03,0x70,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0xC0,0x00,0x03,0xBC,0x00,0x01,0xC6,0x00,0x01,0x87,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x86,0x00,0x01,0xC4,0x00,0x01,0xB8,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xE0,0x00,0x01,0xDE,0x00,0x00,0xE3,0x00,0x00,0xC3,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC3,0x00,0x00,0xE2,0x00,0x00,0xDC,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x03,0xF0,0x00,0x00,0xEF,0x00,0x00,0x71,0x80,0x00,0x61,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x61,0x80,0x00,0x71,0x00,0x00,0x6E,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x01,0xF8,0x00, // 'p'
+	0x1E,0x80,0x00,0x33,0x80,0x00,0x61,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xC1,0x80,0x00,0xE1,0x80,0x00,0x63,0x80,0x00,0x3D,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xC0,0x00,0x0F,0x40,0x00,0x19,0xC0,0x00,0x30,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x60,0xC0,0x00,0x70,0xC0,0x00,0x31,0xC0,0x00,0x1E,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x03,0xE0,0x00,0x07,0xA0,0x00,0x0C,0xE0,0x00,0x18,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x30,0x60,0x00,0x38,0x60,0x00,0x18,0xE0,0x00,0x0F,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x01,0xF0,0x00,0x03,0xD0,0x00,0x06,0x70,0x00,0x0C,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x18,0x30,0x00,0x1C,0x30,0x00,0x0C,0x70,0x00,0x07,0xB0,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xF8,0x00,0x01,0xE8,0x00,0x03,0x38,0x00,0x06,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0C,0x18,0x00,0x0E,0x18,0x00,0x06,0x38,0x00,0x03,0xD8,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x7C,0x00,0x00,0xF4,0x00,0x01,0x9C,0x00,0x03,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x06,0x0C,0x00,0x07,0x0C,0x00,0x03,0x1C,0x00,0x01,0xEC,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x3E,0x00,0x00,0x7A,0x00,0x00,0xCE,0x00,0x01,0x86,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x06,0x00,0x03,0x86,0x00,0x01,0x8E,0x00,0x00,0xF6,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1F,0x00,0x00,0x3D,0x00,0x00,0x67,0x00,0x00,0xC3,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0x83,0x00,0x01,0xC3,0x00,0x00,0xC7,0x00,0x00,0x7B,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0F,0x80, // 'q'
+	0x37,0x00,0x7B,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x7C,0x00,0x1B,0x80,0x3D,0x80,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x3E,0x00,0x0D,0xC0,0x1E,0xC0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x1F,0x00,0x06,0xE0,0x0F,0x60,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x0F,0x80,0x03,0x70,0x07,0xB0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x07,0xC0,0x01,0xB8,0x03,0xD8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0xE0,0x00,0xDC,0x01,0xEC,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x01,0xF0,0x00,0x6E,0x00,0xF6,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xF8, // 'r'
+	0x7A,0x00,0x86,0x00,0x86,0x00,0x82,0x00,0xE0,0x00,0x78,0x00,0x1E,0x00,0x86,0x00,0x86,0x00,0xC4,0x00,0xB8,0x00,0x3D,0x00,0x43,0x00,0x43,0x00,0x41,0x00,0x70,0x00,0x3C,0x00,0x0F,0x00,0x43,0x00,0x43,0x00,0x62,0x00,0x5C,0x00,0x1E,0x80,0x21,0x80,0x21,0x80,0x20,0x80,0x38,0x00,0x1E,0x00,0x07,0x80,0x21,0x80,0x21,0x80,0x31,0x00,0x2E,0x00,0x0F,0x40,0x10,0xC0,0x10,0xC0,0x10,0x40,0x1C,0x00,0x0F,0x00,0x03,0xC0,0x10,0xC0,0x10,0xC0,0x18,0x80,0x17,0x00,0x07,0xA0,0x08,0x60,0x08,0x60,0x08,0x20,0x0E,0x00,0x07,0x80,0x01,0xE0,0x08,0x60,0x08,0x60,0x0C,0x40,0x0B,0x80,0x03,0xD0,0x04,0x30,0x04,0x30,0x04,0x10,0x07,0x00,0x03,0xC0,0x00,0xF0,0x04,0x30,0x04,0x30,0x06,0x20,0x05,0xC0,0x01,0xE8,0x02,0x18,0x02,0x18,0x02,0x08,0x03,0x80,0x01,0xE0,0x00,0x78,0x02,0x18,0x02,0x18,0x03,0x10,0x02,0xE0,0x00,0xF4,0x01,0x0C,0x01,0x0C,0x01,0x04,0x01,0xC0,0x00,0xF0,0x00,0x3C,0x01,0x0C,0x01,0x0C,0x01,0x88,0x01,0x70, // 's'
+	0x20,0x00,0x60,0x00,0xF8,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x64,0x00,0x38,0x00,0x10,0x00,0x30,0x00,0x7C,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x32,0x00,0x1C,0x00,0x08,0x00,0x18,0x00,0x3E,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x19,0x00,0x0E,0x00,0x04,0x00,0x0C,0x00,0x1F,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x80,0x07,0x00,0x02,0x00,0x06,0x00,0x0F,0x80,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x40,0x03,0x80,0x01,0x00,0x03,0x00,0x07,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x20,0x01,0xC0,0x00,0x80,0x01,0x80,0x03,0xE0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x90,0x00,0xE0,0x00,0x40,0x00,0xC0,0x01,0xF0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC8,0x00,0x70, // 't'
+	0xE3,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x61,0x80,0x00,0x73,0x80,0x00,0x3D,0xC0,0x00,0x71,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x30,0xC0,0x00,0x39,0xC0,0x00,0x1E,0xE0,0x00,0x38,0xE0,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x18,0x60,0x00,0x1C,0xE0,0x00,0x0F,0x70,0x00,0x1C,0x70,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0C,0x30,0x00,0x0E,0x70,0x00,0x07,0xB8,0x00,0x0E,0x38,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x06,0x18,0x00,0x07,0x38,0x00,0x03,0xDC,0x00,0x07,0x1C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x0C,0x00,0x03,0x9C,0x00,0x01,0xEE,0x00,0x03,0x8E,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0xCE,0x00,0x00,0xF7,0x00,0x01,0xC7,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x00,0xE7,0x00,0x00,0x7B,0x80, // 'u'
+	0xF8,0xE0,0x00,0x70,0x40,0x00,0x30,0x40,0x00,0x30,0x80,0x00,0x18,0x80,0x00,0x19,0x00,0x00,0x0D,0x00,0x00,0x0D,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x7C,0x70,0x00,0x38,0x20,0x00,0x18,0x20,0x00,0x18,0x40,0x00,0x0C,0x40,0x00,0x0C,0x80,0x00,0x06,0x80,0x00,0x06,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x02,0x00,0x00,0x3E,0x38,0x00,0x1C,0x10,0x00,0x0C,0x10,0x00,0x0C,0x20,0x00,0x06,0x20,0x00,0x06,0x40,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x1F,0x1C,0x00,0x0E,0x08,0x00,0x06,0x08,0x00,0x06,0x10,0x00,0x03,0x10,0x00,0x03,0x20,0x00,0x01,0xA0,0x00,0x01,0xA0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x80,0x00,0x0F,0x8E,0x00,0x07,0x04,0x00,0x03,0x04,0x00,0x03,0x08,0x00,0x01,0x88,0x00,0x01,0x90,0x00,0x00,0xD0,0x00,0x00,0xD0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x40,0x00,0x07,0xC7,0x00,0x03,0x82,0x00,0x01,0x82,0x00,0x01,0x84,0x00,0x00,0xC4,0x00,0x00,0xC8,0x00,0x00,0x68,0x00,0x00,0x68,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x20,0x00,0x03,0xE3,0x80,0x01,0xC1,0x00,0x00,0xC1,0x00,0x00,0xC2,0x00,0x00,0x62,0x00,0x00,0x64,0x00,0x00,0x34,0x00,0x00,0x34,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x01,0xF1,0xC0,0x00,0xE0,0x80,0x00,0x60,0x80,0x00,0x61,0x00,0x00,0x31,0x00,0x00,0x32,0x00,0x00,0x1A,0x00,0x00,0x1A,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x08,0x00, // 'v'
+	0xF3,0xE7,0x00,0x61,0x83,0x00,0x70,0xC2,0x00,0x30,0xC2,0x00,0x30,0xC4,0x00,0x19,0x64,0x00,0x19,0x68,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x0C,0x30,0x00,0x04,0x10,0x00,0x79,0xF3,0x80,0x30,0xC1,0x80,0x38,0x61,0x00,0x18,0x61,0x00,0x18,0x62,0x00,0x0C,0xB2,0x00,0x0C,0xB4,0x00,0x07,0x1C,0x00,0x07,0x1C,0x00,0x06,0x18,0x00,0x02,0x08,0x00,0x3C,0xF9,0xC0,0x18,0x60,0xC0,0x1C,0x30,0x80,0x0C,0x30,0x80,0x0C,0x31,0x00,0x06,0x59,0x00,0x06,0x5A,0x00,0x03,0x8E,0x00,0x03,0x8E,0x00,0x03,0x0C,0x00,0x01,0x04,0x00,0x1E,0x7C,0xE0,0x0C,0x30,0x60,0x0E,0x18,0x40,0x06,0x18,0x40,0x06,0x18,0x80,0x03,0x2C,0x80,0x03,0x2D,0x00,0x01,0xC7,0x00,0x01,0xC7,0x00,0x01,0x86,0x00,0x00,0x82,0x00,0x0F,0x3E,0x70,0x06,0x18,0x30,0x07,0x0C,0x20,0x03,0x0C,0x20,0x03,0x0C,0x40,0x01,0x96,0x40,0x01,0x96,0x80,0x00,0xE3,0x80,0x00,0xE3,0x80,0x00,0xC3,0x00,0x00,0x41,0x00,0x07,0x9F,0x38,0x03,0x0C,0x18,0x03,0x86,0x10,0x01,0x86,0x10,0x01,0x86,0x20,0x00,0xCB,0x20,0x00,0xCB,0x40,0x00,0x71,0xC0,0x00,0x71,0xC0,0x00,0x61,0x80,0x00,0x20,0x80,0x03,0xCF,0x9C,0x01,0x86,0x0C,0x01,0xC3,0x08,0x00,0xC3,0x08,0x00,0xC3,0x10,0x00,0x65,0x90,0x00,0x65,0xA0,0x00,0x38,0xE0,0x00,0x38,0xE0,0x00,0x30,0xC0,0x00,0x10,0x40,0x01,0xE7,0xCE,0x00,0xC3,0x06,0x00,0xE1,0x84,0x00,0x61,0x84,0x00,0x61,0x88,0x00,0x32,0xC8,0x00,0x32,0xD0,0x00,0x1C,0x70,0x00,0x1C,0x70,0x00,0x18,0x60,0x00,0x08,0x20, // 'w'
+	0xFB,0xC0,0x00,0x31,0x80,0x00,0x19,0x00,0x00,0x1E,0x00,0x00,0x0C,0x00,0x00,0x06,0x00,0x00,0x0F,0x00,0x00,0x13,0x00,0x00,0x21,0x80,0x00,0x61,0xC0,0x00,0xF3,0xE0,0x00,0x7D,0xE0,0x00,0x18,0xC0,0x00,0x0C,0x80,0x00,0x0F,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x07,0x80,0x00,0x09,0x80,0x00,0x10,0xC0,0x00,0x30,0xE0,0x00,0x79,0xF0,0x00,0x3E,0xF0,0x00,0x0C,0x60,0x00,0x06,0x40,0x00,0x07,0x80,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x03,0xC0,0x00,0x04,0xC0,0x00,0x08,0x60,0x00,0x18,0x70,0x00,0x3C,0xF8,0x00,0x1F,0x78,0x00,0x06,0x30,0x00,0x03,0x20,0x00,0x03,0xC0,0x00,0x01,0x80,0x00,0x00,0xC0,0x00,0x01,0xE0,0x00,0x02,0x60,0x00,0x04,0x30,0x00,0x0C,0x38,0x00,0x1E,0x7C,0x00,0x0F,0xBC,0x00,0x03,0x18,0x00,0x01,0x90,0x00,0x01,0xE0,0x00,0x00,0xC0,0x00,0x00,0x60,0x00,0x00,0xF0,0x00,0x01,0x30,0x00,0x02,0x18,0x00,0x06,0x1C,0x00,0x0F,0x3E,0x00,0x07,0xDE,0x00,0x01,0x8C,0x00,0x00,0xC8,0x00,0x00,0xF0,0x00,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0x98,0x00,0x01,0x0C,0x00,0x03,0x0E,0x00,0x07,0x9F,0x00,0x03,0xEF,0x00,0x00,0xC6,0x00,0x00,0x64,0x00,0x00,0x78,0x00,0x00,0x30,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x4C,0x00,0x00,0x86,0x00,0x01,0x87,0x00,0x03,0xCF,0x80,0x01,0xF7,0x80,0x00,0x63,0x00,0x00,0x32,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x1E,0x00,0x00,0x26,0x00,0x00,0x43,0x00,0x00,0xC3,0x80,0x01,0xE7,0xC0, // 'x'
+	0xF8,0xE0,0x00,0x70,0x40,0x00,0x30,0x40,0x00,0x30,0x80,0x00,0x18,0x80,0x00,0x18,0x80,0x00,0x0D,0x00,0x00,0x0D,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x78,0x00,0x00,0x70,0x00,0x00,0x7C,0x70,0x00,0x38,0x20,0x00,0x18,0x20,0x00,0x18,0x40,0x00,0x0C,0x40,0x00,0x0C,0x40,0x00,0x06,0x80,0x00,0x06,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x3E,0x38,0x00,0x1C,0x10,0x00,0x0C,0x10,0x00,0x0C,0x20,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x1E,0x00,0x00,0x1C,0x00,0x00,0x1F,0x1C,0x00,0x0E,0x08,0x00,0x06,0x08,0x00,0x06,0x10,0x00,0x03,0x10,0x00,0x03,0x10,0x00,0x01,0xA0,0x00,0x01,0xA0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x0F,0x8E,0x00,0x07,0x04,0x00,0x03,0x04,0x00,0x03,0x08,0x00,0x01,0x88,0x00,0x01,0x88,0x00,0x00,0xD0,0x00,0x00,0xD0,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x07,0x80,0x00,0x07,0x00,0x00,0x07,0xC7,0x00,0x03,0x82,0x00,0x01,0x82,0x00,0x01,0x84,0x00,0x00,0xC4,0x00,0x00,0xC4,0x00,0x00,0x68,0x00,0x00,0x68,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x03,0xC0,0x00,0x03,0x80,0x00,0x03,0xE3,0x80,0x01,0xC1,0x00,0x00,0xC1,0x00,0x00,0xC2,0x00,0x00,0x62,0x00,0x00,0x62,0x00,0x00,0x34,0x00,0x00,0x34,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x01,0xE0,0x00,0x01,0xC0,0x00,0x01,0xF1,0xC0,0x00,0xE0,0x80,0x00,0x60,0x80,0x00,0x61,0x00,0x00,0x31,0x00,0x00,0x31,0x00,0x00,0x1A,0x00,0x00,0x1A,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00, // 'y'
+	0x7F,0x80,0x00,0x43,0x80,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x30,0x40,0x00,0x70,0xC0,0x00,0xFF,0x80,0x00,0x3F,0xC0,0x00,0x21,0xC0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x18,0x20,0x00,0x38,0x60,0x00,0x7F,0xC0,0x00,0x1F,0xE0,0x00,0x10,0xE0,0x00,0x00,0xC0,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0C,0x10,0x00,0x1C,0x30,0x00,0x3F,0xE0,0x00,0x0F,0xF0,0x00,0x08,0x70,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x06,0x08,0x00,0x0E,0x18,0x00,0x1F,0xF0,0x00,0x07,0xF8,0x00,0x04,0x38,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x04,0x00,0x07,0x0C,0x00,0x0F,0xF8,0x00,0x03,0xFC,0x00,0x02,0x1C,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0x82,0x00,0x03,0x86,0x00,0x07,0xFC,0x00,0x01,0xFE,0x00,0x01,0x0E,0x00,0x00,0x0C,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC1,0x00,0x01,0xC3,0x00,0x03,0xFE,0x00,0x00,0xFF,0x00,0x00,0x87,0x00,0x00,0x06,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x60,0x80,0x00,0xE1,0x80,0x01,0xFF,0x00, // 'z'
+	0x18,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0xC0,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x60,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x30,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x18,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x0C,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x00,0xC0,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x06,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x01,0x80,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x30, // '{'
+	0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01, // '|'
+	0xC0,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x18,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x0C,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x06,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x03,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x01,0x80,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x06,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x06,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x60,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x00,0x01,0x80,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x30,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x01,0x80, // '}'
+	0x38,0x00,0x00,0x66,0x20,0x00,0x41,0xC0,0x00,0x1C,0x00,0x00,0x33,0x10,0x00,0x20,0xE0,0x00,0x0E,0x00,0x00,0x19,0x88,0x00,0x10,0x70,0x00,0x07,0x00,0x00,0x0C,0xC4,0x00,0x08,0x38,0x00,0x03,0x80,0x00,0x06,0x62,0x00,0x04,0x1C,0x00,0x01,0xC0,0x00,0x03,0x31,0x00,0x02,0x0E,0x00,0x00,0xE0,0x00,0x01,0x98,0x80,0x01,0x07,0x00,0x00,0x70,0x00,0x00,0xCC,0x40,0x00,0x83,0x80, // '~'
+};
+const GFXglyph FreeSerif12pt7b_SHIFTEDGlyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   0,   0,   6,    0,    1 }, // ' '
+	  {     0,   2,  16,   8,    3,  -15 }, // '!'
+	  {   256,   6,   6,  10,    1,  -15 }, // '"'
+	  {   352,  12,  16,  12,    0,  -15 }, // '#'
+	  {   736,  10,  18,  12,    1,  -16 }, // '$'
+	  {  1168,  18,  17,  20,    1,  -16 }, // '%'
+	  {  1712,  17,  16,  19,    1,  -15 }, // '&'
+	  {  2096,   2,   6,   5,    1,  -15 }, // '''
+	  {  2192,   6,  20,   8,    1,  -15 }, // '('
+	  {  2512,   6,  20,   8,    1,  -15 }, // ')'
+	  {  2832,   8,  10,  12,    3,  -14 }, // '*'
+	  {  2992,  11,  11,  14,    1,  -10 }, // '+'
+	  {  3256,   3,   6,   6,    2,   -2 }, // ','
+	  {  3352,   6,   1,   8,    1,   -5 }, // '-'
+	  {  3368,   2,   3,   6,    2,   -2 }, // '.'
+	  {  3416,   7,  17,   7,    0,  -16 }, // '/'
+	  {  3688,  10,  17,  12,    1,  -16 }, // '0'
+	  {  4096,   6,  17,  12,    3,  -16 }, // '1'
+	  {  4368,  10,  15,  12,    1,  -14 }, // '2'
+	  {  4728,  10,  16,  12,    1,  -15 }, // '3'
+	  {  5112,  10,  16,  12,    1,  -15 }, // '4'
+	  {  5496,  10,  17,  12,    1,  -16 }, // '5'
+	  {  5904,  10,  17,  12,    1,  -16 }, // '6'
+	  {  6312,  10,  16,  12,    0,  -15 }, // '7'
+	  {  6696,  10,  17,  12,    1,  -16 }, // '8'
+	  {  7104,  10,  18,  12,    1,  -16 }, // '9'
+	  {  7536,   2,  12,   6,    2,  -11 }, // ':'
+	  {  7728,   4,  15,   6,    2,  -11 }, // ';'
+	  {  7968,  12,  13,  14,    1,  -12 }, // '<'
+	  {  8280,  12,   6,  14,    1,   -8 }, // '='
+	  {  8424,  12,  13,  14,    1,  -11 }, // '>'
+	  {  8736,   8,  17,  11,    2,  -16 }, // '?'
+	  {  9008,  17,  16,  21,    2,  -15 }, // '@'
+	  {  9392,  17,  16,  17,    0,  -15 }, // 'A'
+	  {  9776,  12,  16,  15,    1,  -15 }, // 'B'
+	  { 10160,  15,  16,  16,    1,  -15 }, // 'C'
+	  { 10544,  16,  16,  17,    0,  -15 }, // 'D'
+	  { 10928,  14,  16,  15,    0,  -15 }, // 'E'
+	  { 11312,  14,  16,  14,    0,  -15 }, // 'F'
+	  { 11696,  16,  16,  17,    1,  -15 }, // 'G'
+	  { 12080,  16,  16,  17,    0,  -15 }, // 'H'
+	  { 12464,   6,  16,   8,    1,  -15 }, // 'I'
+	  { 12720,   8,  16,   9,    0,  -15 }, // 'J'
+	  { 12976,  16,  16,  17,    1,  -15 }, // 'K'
+	  { 13360,  15,  16,  15,    0,  -15 }, // 'L'
+	  { 13744,  19,  16,  21,    1,  -15 }, // 'M'
+	  { 14256,  16,  16,  17,    1,  -15 }, // 'N'
+	  { 14640,  15,  16,  17,    1,  -15 }, // 'O'
+	  { 15024,  12,  16,  14,    0,  -15 }, // 'P'
+	  { 15408,  16,  20,  17,    1,  -15 }, // 'Q'
+	  { 15888,  15,  16,  16,    0,  -15 }, // 'R'
+	  { 16272,  11,  16,  13,    0,  -15 }, // 'S'
+	  { 16656,  15,  16,  15,    0,  -15 }, // 'T'
+	  { 17040,  16,  16,  17,    1,  -15 }, // 'U'
+	  { 17424,  17,  16,  17,    0,  -15 }, // 'V'
+	  { 17808,  22,  16,  23,    0,  -15 }, // 'W'
+	  { 18320,  17,  16,  17,    0,  -15 }, // 'X'
+	  { 18704,  16,  16,  17,    0,  -15 }, // 'Y'
+	  { 19088,  14,  16,  15,    1,  -15 }, // 'Z'
+	  { 19472,   5,  20,   8,    2,  -15 }, // '['
+	  { 19792,   7,  17,   7,    0,  -16 }, // 0x5C
+	  { 20064,   5,  20,   8,    1,  -15 }, // ']'
+	  { 20384,  10,   9,  11,    1,  -15 }, // '^'
+	  { 20600,  12,   1,  12,    0,    3 }, // '_'
+	  { 20624,   5,   4,   6,    0,  -15 }, // '`'
+	  { 20688,  10,  11,  10,    1,  -10 }, // 'a'
+	  { 20952,  10,  17,  12,    1,  -16 }, // 'b'
+	  { 21360,   8,  11,  11,    1,  -10 }, // 'c'
+	  { 21536,  10,  17,  12,    1,  -16 }, // 'd'
+	  { 21944,  10,  11,  11,    1,  -10 }, // 'e'
+	  { 22208,   9,  17,   9,    0,  -16 }, // 'f'
+	  { 22480,  12,  16,  11,    0,  -10 }, // 'g'
+	  { 22864,  11,  17,  12,    0,  -16 }, // 'h'
+	  { 23272,   5,  16,   7,    0,  -15 }, // 'i'
+	  { 23528,   6,  21,   8,    0,  -15 }, // 'j'
+	  { 23864,  11,  17,  12,    1,  -16 }, // 'k'
+	  { 24272,   5,  17,   6,    0,  -16 }, // 'l'
+	  { 24544,  18,  11,  19,    0,  -10 }, // 'm'
+	  { 24896,  11,  11,  12,    0,  -10 }, // 'n'
+	  { 25160,  10,  11,  12,    1,  -10 }, // 'o'
+	  { 25424,  11,  16,  12,    0,  -10 }, // 'p'
+	  { 25808,  10,  16,  12,    1,  -10 }, // 'q'
+	  { 26192,   8,  11,   8,    0,  -10 }, // 'r'
+	  { 26368,   7,  11,   9,    1,  -10 }, // 's'
+	  { 26544,   6,  13,   7,    1,  -12 }, // 't'
+	  { 26752,  10,  11,  12,    1,  -10 }, // 'u'
+	  { 27016,  11,  11,  11,    0,  -10 }, // 'v'
+	  { 27280,  16,  11,  16,    0,  -10 }, // 'w'
+	  { 27544,  11,  11,  12,    0,  -10 }, // 'x'
+	  { 27808,  11,  16,  11,    0,  -10 }, // 'y'
+	  { 28192,  10,  11,  10,    0,  -10 }, // 'z'
+	  { 28456,   5,  21,  12,    2,  -16 }, // '{'
+	  { 28792,   1,  17,   5,    2,  -16 }, // '|'
+	  { 28928,   5,  21,  12,    5,  -15 }, // '}'
+	  { 29264,  12,   3,  12,    0,   -6 }  // '~'
+};
+const GFXfont FreeSerif12pt7b_SHIFTED PROGMEM = {
+(uint8_t  *)FreeSerif12pt7b_SHIFTEDBitmaps,(GFXglyph *)FreeSerif12pt7b_SHIFTEDGlyphs,0x20, 0x7E, 29};
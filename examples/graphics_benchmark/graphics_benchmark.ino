@@ -0,0 +1,172 @@
+//
+// Graphics benchmark
+// Measures the speed of the back buffer drawing functions
+// No printer is needed; the results are written to the serial monitor
+//
+// written by Larry Bank
+// Copyright (c) 2020 BitBank Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <Thermal_Printer.h>
+// The same font in each glyph format (made with tools/fontcomp)
+#include "FreeSerif12pt7b.h"
+#include "FreeSerif12pt7b_rle.h"
+#include "FreeSerif12pt7b_rows.h"
+#include "FreeSerif12pt7b_shifted.h"
+#define WIDTH 384
+#define HEIGHT 240
+static uint8_t ucBuf[(WIDTH/8) * HEIGHT];
+
+void ShowTime(const char *szName, long lTime)
+{
+  Serial.print(szName);
+  Serial.print(" = ");
+  Serial.print((int)lTime, DEC);
+  Serial.println(" us");
+} /* ShowTime() */
+
+void FontTime(const char *szName, GFXfont *pFont, int iFormat)
+{
+long lTime;
+int i;
+
+  tpSetFontFormat(pFont, iFormat);
+  tpFill(0);
+  lTime = micros();
+  for (i=0; i<10; i++)
+    tpDrawCustomText(pFont, i*3+1, 20 + i*22, (char *)"The quick brown fox jumps");
+  ShowTime(szName, micros() - lTime);
+} /* FontTime() */
+
+void setup() {
+long lTime;
+int x, y, i;
+
+  Serial.begin(115200);
+  while (!Serial);
+  tpSetBackBuffer(ucBuf, WIDTH, HEIGHT);
+
+  // Horizontal rules, one pixel at a time vs spans
+  tpFill(0);
+  lTime = micros();
+  for (y=0; y<HEIGHT; y+=2)
+    for (x=0; x<WIDTH; x++)
+      tpSetPixel(x, y, 1);
+  ShowTime("120 rules (tpSetPixel)", micros() - lTime);
+  tpFill(0);
+  lTime = micros();
+  for (y=0; y<HEIGHT; y+=2)
+    tpDrawLine(0, y, WIDTH-1, y, 1);
+  ShowTime("120 rules (tpDrawLine)", micros() - lTime);
+
+  // Vertical lines
+  tpFill(0);
+  lTime = micros();
+  for (x=0; x<WIDTH; x+=4)
+    tpDrawLine(x, 0, x, HEIGHT-1, 1);
+  ShowTime("96 vertical lines", micros() - lTime);
+
+  // Filled rectangles
+  tpFill(0);
+  lTime = micros();
+  for (i=0; i<20; i++)
+    for (y=i*10; y<i*10+8; y++)
+      for (x=i*3; x<WIDTH-i*3; x++)
+        tpSetPixel(x, y, 1);
+  ShowTime("20 filled rects (tpSetPixel)", micros() - lTime);
+  tpFill(0);
+  lTime = micros();
+  for (i=0; i<20; i++)
+    tpDrawRect(i*3, i*10, WIDTH-1-i*3, i*10+7, 1, 1);
+  ShowTime("20 filled rects (tpDrawRect)", micros() - lTime);
+  tpFill(0);
+  lTime = micros();
+  for (i=0; i<20; i++)
+    tpDrawRect(i*3, i*10, WIDTH-1-i*3, i*10+7, 1, 0);
+  ShowTime("20 outlined rects", micros() - lTime);
+
+  // Diagonal lines which need clipping
+  tpFill(0);
+  lTime = micros();
+  for (i=0; i<100; i++)
+    tpDrawLine(-200 + i*8, -100, WIDTH + 200 - i*8, HEIGHT + 100, 1);
+  ShowTime("100 clipped lines", micros() - lTime);
+
+  // Text at unaligned positions and large scaled ticket numbers
+  tpFill(0);
+  lTime = micros();
+  for (i=0; i<20; i++)
+    tpDrawText(i*3+1, i*10, (char *)"The quick brown fox jumps", FONT_SMALL, 0);
+  ShowTime("20 unaligned text lines", micros() - lTime);
+  tpFill(0);
+  lTime = micros();
+  tpDrawScaledText(5, 0, (char *)"A-042", FONT_LARGE, 2, 0);
+  ShowTime("2x ticket number (32x64)", micros() - lTime);
+  tpFill(0);
+  lTime = micros();
+  tpDrawScaledText(0, 0, (char *)"ORDER 17", FONT_SMALL, 4, 1);
+  ShowTime("4x inverted header (32x32)", micros() - lTime);
+
+  // Word wrap layout of a 2K message
+  {
+  static char szMsg[2048];
+    szMsg[0] = 0;
+    while (strlen(szMsg) < sizeof(szMsg) - 50)
+      strcat(szMsg, "The quick brown fox jumps over the lazy dog. ");
+    tpSetFont(NULL, FONT_SMALL, 1);
+    lTime = micros();
+    i = tpMeasureParagraph(szMsg, WIDTH, 0);
+    ShowTime("2K paragraph layout", micros() - lTime);
+    lTime = micros();
+    i = tpMeasureParagraph(szMsg, WIDTH, 1);
+    ShowTime("2K paragraph layout (balanced)", micros() - lTime);
+    tpFill(0);
+    lTime = micros();
+    tpDrawParagraph(0, 0, WIDTH, szMsg, ALIGN_JUSTIFY, 0);
+    ShowTime("2K paragraph justified drawing", micros() - lTime);
+  }
+
+  // Custom font glyph formats
+  FontTime("10 GFX font lines (GFXfont)", (GFXfont *)&FreeSerif12pt7b, FONT_FORMAT_GFX);
+  FontTime("10 GFX font lines (RLE)", (GFXfont *)&FreeSerif12pt7b_RLE, FONT_FORMAT_RLE);
+  FontTime("10 GFX font lines (aligned rows)", (GFXfont *)&FreeSerif12pt7b_ROWS, FONT_FORMAT_ROWS);
+  FontTime("10 GFX font lines (pre-shifted rows)", (GFXfont *)&FreeSerif12pt7b_SHIFTED, FONT_FORMAT_ROWS_SHIFTED);
+
+  // The same header drawn on every job, without and with the text cache
+  {
+  static uint8_t ucCache[4096];
+  int iHits, iMisses, iBytes;
+    tpFill(0);
+    lTime = micros();
+    for (i=0; i<10; i++)
+      tpDrawCustomText((GFXfont *)&FreeSerif12pt7b, 10, 30, (char *)"BitBank Coffee Roasters");
+    ShowTime("10 repeated headers", micros() - lTime);
+    tpSetTextCache(ucCache, sizeof(ucCache));
+    lTime = micros();
+    for (i=0; i<10; i++)
+      tpDrawCustomText((GFXfont *)&FreeSerif12pt7b, 10, 30, (char *)"BitBank Coffee Roasters");
+    ShowTime("10 repeated headers (cached)", micros() - lTime);
+    tpGetTextCacheStats(&iHits, &iMisses, &iBytes);
+    Serial.print("text cache hits/misses/bytes = ");
+    Serial.print(iHits, DEC); Serial.print("/");
+    Serial.print(iMisses, DEC); Serial.print("/");
+    Serial.println(iBytes, DEC);
+    tpSetTextCache(NULL, 0);
+  }
+} /* setup() */
+
+void loop() {
+} /* loop() */
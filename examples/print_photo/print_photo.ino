@@ -3,23 +3,45 @@
 
 #include "eagle_576.h"
 #include "dog_384.h"
-
-uint8_t ucDither[576 * 16]; // buffer for the dithered pixel output
+//
+// Prints a JPEG image of any size at the full width of the printer.
+// JPEGDEC shrinks the image by 1/2, 1/4 or 1/8 while it decodes (whichever
+// leaves just enough pixels), then the library's scaler fits the gray
+// rows to the printer, lightens them for thermal paper and dithers them
+// as they're printed. Only one strip of the decoded image is in memory.
+//
+#define MAX_DECODE_WIDTH 1024 // after the decoder's scaling
+#define MAX_PRINT_WIDTH 576
+uint8_t ucStrip[MAX_DECODE_WIDTH * 16]; // one row of MCUs as 8-bit gray
+uint8_t ucGray[MAX_PRINT_WIDTH]; // a row fitted to the printer
+uint8_t ucTone[256];
+uint8_t ucWindow[TP_DITHER_WINDOW(MAX_PRINT_WIDTH)];
+int16_t sErrors[TP_DITHER_ERRORS(MAX_PRINT_WIDTH)];
+uint32_t u32ScaleMem[TP_SCALE_MEM(MAX_PRINT_WIDTH)];
+TPSCALER scaler;
+TPDITHER dither;
 JPEGDEC jpg;
-static int iWidth;
+static int iDecodeWidth;
 
 int JPEGDraw(JPEGDRAW *pDraw)
 {
-  int i, iCount;
+  int y, iCount;
   uint8_t *s = (uint8_t *)pDraw->pPixels;
-  
-  tpSetBackBuffer((uint8_t *)pDraw->pPixels, pDraw->iWidth, pDraw->iHeight);
-  // The output is inverted, so flip the bits
-  iCount = (pDraw->iWidth * pDraw->iHeight)/8;
-  for (i=0; i<iCount; i++)
-     s[i] = ~s[i];
-     
-  tpPrintBuffer(); // Print this block of pixels
+
+  // The decoder may hand over a strip in several blocks; collect them
+  iCount = pDraw->iWidth;
+  if (pDraw->x + iCount > iDecodeWidth)
+    iCount = iDecodeWidth - pDraw->x;
+  for (y=0; y<pDraw->iHeight; y++)
+    memcpy(&ucStrip[y * iDecodeWidth + pDraw->x], &s[y * pDraw->iWidth], iCount);
+  if (pDraw->x + pDraw->iWidth < iDecodeWidth)
+    return 1; // wait for the rest of this strip
+  for (y=0; y<pDraw->iHeight; y++) {
+    if (tpScalePush(&scaler, &ucStrip[y * iDecodeWidth]) != 0)
+      break; // past the bottom of the image
+    while (tpScalePull(&scaler, ucGray))
+      tpPrintGrayRow(&dither, ucGray);
+  }
   return 1; // Continue decode
 } /* JPEGDraw() */
 
@@ -50,10 +72,9 @@ void setup() {
 
 void loop() {
 uint8_t *pImage;
-int iImageSize;
+int iImageSize, iScale, iDecodeHeight;
 
-  iWidth = tpGetWidth(); // get the width of the printer in pixels
-  if (iWidth == 384) {
+  if (tpGetWidth() == 384) {
      pImage = (uint8_t *)dog_384;
      iImageSize = (int)sizeof(dog_384);
   } else { // assume 576
@@ -61,8 +82,23 @@ int iImageSize;
      iImageSize = (int)sizeof(eagle_576);
   }
   if (jpg.openFLASH(pImage, iImageSize, JPEGDraw)) {
-     jpg.setPixelType(ONE_BIT_DITHERED);
-     jpg.decodeDither(ucDither, 0);
+     // decode at the smallest size which is still at least the printer width
+     iScale = tpDecodeScale(jpg.getWidth(), 0);
+     iDecodeWidth = (jpg.getWidth() + iScale - 1) / iScale;
+     iDecodeHeight = (jpg.getHeight() + iScale - 1) / iScale;
+     if (iDecodeWidth <= MAX_DECODE_WIDTH &&
+         tpScaleInit(&scaler, SCALE_GRAY8, iDecodeWidth, iDecodeHeight, 0, 0, u32ScaleMem) == 0) {
+        tpDitherInit(&dither, DITHER_FLOYD_STEINBERG, scaler.iDestWidth, sErrors);
+        tpPrinterToneCurve(ucTone, PRINTER_X18_9556);
+        tpDitherSetFilter(&dither, ucTone, 4, ucWindow);
+        memset(ucStrip, 0xff, sizeof(ucStrip));
+        jpg.setPixelType(EIGHT_BIT_GRAYSCALE);
+        tpBeginImage(); // one print session for all of the strips
+        jpg.decode(0, 0, (iScale == 1) ? 0 : iScale);
+        tpPrintGrayRow(&dither, NULL); // the sharpening holds back the last row
+        tpEndImage();
+     }
+     jpg.close();
   }
   tpFeed(32); // advance the paper 32 scan lines
   tpDisconnect();
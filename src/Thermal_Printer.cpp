@@ -19,6 +19,7 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 #include <Arduino.h>
+#include <stdarg.h>
 // uncomment this line to see debug info on serial monitor
 #define DEBUG_OUTPUT
 
@@ -34,13 +35,105 @@ static uint8_t bWithResponse = 0; // default to not wait for a response
 static uint8_t *pBackBuffer = NULL;
 static uint8_t bConnected = 0;
 static uint8_t bFound = 0; // flag to indicate if a printer was found during scan
+static uint8_t bPrinterInit = 0; // printer init sequence sent
+static int bb_top = 0; // page row which maps to the first row of the back buffer
+// Display list (banded rendering) state
+static uint8_t *pDisplayList = NULL;
+static int iDLSize, iDLUsed, iDLPageHeight;
+static uint8_t iDLMode = 0; // DL_MODE_OFF/RECORD/REPLAY
+static uint8_t ucDLFill = 0; // background pattern for each band
+// Dirty row tracking; rows which haven't been drawn since tpFill(0) aren't sent
+#define TP_MAX_DIRTY_ROWS 1024
+#define TP_MIN_FEED_ROWS 8 // shorter runs of blank rows are sent as data
+static uint8_t ucDirtyRows[TP_MAX_DIRTY_ROWS/8]; // 1 bit per back buffer row
+static int iDirtyTop, iDirtyBottom; // range of rows drawn (top > bottom = clean)
+static int iBlankRows; // blank rows waiting to be sent as a paper feed
+static uint8_t bRowsStarted; // first non-blank row of the page has been sent
+// Character set state
+#ifdef CP852_SUPPORT
+static uint16_t usCodePage = CODEPAGE_852;
+#else
+static uint16_t usCodePage = CODEPAGE_437;
+#endif
+static uint8_t bUTF8 = 0; // decode the text as UTF-8
+static uint16_t usMapKey[256]; // hash table of Unicode values -> character codes
+static uint8_t ucMapValue[256];
+static uint8_t bMapValid = 0;
+#define TP_MAX_FONT_INFO 4
+static GFXfont *pInfoFont[TP_MAX_FONT_INFO]; // fonts with sparse glyphs or compressed bitmaps
+static const uint8_t *pGlyphMap[TP_MAX_FONT_INFO];
+static uint8_t ucFontFormat[TP_MAX_FONT_INFO];
+static uint8_t ucTextStyle = STYLE_NORMAL; // STYLE_xxx flags applied to all text
+// Character cells of the built-in font sizes (FONT_SMALL/LARGE/SMOOTH2X/SMOOTH3X)
+static const uint8_t ucCellWidth[4] = {8, 16, 16, 24};
+static const uint8_t ucCellHeight[4] = {8, 32, 16, 24};
+// Rendered text cache (LRU); each entry is a TPCACHEENTRY header followed by
+// the zero terminated string and the 1-bpp image
+typedef struct tag_tpcacheentry {
+  const void *pFont;
+  uint32_t u32Hash; // of the string
+  uint32_t u32LastUse; // LRU tick
+  uint32_t u32Size; // size of the whole entry in bytes
+  uint16_t u16Attr; // character set, style, rotation (and built-in font size) of the image
+  int16_t x, y; // image position relative to the text origin (left, top)
+  int16_t iWidth, iHeight; // image size in pixels
+} TPCACHEENTRY;
+static uint8_t *pTextCache = NULL;
+static int iCacheSize, iCacheUsed;
+static uint32_t u32CacheTick, u32CacheHits, u32CacheMisses;
+// Text mode (tpPrint) state; each finished line is rendered into a strip
+// of rows and streamed to the printer
+#define TP_MAX_LINE 160
+#define TP_STRIP_SIZE 768 // 16 rows of 384 pixels
+static uint8_t ucStrip[TP_STRIP_SIZE];
+static char szLine[TP_MAX_LINE+1]; // characters of the current line
+static int iLineLen, iLineWidth; // characters and pixel width of the current line
+static GFXfont *pTextFont = NULL; // NULL = use a built-in font
+static uint8_t ucTextFont = FONT_SMALL, ucTextScale = 1, ucTextAlign = ALIGN_LEFT;
+static uint8_t bStreaming = 0; // a graphics session is open for streamed lines
+static uint8_t bImageOpen = 0; // tpBeginImage() was called
+static uint8_t ucAdvance[256]; // advance of each character in the text mode font
+static uint8_t bAdvanceValid = 0;
+// Word wrap state; paragraphs are laid out up to TP_MAX_WORDS words at a time
+#define TP_MAX_WORDS 128
+typedef struct tag_tpword {
+  uint16_t iStart, iLen; // characters of the text
+  int16_t iWidth; // in pixels
+  uint8_t bSpace; // there's a space before it
+} TPWORD;
+static TPWORD tpWords[TP_MAX_WORDS];
+static uint32_t u32Cost[TP_MAX_WORDS+1]; // minimum raggedness from each word to the end
+static uint8_t ucBreak[TP_MAX_WORDS+1]; // best line break after each word
+typedef void (*TP_LINE_CB)(const char *szText, TPWORD *pWords, int iCount, int iWidth, int bLast, void *pUser);
+// Table layout state
+#define TP_MAX_COLUMNS 8
+#define TP_MAX_CELL_LINES 8 // wrapped cells are cut off after this many lines
+typedef struct tag_tpcellline {
+  uint16_t iStart, iLen; // characters of the cell text
+  int16_t x; // offset in the column
+  uint8_t bEllipsis; // followed by "..."
+} TPCELLLINE;
+static TPCOLUMN *pTableColumns = NULL;
+static int iTableColumns, iTableGap;
+static TPCELLLINE tpCellLines[TP_MAX_COLUMNS][TP_MAX_CELL_LINES];
+static uint8_t ucCellLines[TP_MAX_COLUMNS]; // lines in each cell of the current row
+static char **pRowCells; // text of the current row
 static void tpWriteData(uint8_t *pData, int iLen);
 extern "C" {
-extern unsigned char ucFont[], ucBigFont[];
+extern unsigned char ucFont[], ucFont852[];
+#ifndef TP_NO_BIG_FONT
+extern unsigned char ucBigFont[];
+#endif
 };
 static void tpPreGraphics(int iWidth, int iHeight);
 static void tpPostGraphics(void);
+static void tpBeginGraphics(void);
+static void tpFlushLine(int bWrapped);
 static void tpSendScanline(uint8_t *pSrc, int iLen);
+static void tpSetAllDirty(int bDirty);
+static void tpRotatedRun(int x, int y, const char *szMsg, int iAngle, int iWidth, int *pStart, int *pPen);
+static int tpFillPoints(TPPOINT *pPoints, int iCount, int iRule, uint8_t ucColor);
+static void tpOutlinePoints(TPPOINT *pPoints, int iCount, int bClose, uint8_t ucColor);
 static uint8_t CheckSum(uint8_t *pData, int iLen);
 static void tpWriteCatCommandD8(uint8_t command, uint8_t data);
 static void tpWriteCatCommandD16(uint8_t command, uint16_t data);
@@ -62,6 +155,41 @@ const uint8_t x18LatticeEnd[] = {0xaa, 0x55, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
 //OtherFeedPaper = 0xBD  # Data: one byte, set to a device-specific "Speed" value before printing
 //#                              and to 0x19 before feeding blank paper
 
+//
+// Display list records
+// Each drawing call made between tpBeginDisplayList() and tpEndDisplayList()
+// is stored as a fixed header followed by any string data. The header holds
+// the range of page rows touched so that each band only replays the
+// commands which intersect it.
+//
+enum {
+  DL_MODE_OFF=0,
+  DL_MODE_RECORD,
+  DL_MODE_REPLAY
+};
+
+enum {
+  DL_PIXEL=0,
+  DL_LINE,
+  DL_TEXT,
+  DL_CUSTOMTEXT,
+  DL_BMP,
+  DL_RECT,
+  DL_POLY,
+  DL_ELLIPSE,
+  DL_ROUNDRECT,
+  DL_ROTTEXT
+};
+
+typedef struct tag_dlcmd {
+  const void *pData; // font or bitmap pointer
+  uint16_t u16Size; // size of the whole record in bytes (header + string)
+  uint8_t ucType;
+  uint8_t ucColor; // color, invert flag or text wrap flag
+  int16_t iTop, iBottom; // page rows touched (inclusive)
+  int16_t x1, y1, x2, y2; // meaning depends on the command type
+} DLCMD;
+
 int i;
 
 //CRC8 pre calculated values
@@ -102,6 +230,79 @@ const unsigned char ucMirror[256] PROGMEM =
       0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
       0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF};
 
+/* Unicode values of the characters 0x80-0xFF of the built-in code pages */
+const uint16_t usCP437[128] PROGMEM =
+     {0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x00e0, 0x00e5, 0x00e7,
+      0x00ea, 0x00eb, 0x00e8, 0x00ef, 0x00ee, 0x00ec, 0x00c4, 0x00c5,
+      0x00c9, 0x00e6, 0x00c6, 0x00f4, 0x00f6, 0x00f2, 0x00fb, 0x00f9,
+      0x00ff, 0x00d6, 0x00dc, 0x00a2, 0x00a3, 0x00a5, 0x20a7, 0x0192,
+      0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x00f1, 0x00d1, 0x00aa, 0x00ba,
+      0x00bf, 0x2310, 0x00ac, 0x00bd, 0x00bc, 0x00a1, 0x00ab, 0x00bb,
+      0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+      0x2555, 0x2563, 0x2551, 0x2557, 0x255d, 0x255c, 0x255b, 0x2510,
+      0x2514, 0x2534, 0x252c, 0x251c, 0x2500, 0x253c, 0x255e, 0x255f,
+      0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x2567,
+      0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256b,
+      0x256a, 0x2518, 0x250c, 0x2588, 0x2584, 0x258c, 0x2590, 0x2580,
+      0x03b1, 0x00df, 0x0393, 0x03c0, 0x03a3, 0x03c3, 0x00b5, 0x03c4,
+      0x03a6, 0x0398, 0x03a9, 0x03b4, 0x221e, 0x03c6, 0x03b5, 0x2229,
+      0x2261, 0x00b1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00f7, 0x2248,
+      0x00b0, 0x2219, 0x00b7, 0x221a, 0x207f, 0x00b2, 0x25a0, 0x00a0};
+const uint16_t usCP852[128] PROGMEM =
+     {0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x016f, 0x0107, 0x00e7,
+      0x0142, 0x00eb, 0x0150, 0x0151, 0x00ee, 0x0179, 0x00c4, 0x0106,
+      0x00c9, 0x0139, 0x013a, 0x00f4, 0x00f6, 0x013d, 0x013e, 0x015a,
+      0x015b, 0x00d6, 0x00dc, 0x0164, 0x0165, 0x0141, 0x00d7, 0x010d,
+      0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x0104, 0x0105, 0x017d, 0x017e,
+      0x0118, 0x0119, 0x00ac, 0x017a, 0x010c, 0x015f, 0x00ab, 0x00bb,
+      0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x00c1, 0x00c2, 0x011a,
+      0x015e, 0x2563, 0x2551, 0x2557, 0x255d, 0x017b, 0x017c, 0x2510,
+      0x2514, 0x2534, 0x252c, 0x251c, 0x2500, 0x253c, 0x0102, 0x0103,
+      0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x00a4,
+      0x0111, 0x0110, 0x010e, 0x00cb, 0x010f, 0x0147, 0x00cd, 0x00ce,
+      0x011b, 0x2518, 0x250c, 0x2588, 0x2584, 0x0162, 0x016e, 0x2580,
+      0x00d3, 0x00df, 0x00d4, 0x0143, 0x0144, 0x0148, 0x0160, 0x0161,
+      0x0154, 0x00da, 0x0155, 0x0170, 0x00fd, 0x00dd, 0x0163, 0x00b4,
+      0x00ad, 0x02dd, 0x02db, 0x02c7, 0x02d8, 0x00a7, 0x00f7, 0x00b8,
+      0x00b0, 0x00a8, 0x02d9, 0x0171, 0x0158, 0x0159, 0x25a0, 0x00a0};
+/* Table to double the width of 1-bpp pixels (each bit becomes 2 bits) */
+const uint16_t usExpand2[256] PROGMEM =
+     {0x0000, 0x0003, 0x000c, 0x000f, 0x0030, 0x0033, 0x003c, 0x003f,
+      0x00c0, 0x00c3, 0x00cc, 0x00cf, 0x00f0, 0x00f3, 0x00fc, 0x00ff,
+      0x0300, 0x0303, 0x030c, 0x030f, 0x0330, 0x0333, 0x033c, 0x033f,
+      0x03c0, 0x03c3, 0x03cc, 0x03cf, 0x03f0, 0x03f3, 0x03fc, 0x03ff,
+      0x0c00, 0x0c03, 0x0c0c, 0x0c0f, 0x0c30, 0x0c33, 0x0c3c, 0x0c3f,
+      0x0cc0, 0x0cc3, 0x0ccc, 0x0ccf, 0x0cf0, 0x0cf3, 0x0cfc, 0x0cff,
+      0x0f00, 0x0f03, 0x0f0c, 0x0f0f, 0x0f30, 0x0f33, 0x0f3c, 0x0f3f,
+      0x0fc0, 0x0fc3, 0x0fcc, 0x0fcf, 0x0ff0, 0x0ff3, 0x0ffc, 0x0fff,
+      0x3000, 0x3003, 0x300c, 0x300f, 0x3030, 0x3033, 0x303c, 0x303f,
+      0x30c0, 0x30c3, 0x30cc, 0x30cf, 0x30f0, 0x30f3, 0x30fc, 0x30ff,
+      0x3300, 0x3303, 0x330c, 0x330f, 0x3330, 0x3333, 0x333c, 0x333f,
+      0x33c0, 0x33c3, 0x33cc, 0x33cf, 0x33f0, 0x33f3, 0x33fc, 0x33ff,
+      0x3c00, 0x3c03, 0x3c0c, 0x3c0f, 0x3c30, 0x3c33, 0x3c3c, 0x3c3f,
+      0x3cc0, 0x3cc3, 0x3ccc, 0x3ccf, 0x3cf0, 0x3cf3, 0x3cfc, 0x3cff,
+      0x3f00, 0x3f03, 0x3f0c, 0x3f0f, 0x3f30, 0x3f33, 0x3f3c, 0x3f3f,
+      0x3fc0, 0x3fc3, 0x3fcc, 0x3fcf, 0x3ff0, 0x3ff3, 0x3ffc, 0x3fff,
+      0xc000, 0xc003, 0xc00c, 0xc00f, 0xc030, 0xc033, 0xc03c, 0xc03f,
+      0xc0c0, 0xc0c3, 0xc0cc, 0xc0cf, 0xc0f0, 0xc0f3, 0xc0fc, 0xc0ff,
+      0xc300, 0xc303, 0xc30c, 0xc30f, 0xc330, 0xc333, 0xc33c, 0xc33f,
+      0xc3c0, 0xc3c3, 0xc3cc, 0xc3cf, 0xc3f0, 0xc3f3, 0xc3fc, 0xc3ff,
+      0xcc00, 0xcc03, 0xcc0c, 0xcc0f, 0xcc30, 0xcc33, 0xcc3c, 0xcc3f,
+      0xccc0, 0xccc3, 0xcccc, 0xcccf, 0xccf0, 0xccf3, 0xccfc, 0xccff,
+      0xcf00, 0xcf03, 0xcf0c, 0xcf0f, 0xcf30, 0xcf33, 0xcf3c, 0xcf3f,
+      0xcfc0, 0xcfc3, 0xcfcc, 0xcfcf, 0xcff0, 0xcff3, 0xcffc, 0xcfff,
+      0xf000, 0xf003, 0xf00c, 0xf00f, 0xf030, 0xf033, 0xf03c, 0xf03f,
+      0xf0c0, 0xf0c3, 0xf0cc, 0xf0cf, 0xf0f0, 0xf0f3, 0xf0fc, 0xf0ff,
+      0xf300, 0xf303, 0xf30c, 0xf30f, 0xf330, 0xf333, 0xf33c, 0xf33f,
+      0xf3c0, 0xf3c3, 0xf3cc, 0xf3cf, 0xf3f0, 0xf3f3, 0xf3fc, 0xf3ff,
+      0xfc00, 0xfc03, 0xfc0c, 0xfc0f, 0xfc30, 0xfc33, 0xfc3c, 0xfc3f,
+      0xfcc0, 0xfcc3, 0xfccc, 0xfccf, 0xfcf0, 0xfcf3, 0xfcfc, 0xfcff,
+      0xff00, 0xff03, 0xff0c, 0xff0f, 0xff30, 0xff33, 0xff3c, 0xff3f,
+      0xffc0, 0xffc3, 0xffcc, 0xffcf, 0xfff0, 0xfff3, 0xfffc, 0xffff};
+/* Table to triple the width of 4 pixels (each bit becomes 3 bits) */
+const uint16_t usExpand3[16] PROGMEM =
+     {0x000, 0x007, 0x038, 0x03f, 0x1c0, 0x1c7, 0x1f8, 0x1ff, 0xe00, 0xe07, 0xe38, 0xe3f, 0xfc0, 0xfc7, 0xff8, 0xfff};
+
 
 
 // X18-9556 specific NimBLE variables
@@ -169,6 +370,44 @@ class tpNimBLEAdvertisedDeviceCallbacks: public NimBLEScanCallbacks
     }
 }; // class tpNimBLEAdvertisedDeviceCallbacks
 
+//
+// Mark the whole back buffer as drawn (1) or untouched (0)
+//
+static void tpSetAllDirty(int bDirty)
+{
+  memset(ucDirtyRows, (bDirty) ? 0xff : 0, sizeof(ucDirtyRows));
+  if (bDirty) {
+    iDirtyTop = 0; iDirtyBottom = bb_height - 1;
+  } else {
+    iDirtyTop = bb_height; iDirtyBottom = -1;
+  }
+} /* tpSetAllDirty() */
+//
+// Mark a range of back buffer rows (inclusive) as drawn
+//
+static void tpMarkDirty(int y1, int y2)
+{
+int y;
+
+  if (y1 < 0) y1 = 0;
+  if (y2 >= bb_height) y2 = bb_height - 1;
+  if (y1 > y2) return;
+  if (y1 < iDirtyTop) iDirtyTop = y1;
+  if (y2 > iDirtyBottom) iDirtyBottom = y2;
+  if (y2 >= TP_MAX_DIRTY_ROWS) y2 = TP_MAX_DIRTY_ROWS-1; // rows beyond are always sent
+  for (y = y1; y <= y2; y++)
+    ucDirtyRows[y >> 3] |= (0x80 >> (y & 7));
+} /* tpMarkDirty() */
+//
+// Returns true if the given back buffer row has been drawn
+//
+static int tpRowDirty(int y)
+{
+  if (y < iDirtyTop || y > iDirtyBottom) return 0;
+  if (y >= TP_MAX_DIRTY_ROWS) return 1;
+  return (ucDirtyRows[y >> 3] & (0x80 >> (y & 7))) != 0;
+} /* tpRowDirty() */
+//
 // Provide a back buffer for your printer graphics
 // This allows you to manage the RAM used on
 // embedded platforms like Arduinos
@@ -181,6 +420,7 @@ void tpSetBackBuffer(uint8_t *pBuffer, int iWidth, int iHeight)
   bb_width = iWidth;
   bb_height = iHeight;
   bb_pitch = (iWidth + 7) >> 3;
+  tpSetAllDirty(1); // we don't know what's in it
 } /* tpSetBackBuffer() */
 
 //
@@ -189,10 +429,165 @@ void tpSetBackBuffer(uint8_t *pBuffer, int iWidth, int iHeight)
 //
 void tpFill(unsigned char ucData)
 {
-  if (pBackBuffer != NULL)
+  if (iDLMode == DL_MODE_RECORD) { // start a new page
+    iDLUsed = 0;
+    ucDLFill = ucData;
+    return;
+  }
+  if (pBackBuffer != NULL) {
     memset(pBackBuffer, ucData, bb_pitch * bb_height);
+    tpSetAllDirty(ucData != 0); // a blank page has nothing to print
+  }
 } /* tpFill() */
 //
+// Height of the page being drawn
+// In display list mode, the back buffer only holds one band
+//
+static int tpPageHeight(void)
+{
+  return (iDLMode != DL_MODE_OFF) ? iDLPageHeight : bb_height;
+} /* tpPageHeight() */
+//
+// Start recording the drawing functions into a display list
+// The back buffer then only needs to hold a band of rows (e.g. 384x16)
+// and tpPrintBuffer() renders and sends the page one band at a time
+// pList/iListSize is the memory for the recorded commands
+// iPageHeight is the total height of the page in pixels
+//
+int tpBeginDisplayList(uint8_t *pList, int iListSize, int iPageHeight)
+{
+  if (pList == NULL || iPageHeight <= 0)
+     return -1;
+  while ((intptr_t)pList & (sizeof(void *) - 1)) { // records hold pointers
+     pList++; iListSize--;
+  }
+  if (iListSize < (int)sizeof(DLCMD))
+     return -1;
+  pDisplayList = pList;
+  iDLSize = iListSize;
+  iDLUsed = 0;
+  iDLPageHeight = iPageHeight;
+  ucDLFill = 0;
+  iDLMode = DL_MODE_RECORD;
+  return 0;
+} /* tpBeginDisplayList() */
+//
+// Stop recording and return to drawing directly into the back buffer
+//
+void tpEndDisplayList(void)
+{
+  iDLMode = DL_MODE_OFF;
+  pDisplayList = NULL;
+  bb_top = 0;
+} /* tpEndDisplayList() */
+//
+// Return the number of bytes used by the display list
+//
+int tpGetDisplayListSize(void)
+{
+  return (pDisplayList) ? iDLUsed : 0;
+} /* tpGetDisplayListSize() */
+//
+// Append a command to the display list
+// pExtra/iLen is copied after the header (strings, polygon points)
+// returns 0 for success, -1 if the list is full
+//
+static int tpDLAdd(uint8_t ucType, uint8_t ucColor, int iTop, int iBottom, int x1, int y1, int x2, int y2, const void *pData, const void *pExtra, int iLen)
+{
+DLCMD cmd;
+int iSize;
+
+  if (pExtra == NULL) iLen = 0;
+  iSize = (sizeof(DLCMD) + iLen + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+  if (iDLUsed + iSize > iDLSize || iSize > 0xffff)
+     return -1; // out of space
+  cmd.pData = pData;
+  cmd.u16Size = (uint16_t)iSize;
+  cmd.ucType = ucType;
+  cmd.ucColor = ucColor;
+  cmd.iTop = (int16_t)iTop; cmd.iBottom = (int16_t)iBottom;
+  cmd.x1 = (int16_t)x1; cmd.y1 = (int16_t)y1;
+  cmd.x2 = (int16_t)x2; cmd.y2 = (int16_t)y2;
+  memcpy(&pDisplayList[iDLUsed], &cmd, sizeof(DLCMD));
+  if (iLen)
+     memcpy(&pDisplayList[iDLUsed + sizeof(DLCMD)], pExtra, iLen);
+  iDLUsed += iSize;
+  return 0;
+} /* tpDLAdd() */
+//
+// Render the display list commands which touch the current band
+// The band occupies page rows bb_top to bb_top+bb_height-1
+//
+static void tpDLRenderBand(void)
+{
+DLCMD cmd;
+int iOff, iSave, iStyle;
+char *szMsg;
+
+  memset(pBackBuffer, ucDLFill, bb_pitch * bb_height);
+  tpSetAllDirty(ucDLFill != 0);
+  for (iOff = 0; iOff < iDLUsed; iOff += cmd.u16Size) {
+     memcpy(&cmd, &pDisplayList[iOff], sizeof(DLCMD));
+     if (cmd.iBottom < bb_top || cmd.iTop >= bb_top + bb_height)
+        continue; // doesn't touch this band
+     szMsg = (char *)&pDisplayList[iOff + sizeof(DLCMD)];
+     switch (cmd.ucType) {
+        case DL_PIXEL:
+           tpSetPixel(cmd.x1, cmd.y1, cmd.ucColor);
+           break;
+        case DL_LINE:
+           tpDrawLine(cmd.x1, cmd.y1, cmd.x2, cmd.y2, cmd.ucColor);
+           break;
+        case DL_TEXT:
+           iSave = tp_wrap;
+           iStyle = ucTextStyle;
+           tp_wrap = (cmd.ucColor >> 1) & 1;
+           ucTextStyle = cmd.ucColor >> 2;
+           tpDrawScaledText(cmd.x1, cmd.y1, szMsg, cmd.x2, cmd.y2, cmd.ucColor & 1);
+           tp_wrap = iSave;
+           ucTextStyle = iStyle;
+           break;
+        case DL_CUSTOMTEXT:
+           iStyle = ucTextStyle;
+           ucTextStyle = cmd.ucColor; // the style it was recorded with
+           tpDrawCustomText((GFXfont *)cmd.pData, cmd.x1, cmd.y1, szMsg);
+           ucTextStyle = iStyle;
+           break;
+        case DL_BMP:
+           tpLoadBMP((uint8_t *)cmd.pData, cmd.ucColor, cmd.x1, cmd.y1);
+           break;
+        case DL_RECT:
+           tpDrawRect(cmd.x1, cmd.y1, cmd.x2, cmd.y2, cmd.ucColor & 1, cmd.ucColor >> 1);
+           break;
+        case DL_POLY:
+           if (cmd.ucColor & 2)
+              tpFillPoints((TPPOINT *)szMsg, cmd.x1, cmd.y1, cmd.ucColor & 1);
+           else
+              tpOutlinePoints((TPPOINT *)szMsg, cmd.x1, cmd.ucColor >> 2, cmd.ucColor & 1);
+           break;
+        case DL_ELLIPSE:
+           tpDrawEllipse(cmd.x1, cmd.y1, cmd.x2, cmd.y2, cmd.ucColor & 1, cmd.ucColor >> 1);
+           break;
+        case DL_ROUNDRECT:
+           tpDrawRoundRect(cmd.x1, cmd.y1, cmd.x2, cmd.y2, *(int16_t *)szMsg, cmd.ucColor & 1, cmd.ucColor >> 1);
+           break;
+        case DL_ROTTEXT: // drawn with the text mode font it was recorded with
+           {
+           GFXfont *pSaveFont = pTextFont;
+           uint8_t ucSaveFont = ucTextFont, ucSaveScale = ucTextScale;
+           iStyle = ucTextStyle;
+           pTextFont = (GFXfont *)cmd.pData;
+           ucTextFont = cmd.y2 & 0xf; ucTextScale = cmd.y2 >> 4;
+           ucTextStyle = cmd.ucColor & 0xf;
+           tpRotatedRun(cmd.x1, cmd.y1 - bb_top, szMsg, (cmd.ucColor & 0x10) ? 270 : 90, cmd.x2, NULL, NULL);
+           pTextFont = pSaveFont; ucTextFont = ucSaveFont; ucTextScale = ucSaveScale;
+           ucTextStyle = iStyle;
+           }
+           break;
+     } // switch
+  } // for each command
+} /* tpDLRenderBand() */
+//
 // Turn text wrap on or off for the oldWriteString() function
 //
 void tpSetTextWrap(int bWrap)
@@ -212,6 +607,212 @@ uint8_t i;
    }
 } /* InvertBytes() */
 //
+// Character sets
+// Text is made of 8-bit character codes. The built-in 8x8 font has glyphs
+// for code page 437 and 852, selected at runtime. With UTF-8 enabled, each
+// code point is converted to the character code of the current code page
+// (or custom map) with a hash table lookup.
+//
+// Set the Unicode map used to convert UTF-8 text
+// pMap = Unicode values of the characters 0x80-0xFF (0 = not used)
+// This allows GFX fonts made for other code pages (e.g. Windows-1250)
+//
+void tpSetCharMap(const uint16_t *pMap)
+{
+int i, h;
+uint16_t u16;
+
+  memset(usMapKey, 0, sizeof(usMapKey));
+  for (i=0; i<128; i++) {
+    u16 = pgm_read_word(&pMap[i]);
+    if (u16 < 0x80) continue; // ASCII maps to itself
+    h = ((u16 * 40503UL) >> 8) & 0xff; // hash the code point
+    while (usMapKey[h] && usMapKey[h] != u16)
+      h = (h + 1) & 0xff;
+    if (usMapKey[h] == 0) { // first character wins if there are duplicates
+      usMapKey[h] = u16;
+      ucMapValue[h] = (uint8_t)(0x80 + i);
+    }
+  }
+  bMapValid = 1;
+  iCacheUsed = 0; // cached text may have used the old map
+} /* tpSetCharMap() */
+//
+// Select the code page of the built-in 8x8 font (CODEPAGE_437 or CODEPAGE_852)
+// It also sets the map used for UTF-8 text
+// returns 0 for success, -1 for an unknown code page
+//
+int tpSetCodePage(int iCodePage)
+{
+  if (iCodePage != CODEPAGE_437 && iCodePage != CODEPAGE_852)
+    return -1;
+  usCodePage = (uint16_t)iCodePage;
+  tpSetCharMap((iCodePage == CODEPAGE_437) ? usCP437 : usCP852);
+  bAdvanceValid = 0; // the glyphs may have changed
+  return 0;
+} /* tpSetCodePage() */
+//
+// Treat text as UTF-8 (1) or as 8-bit character codes (0, the default)
+//
+void tpSetUTF8(int bEnable)
+{
+  bUTF8 = (bEnable != 0);
+  bAdvanceValid = 0;
+} /* tpSetUTF8() */
+//
+// Find the extra info slot of a GFX font; optionally allocate one
+// returns the slot or -1
+//
+static int tpFindFontInfo(GFXfont *pFont, int bAdd)
+{
+int i, iFree = -1;
+
+  for (i=0; i<TP_MAX_FONT_INFO; i++) {
+    if (pInfoFont[i] == pFont)
+      return i;
+    if (pInfoFont[i] == NULL && iFree < 0) iFree = i;
+  }
+  if (bAdd && iFree >= 0) {
+    pInfoFont[iFree] = pFont;
+    pGlyphMap[iFree] = NULL;
+    ucFontFormat[iFree] = FONT_FORMAT_GFX;
+  }
+  return (bAdd) ? iFree : -1;
+} /* tpFindFontInfo() */
+//
+// Release the info slot if it only holds the defaults
+//
+static void tpCheckFontInfo(int i)
+{
+  if (pGlyphMap[i] == NULL && ucFontFormat[i] == FONT_FORMAT_GFX)
+    pInfoFont[i] = NULL;
+} /* tpCheckFontInfo() */
+//
+// Give a GFX font a table to look up its glyphs (sparse fonts)
+// pMap has 256 entries: the glyph index of each character code or 0xff
+// if the font doesn't have it. A font can then hold e.g. just ASCII and a
+// few accented letters. Pass NULL to remove the map. Up to 4 fonts.
+// returns 0 for success, -1 if there's no room
+//
+int tpSetGlyphMap(GFXfont *pFont, const uint8_t *pMap)
+{
+int i;
+
+  i = tpFindFontInfo(pFont, pMap != NULL);
+  if (i < 0)
+    return (pMap == NULL) ? 0 : -1;
+  pGlyphMap[i] = pMap;
+  tpCheckFontInfo(i);
+  bAdvanceValid = 0;
+  iCacheUsed = 0;
+  return 0;
+} /* tpSetGlyphMap() */
+//
+// Tell the library how the glyph bitmaps of a GFX font are stored
+// FONT_FORMAT_GFX = plain Adafruit_GFX bits (the default)
+// FONT_FORMAT_RLE = compressed by the tools/fontcomp converter
+// FONT_FORMAT_ROWS(_SHIFTED) = byte aligned rows from tools/fontcomp
+// returns 0 for success, -1 for an invalid format or no room
+//
+int tpSetFontFormat(GFXfont *pFont, int iFormat)
+{
+int i;
+
+  if (pFont == NULL || iFormat < FONT_FORMAT_GFX || iFormat > FONT_FORMAT_ROWS_SHIFTED)
+    return -1;
+  i = tpFindFontInfo(pFont, iFormat != FONT_FORMAT_GFX);
+  if (i < 0)
+    return (iFormat == FONT_FORMAT_GFX) ? 0 : -1;
+  ucFontFormat[i] = (uint8_t)iFormat;
+  tpCheckFontInfo(i);
+  iCacheUsed = 0;
+  return 0;
+} /* tpSetFontFormat() */
+//
+// Return the glyph map of a font (NULL if it uses first..last)
+//
+static const uint8_t *tpGetGlyphMap(GFXfont *pFont)
+{
+int i = tpFindFontInfo(pFont, 0);
+
+  return (i < 0) ? NULL : pGlyphMap[i];
+} /* tpGetGlyphMap() */
+//
+// Return the bitmap format of a font
+//
+static int tpGetFontFormat(GFXfont *pFont)
+{
+int i = tpFindFontInfo(pFont, 0);
+
+  return (i < 0) ? (int)FONT_FORMAT_GFX : (int)ucFontFormat[i];
+} /* tpGetFontFormat() */
+//
+// Return the glyph index of a character in a GFX font or -1 if it's not there
+//
+static int tpGlyphIndex(GFXfont *pFont, const uint8_t *pMap, uint8_t c)
+{
+  if (pMap) {
+    c = pgm_read_byte(&pMap[c]);
+    return (c == 0xff) ? -1 : c;
+  }
+  if (c < pFont->first || c > pFont->last) // undefined character
+    return -1;
+  return c - pFont->first;
+} /* tpGlyphIndex() */
+//
+// Convert a Unicode code point to a character code of the current code page
+// Characters which aren't in it become '?'
+//
+static uint8_t tpMapCodePoint(uint32_t u32)
+{
+int h;
+
+  if (u32 < 0x80)
+    return (uint8_t)u32;
+  if (u32 > 0xffff)
+    return '?';
+  if (!bMapValid)
+    tpSetCharMap((usCodePage == CODEPAGE_437) ? usCP437 : usCP852);
+  h = ((u32 * 40503UL) >> 8) & 0xff;
+  while (usMapKey[h]) {
+    if (usMapKey[h] == u32)
+      return ucMapValue[h];
+    h = (h + 1) & 0xff;
+  }
+  return '?';
+} /* tpMapCodePoint() */
+//
+// Return the next character code of a string and advance the index past it
+// Decodes UTF-8 (if enabled) so multi-byte sequences become one character
+//
+static uint8_t tpNextChar(const char *s, int *pIndex)
+{
+int i = *pIndex, iExtra;
+uint8_t c = (uint8_t)s[i++];
+uint32_t u32;
+
+  if (!bUTF8 || c < 0x80) {
+    *pIndex = i;
+    return c;
+  }
+  if ((c & 0xe0) == 0xc0) {
+    iExtra = 1; u32 = c & 0x1f;
+  } else if ((c & 0xf0) == 0xe0) {
+    iExtra = 2; u32 = c & 0x0f;
+  } else if ((c & 0xf8) == 0xf0) {
+    iExtra = 3; u32 = c & 0x07;
+  } else { // stray continuation byte
+    *pIndex = i;
+    return '?';
+  }
+  while (iExtra && ((uint8_t)s[i] & 0xc0) == 0x80) {
+    u32 = (u32 << 6) | (s[i++] & 0x3f);
+    iExtra--;
+  }
+  *pIndex = i;
+  return (iExtra) ? '?' : tpMapCodePoint(u32); // '?' if it was cut short
+} /* tpNextChar() */
+//
 // Return the measurements of a rectangle surrounding the given text string
 // rendered in the given font
 //
@@ -221,14 +822,15 @@ int cx = 0;
 int c, i = 0;
 GFXglyph *pGlyph;
 int miny, maxy;
+const uint8_t *pMap;
 
    if (width == NULL || top == NULL || bottom == NULL || pFont == NULL || szMsg == NULL) return; // bad pointers
+   pMap = tpGetGlyphMap(pFont);
    miny = 100; maxy = 0;
    while (szMsg[i]) {
-      c = szMsg[i++];
-      if (c < pFont->first || c > pFont->last) // undefined character
+      c = tpGlyphIndex(pFont, pMap, tpNextChar(szMsg, &i));
+      if (c < 0) // undefined character
          continue; // skip it
-      c -= pFont->first; // first char of font defined
       pGlyph = &pFont->glyph[c];
       cx += pGlyph->xAdvance;
       if (pGlyph->yOffset < miny) miny = pGlyph->yOffset;
@@ -240,69 +842,549 @@ int miny, maxy;
 } /* tpGetStringBox() */
 
 //
-// Draw a string of characters in a custom font into the gfx buffer
+// Glyph row decoder
+// Plain GFX glyphs are a continuous stream of bits (width x height, MSB first)
+// FONT_FORMAT_ROWS glyphs start each row on a byte boundary, so a row is a
+// straight copy. FONT_FORMAT_ROWS_SHIFTED glyphs hold 8 copies of those rows
+// (pitch = (width+14)/8 bytes), each shifted right by 0-7 pixels, so the
+// copy matching the destination bit offset can be ORed in whole bytes.
+// Compressed (FONT_FORMAT_RLE) glyphs store each row XOR'd with the row above
+// as alternating runs of unchanged / flipped pixels (starting with unchanged)
+// which flow from one row into the next. Each run length is coded in nibbles
+// (high nibble first):
+//   0-12 = length, 13 + n = 13-28, 14 + 2 nibbles = 29-284,
+//   15 + 4 nibbles = 16-bit length
+// Flipped runs are XOR'd into the previous row, so a row which repeats the
+// one above costs almost nothing.
 //
-int tpDrawCustomText(GFXfont *pFont, int x, int y, char *szMsg)
+typedef struct tag_tpglyphdec {
+  const uint8_t *s; // glyph data
+  int iWidth; // pixels in each decoded row
+  int iShift; // the row is pre-shifted right by this many pixels
+  int iPos; // GFX: bit offset, RLE: nibble offset, ROWS: byte offset
+  int iRun; // pixels left in the current run
+  uint8_t bFlip; // the current run flips pixels
+  uint8_t ucFormat;
+  uint8_t ucRow[34]; // current row (MSB first)
+} TPGLYPHDEC;
+//
+// Prepare to decode a glyph which will be drawn at x
+//
+static void tpGlyphStart(TPGLYPHDEC *pDec, GFXfont *pFont, GFXglyph *pGlyph, int iFormat, int x)
+{
+  pDec->s = pFont->bitmap + pGlyph->bitmapOffset;
+  pDec->iWidth = pGlyph->width;
+  pDec->iShift = 0;
+  pDec->iPos = pDec->iRun = 0;
+  pDec->bFlip = 1; // the first run read is 'unchanged'
+  pDec->ucFormat = (uint8_t)iFormat;
+  if (iFormat == FONT_FORMAT_ROWS_SHIFTED) { // pick the copy for this bit offset
+    pDec->iWidth = ((pGlyph->width + 14) >> 3) * 8;
+    pDec->iShift = x & 7;
+    pDec->s += pDec->iShift * pGlyph->height * (pDec->iWidth >> 3);
+  }
+  memset(pDec->ucRow, 0, (pDec->iWidth + 7) >> 3);
+} /* tpGlyphStart() */
+//
+// Read one nibble of compressed glyph data
+//
+static int tpGetNibble(TPGLYPHDEC *pDec)
+{
+uint8_t uc = pgm_read_byte(&pDec->s[pDec->iPos >> 1]);
+
+  if (pDec->iPos++ & 1)
+    return uc & 0xf;
+  return uc >> 4;
+} /* tpGetNibble() */
+//
+// Flip iLen pixels of a row starting at x
+//
+static void tpFlipBits(uint8_t *d, int x, int iLen)
+{
+uint8_t ucMask;
+int x2 = x + iLen; // end (exclusive)
+
+  d += (x >> 3);
+  if ((x & 7) + iLen < 8) { // within one byte
+    *d ^= (uint8_t)((0xff >> (x & 7)) & ~(0xff >> (x2 - (x & ~7))));
+    return;
+  }
+  if (x & 7) { // partial first byte
+    *d++ ^= (0xff >> (x & 7));
+    x = (x + 8) & ~7;
+  }
+  for (; x + 8 <= x2; x += 8)
+    *d++ ^= 0xff;
+  if (x < x2) {
+    ucMask = 0xff << (8 - (x2 - x));
+    *d ^= ucMask;
+  }
+} /* tpFlipBits() */
+//
+// Set iLen pixels of a row starting at x
+//
+static void tpSetBits(uint8_t *d, int x, int iLen)
+{
+int x2 = x + iLen; // end (exclusive)
+
+  d += (x >> 3);
+  if ((x & 7) + iLen < 8) { // within one byte
+    *d |= (uint8_t)((0xff >> (x & 7)) & ~(0xff >> (x2 - (x & ~7))));
+    return;
+  }
+  if (x & 7) { // partial first byte
+    *d++ |= (0xff >> (x & 7));
+    x = (x + 8) & ~7;
+  }
+  if (x2 - x >= 8) {
+    memset(d, 0xff, (x2 - x) >> 3);
+    d += (x2 - x) >> 3;
+    x += (x2 - x) & ~7;
+  }
+  if (x < x2)
+    *d |= (uint8_t)(0xff << (8 - (x2 - x)));
+} /* tpSetBits() */
+//
+// Decode the next row of a glyph into pDec->ucRow
+//
+static void tpGlyphNextRow(TPGLYPHDEC *pDec)
+{
+int i, n, iShift, iBytes;
+const uint8_t *s;
+
+  if (pDec->ucFormat >= FONT_FORMAT_ROWS) { // byte aligned rows
+    iBytes = (pDec->iWidth + 7) >> 3;
+    memcpy_P(pDec->ucRow, &pDec->s[pDec->iPos], iBytes);
+    pDec->iPos += iBytes;
+    return;
+  }
+  if (pDec->ucFormat == FONT_FORMAT_GFX) { // pick the row out of the bit stream a byte at a time
+    s = &pDec->s[pDec->iPos >> 3];
+    iShift = pDec->iPos & 7;
+    iBytes = (pDec->iWidth + 7) >> 3;
+    for (i=0; i<iBytes; i++) {
+      n = pgm_read_byte(&s[i]) << iShift;
+      if (iShift && (i * 8) + 8 - iShift < pDec->iWidth) // more bits are needed
+        n |= pgm_read_byte(&s[i+1]) >> (8 - iShift);
+      pDec->ucRow[i] = (uint8_t)n;
+    }
+    if (pDec->iWidth & 7)
+      pDec->ucRow[iBytes-1] &= (0xff << (8 - (pDec->iWidth & 7)));
+    pDec->iPos += pDec->iWidth;
+    return;
+  }
+  i = 0;
+  while (i < pDec->iWidth) {
+    if (pDec->iRun == 0) { // read the next run length
+      n = tpGetNibble(pDec);
+      if (n == 13) {
+        n += tpGetNibble(pDec);
+      } else if (n == 14) {
+        n = tpGetNibble(pDec) << 4;
+        n += 29 + tpGetNibble(pDec);
+      } else if (n == 15) {
+        n = tpGetNibble(pDec) << 12;
+        n |= tpGetNibble(pDec) << 8;
+        n |= tpGetNibble(pDec) << 4;
+        n |= tpGetNibble(pDec);
+      }
+      pDec->iRun = n;
+      pDec->bFlip ^= 1;
+      continue;
+    }
+    n = pDec->iWidth - i;
+    if (n > pDec->iRun) n = pDec->iRun;
+    if (pDec->bFlip)
+      tpFlipBits(pDec->ucRow, i, n);
+    i += n;
+    pDec->iRun -= n;
+  }
+} /* tpGlyphNextRow() */
+//
+// Draw a row of iBits pixels (MSB first) transparently (OR) into
+// a destination row iWidth pixels wide starting at x (clipped)
+//
+static void tpOrBits(const uint8_t *s, int iBits, int x, uint8_t *d, int iWidth)
+{
+uint8_t uc, ucCarry;
+int i, iShift;
+
+  if (x >= 0 && x + iBits <= iWidth) { // not clipped
+    d += (x >> 3);
+    iShift = x & 7;
+    if (iShift == 0) { // aligned (e.g. FONT_FORMAT_ROWS_SHIFTED)
+      for (i=0; i<iBits; i+=8)
+        *d++ |= *s++;
+      return;
+    }
+    ucCarry = 0;
+    for (i=0; i<iBits; i+=8) {
+      uc = *s++;
+      *d++ |= ucCarry | (uc >> iShift);
+      ucCarry = uc << (8 - iShift);
+    }
+    if (ucCarry) // only set if those pixels are inside
+      *d |= ucCarry;
+    return;
+  }
+  for (i=0; i<iBits; i+=8, x+=8) {
+    if (x + 8 <= 0) continue; // off the left edge
+    if (x >= iWidth) break; // off the right edge
+    uc = s[i>>3];
+    if (x < 0) uc &= (0xff >> -x);
+    if (x + 8 > iWidth) uc &= (0xff << (x + 8 - iWidth));
+    if (!uc) continue;
+    if (x >= 0) // a negative x only reaches the first byte
+      d[x>>3] |= uc >> (x & 7);
+    if ((x & 7) && (uint8_t)(uc << (8 - (x & 7)))) // don't touch past the edge
+      d[(x>>3)+1] |= uc << (8 - (x & 7));
+  }
+} /* tpOrBits() */
+//
+// Synthetic text styles
+// Any font can be made bold (each glyph row ORed with itself shifted one
+// pixel right), underlined or struck through (solid spans) and inverted
+// (the line box XOR'd) while its rows are drawn
+//
+// Rows covered by STYLE_UNDERLINE, STYLE_STRIKE or STYLE_INVERSE relative
+// to the top of the line; pFont = NULL for the built-in font iFontSize
+// enlarged by iScale
+//
+static void tpStyleRows(GFXfont *pFont, int iFontSize, int iScale, int iStyle, int *pTop, int *pRows)
+{
+int iHeight, iBase;
+
+  if (pFont == NULL) { // rows of the character cell
+    iHeight = ucCellHeight[iFontSize];
+    *pRows = iScale;
+    if (iStyle == STYLE_UNDERLINE)
+      *pTop = (iHeight - 1) * iScale; // bottom row
+    else if (iStyle == STYLE_STRIKE)
+      *pTop = ((iHeight * 3) / 8) * iScale; // middle of the capitals
+    else {
+      *pTop = 0; *pRows = iHeight * iScale;
+    }
+    return;
+  }
+  iHeight = pgm_read_byte(&pFont->yAdvance);
+  iBase = (iHeight * 2) / 3; // 2/3 of the line is above the baseline
+  *pRows = 1 + iHeight / 32; // line thickness
+  if (iStyle == STYLE_UNDERLINE)
+    *pTop = iBase + 1 + iHeight / 12;
+  else if (iStyle == STYLE_STRIKE)
+    *pTop = iBase - iHeight / 5;
+  else {
+    *pTop = 0; *pRows = iHeight;
+  }
+} /* tpStyleRows() */
+//
+// Widen the rows a custom font string covers (relative to the baseline,
+// bottom exclusive) to include the lines and box of its style
+//
+static void tpStyleExtent(GFXfont *pFont, int iStyle, int *pTop, int *pBottom)
+{
+int iBit, iTop, iRows, iBase = (pgm_read_byte(&pFont->yAdvance) * 2) / 3;
+
+  for (iBit = STYLE_UNDERLINE; iBit <= STYLE_INVERSE; iBit <<= 1) {
+    if (!(iStyle & iBit)) continue;
+    tpStyleRows(pFont, 0, 1, iBit, &iTop, &iRows);
+    if (iTop - iBase < *pTop) *pTop = iTop - iBase;
+    if (iTop - iBase + iRows > *pBottom) *pBottom = iTop - iBase + iRows;
+  }
+} /* tpStyleExtent() */
+//
+// Draw the underline and strikethrough (ORed) and then the inverse box
+// (XOR'd) of a custom font string into a 1-bpp buffer
+// x1-x2 (exclusive) = the pen travel, y = baseline
+//
+static void tpStyleSpans(GFXfont *pFont, int iStyle, int x1, int x2, int y, uint8_t *pDest, int iPitch, int iWidth, int iHeight, int bDirty)
 {
-int i, end_y, dx, dy, tx, ty, c, iBitOff;
-uint8_t *s, *d, bits, ucMask, ucClr, uc;
+int iBit, ty, iTop, iRows;
+
+  if (x1 < 0) x1 = 0;
+  if (x2 > iWidth) x2 = iWidth;
+  if (x1 >= x2) return;
+  y -= (pgm_read_byte(&pFont->yAdvance) * 2) / 3; // top of the line
+  for (iBit = STYLE_UNDERLINE; iBit <= STYLE_INVERSE; iBit <<= 1) {
+    if (!(iStyle & iBit)) continue;
+    tpStyleRows(pFont, 0, 1, iBit, &iTop, &iRows);
+    ty = y + iTop;
+    if (ty < 0) { iRows += ty; ty = 0; }
+    if (ty + iRows > iHeight) iRows = iHeight - ty;
+    if (iRows <= 0) continue;
+    if (bDirty)
+      tpMarkDirty(ty, ty + iRows - 1);
+    for (; iRows > 0; iRows--, ty++) {
+      if (iBit == STYLE_INVERSE)
+        tpFlipBits(&pDest[ty * iPitch], x1, x2 - x1);
+      else
+        tpSetBits(&pDest[ty * iPitch], x1, x2 - x1);
+    }
+  }
+} /* tpStyleSpans() */
+//
+// Draw a string in a custom font into any 1-bpp buffer (pixels are ORed)
+// x,y = start of the baseline; optionally marks the back buffer rows dirty
+// iStyle = STYLE_xxx flags
+//
+static void tpRenderCustomText(GFXfont *pFont, int x, int y, const char *szMsg, uint8_t *pDest, int iPitch, int iWidth, int iHeight, int bDirty, int iStyle)
+{
+int i, end_y, dx, dy, ty, c, iFormat, startx = x;
 GFXglyph glyph, *pGlyph;
+const uint8_t *pMap;
+TPGLYPHDEC dec;
 
-   if (pBackBuffer == NULL || pFont == NULL || x < 0 || y > bb_height)
-      return -1;
    pGlyph = &glyph;
+   pMap = tpGetGlyphMap(pFont);
+   iFormat = tpGetFontFormat(pFont);
 
    i = 0;
-   while (szMsg[i] && x < bb_width)
+   while (szMsg[i] && x < iWidth)
    {
-      c = szMsg[i++];
-      if (c < pFont->first || c > pFont->last) // undefined character
+      c = tpGlyphIndex(pFont, pMap, tpNextChar(szMsg, &i));
+      if (c < 0) // undefined character
          continue; // skip it
-      c -= pFont->first; // first char of font defined
       memcpy_P(&glyph, &pFont->glyph[c], sizeof(glyph));
       dx = x + pGlyph->xOffset; // offset from character UL to start drawing
       dy = y + pGlyph->yOffset;
-      s = pFont->bitmap + pGlyph->bitmapOffset; // start of bitmap data
-      // Bitmap drawing loop. Image is MSB first and each pixel is packed next
-      // to the next (continuing on to the next character line)
-      iBitOff = 0; // bitmap offset (in bits)
-      bits = uc = 0; // bits left in this font byte
       end_y = dy + pGlyph->height;
-      if (dy < 0) { // skip these lines
-          iBitOff += (pGlyph->width * (-dy));
-          dy = 0;
+      if (end_y > iHeight) end_y = iHeight;
+      if (dy < end_y && dx < iWidth && dx + pGlyph->width > 0) {
+         if (bDirty)
+            tpMarkDirty(dy, end_y - 1);
+         tpGlyphStart(&dec, pFont, pGlyph, iFormat, dx);
+         ty = dy;
+         if (ty < 0 && iFormat >= FONT_FORMAT_ROWS) { // jump to the first visible row
+            dec.iPos = -ty * ((dec.iWidth + 7) >> 3);
+            ty = 0;
+         }
+         for (; ty<end_y; ty++) {
+            tpGlyphNextRow(&dec); // rows above the destination are decoded and skipped
+            if (ty < 0) continue;
+            tpOrBits(dec.ucRow, dec.iWidth, dx - dec.iShift, &pDest[ty * iPitch], iWidth);
+            if (iStyle & STYLE_BOLD) // row | row >> 1
+               tpOrBits(dec.ucRow, dec.iWidth, dx - dec.iShift + 1, &pDest[ty * iPitch], iWidth);
+         }
       }
-      for (ty=dy; ty<=end_y && ty < bb_height; ty++) {
-         d = &pBackBuffer[ty * bb_pitch]; // internal buffer dest
-         for (tx=0; tx<pGlyph->width; tx++) {
-            if (uc == 0) { // need to read more font data
-               tx += bits; // skip any remaining 0 bits
-               uc = pgm_read_byte(&s[iBitOff>>3]); // get more font bitmap data
-               bits = 8 - (iBitOff & 7); // we might not be on a byte boundary
-               iBitOff += bits; // because of a clipped line
-               uc <<= (8-bits);
-               if (tx >= pGlyph->width) {
-                  while(tx >= pGlyph->width) { // rolls into next line(s)
-                     tx -= pGlyph->width;
-                     ty++;
-                  }
-                  if (ty >= end_y) { // we're past the end
-                     tx = pGlyph->width;
-                     continue; // exit this character cleanly
-                  }
-                  d = &pBackBuffer[ty * bb_pitch];
-               }
-            } // if we ran out of bits
-            if (uc & 0x80) { // set pixel
-               ucMask = 0x80 >> ((dx+tx) & 7);
-               d[(dx+tx)>>3] |= ucMask;
-            }
-            bits--; // next bit
-            uc <<= 1;
-         } // for x
-      } // for y
       x += pGlyph->xAdvance; // width of this character
    } // while drawing characters
+   if (iStyle & (STYLE_UNDERLINE | STYLE_STRIKE | STYLE_INVERSE))
+      tpStyleSpans(pFont, iStyle, startx, x, y, pDest, iPitch, iWidth, iHeight, bDirty);
+} /* tpRenderCustomText() */
+//
+// Rendered text cache
+// Provide memory to keep rendered custom font strings; the least recently
+// used ones are dropped when it's full. Pass NULL to turn it off.
+//
+void tpSetTextCache(uint8_t *pCache, int iSize)
+{
+  // keep the entries aligned for the header fields
+  while (pCache && ((uintptr_t)pCache & (sizeof(void *)-1)) && iSize > 0) {
+    pCache++;
+    iSize--;
+  }
+  pTextCache = (iSize > (int)sizeof(TPCACHEENTRY)) ? pCache : NULL;
+  iCacheSize = iSize;
+  iCacheUsed = 0;
+  u32CacheHits = u32CacheMisses = 0;
+} /* tpSetTextCache() */
+//
+// Return the cache statistics (any pointer can be NULL)
+//
+void tpGetTextCacheStats(int *pHits, int *pMisses, int *pBytesUsed)
+{
+  if (pHits) *pHits = (int)u32CacheHits;
+  if (pMisses) *pMisses = (int)u32CacheMisses;
+  if (pBytesUsed) *pBytesUsed = iCacheUsed;
+} /* tpGetTextCacheStats() */
+//
+// Remove the least recently used cache entry
+//
+static void tpCacheEvict(void)
+{
+TPCACHEENTRY *pEntry, *pOldest = NULL;
+int i, iSize;
+
+  for (i=0; i<iCacheUsed; i+=pEntry->u32Size) {
+    pEntry = (TPCACHEENTRY *)&pTextCache[i];
+    if (pOldest == NULL || (int32_t)(pEntry->u32LastUse - pOldest->u32LastUse) < 0)
+      pOldest = pEntry;
+  }
+  if (pOldest == NULL) return;
+  iSize = pOldest->u32Size;
+  i = (int)((uint8_t *)pOldest - pTextCache);
+  memmove(pOldest, &pTextCache[i + iSize], iCacheUsed - i - iSize); // close the gap
+  iCacheUsed -= iSize;
+} /* tpCacheEvict() */
+//
+// Measure the pixels a custom font string covers (with the given style)
+// x0-x1, y0-y1 relative to the start of the baseline (ends exclusive)
+// returns the pen travel
+//
+static int tpMeasureCustomText(GFXfont *pFont, const char *szMsg, int iStyle, int *px0, int *px1, int *py0, int *py1)
+{
+GFXglyph glyph;
+const uint8_t *pMap;
+int i, c, cx, x0, x1, y0, y1;
+
+  pMap = tpGetGlyphMap(pFont);
+  cx = 0; x0 = y0 = 0x7fff; x1 = y1 = -0x7fff;
+  i = 0;
+  while (szMsg[i]) {
+    c = tpGlyphIndex(pFont, pMap, tpNextChar(szMsg, &i));
+    if (c < 0) continue;
+    memcpy_P(&glyph, &pFont->glyph[c], sizeof(glyph));
+    if (glyph.width && glyph.height) {
+      if (cx + glyph.xOffset < x0) x0 = cx + glyph.xOffset;
+      if (cx + glyph.xOffset + glyph.width > x1) x1 = cx + glyph.xOffset + glyph.width;
+      if (glyph.yOffset < y0) y0 = glyph.yOffset;
+      if (glyph.yOffset + glyph.height > y1) y1 = glyph.yOffset + glyph.height;
+    }
+    cx += glyph.xAdvance;
+  }
+  if (iStyle & STYLE_BOLD) x1++; // smeared one pixel right
+  if (iStyle & (STYLE_UNDERLINE | STYLE_STRIKE | STYLE_INVERSE)) { // spans cover the pen travel
+    if (x0 > 0) x0 = 0;
+    if (x1 < cx) x1 = cx;
+    tpStyleExtent(pFont, iStyle, &y0, &y1);
+  }
+  if (x1 <= x0 || y1 <= y0) { // nothing visible
+    x0 = x1 = y0 = y1 = 0;
+  }
+  *px0 = x0; *px1 = x1; *py0 = y0; *py1 = y1;
+  return cx;
+} /* tpMeasureCustomText() */
+//
+// Cache key attributes: the character set and style the text is rendered
+// with, its rotation (0, 1 = 90, 2 = 270 degrees) and for the built-in
+// font (pFont = NULL) the text mode size and scale
+//
+static uint16_t tpCacheAttr(GFXfont *pFont, int iRotation)
+{
+uint16_t u16 = (uint16_t)((usCodePage == CODEPAGE_852) | (bUTF8 << 1) | (ucTextStyle << 2) | (iRotation << 6));
+
+  if (pFont == NULL)
+    u16 |= (uint16_t)((ucTextFont << 8) | ((ucTextScale - 1) << 10));
+  return u16;
+} /* tpCacheAttr() */
+//
+// Look for a string in the cache
+//
+static TPCACHEENTRY *tpCacheFind(GFXfont *pFont, const char *szMsg, uint16_t u16Attr)
+{
+TPCACHEENTRY *pEntry;
+uint32_t u32Hash = 2166136261UL;
+int i;
+
+  if (pTextCache == NULL)
+    return NULL;
+  for (i=0; szMsg[i]; i++) // FNV-1a hash of the string
+    u32Hash = (u32Hash ^ (uint8_t)szMsg[i]) * 16777619UL;
+  u32CacheTick++;
+  for (i=0; i<iCacheUsed; i+=pEntry->u32Size) {
+    pEntry = (TPCACHEENTRY *)&pTextCache[i];
+    if (pEntry->u32Hash == u32Hash && pEntry->pFont == pFont && pEntry->u16Attr == u16Attr &&
+        strcmp((char *)&pEntry[1], szMsg) == 0) {
+      pEntry->u32LastUse = u32CacheTick;
+      u32CacheHits++;
+      return pEntry;
+    }
+  }
+  u32CacheMisses++;
+  return NULL;
+} /* tpCacheFind() */
+//
+// Make a new cache entry with a blank image of iWidth x iHeight pixels
+// returns NULL if there's no cache or it doesn't fit
+//
+static TPCACHEENTRY *tpCacheAdd(GFXfont *pFont, const char *szMsg, uint16_t u16Attr, int x, int y, int iWidth, int iHeight)
+{
+TPCACHEENTRY *pEntry;
+uint32_t u32Hash = 2166136261UL;
+int iLen, iSize, iPitch;
+
+  if (pTextCache == NULL)
+    return NULL;
+  for (iLen=0; szMsg[iLen]; iLen++)
+    u32Hash = (u32Hash ^ (uint8_t)szMsg[iLen]) * 16777619UL;
+  iPitch = (iWidth + 7) >> 3;
+  iSize = (sizeof(TPCACHEENTRY) + iLen + 1 + iPitch * iHeight + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+  if (iSize > iCacheSize)
+    return NULL; // it would never fit
+  while (iCacheSize - iCacheUsed < iSize)
+    tpCacheEvict();
+  pEntry = (TPCACHEENTRY *)&pTextCache[iCacheUsed];
+  iCacheUsed += iSize;
+  pEntry->pFont = pFont;
+  pEntry->u32Hash = u32Hash;
+  pEntry->u32LastUse = u32CacheTick;
+  pEntry->u32Size = iSize;
+  pEntry->u16Attr = u16Attr;
+  pEntry->x = x; pEntry->y = y;
+  pEntry->iWidth = iWidth; pEntry->iHeight = iHeight;
+  memcpy(&pEntry[1], szMsg, iLen + 1);
+  memset((uint8_t *)&pEntry[1] + iLen + 1, 0, iPitch * iHeight);
+  return pEntry;
+} /* tpCacheAdd() */
+//
+// Find a string in the cache or render it into a new entry
+// returns NULL if there's no cache or it doesn't fit
+//
+static TPCACHEENTRY *tpCacheGet(GFXfont *pFont, const char *szMsg)
+{
+TPCACHEENTRY *pEntry;
+int x0, x1, y0, y1;
+uint16_t u16Attr = tpCacheAttr(pFont, 0);
+
+  if (pTextCache == NULL)
+    return NULL;
+  pEntry = tpCacheFind(pFont, szMsg, u16Attr);
+  if (pEntry)
+    return pEntry;
+  tpMeasureCustomText(pFont, szMsg, ucTextStyle, &x0, &x1, &y0, &y1);
+  pEntry = tpCacheAdd(pFont, szMsg, u16Attr, x0, y0, x1 - x0, y1 - y0);
+  if (pEntry)
+    tpRenderCustomText(pFont, -x0, -y0, szMsg, (uint8_t *)&pEntry[1] + strlen(szMsg) + 1, (x1 - x0 + 7) >> 3, x1 - x0, y1 - y0, 0, ucTextStyle);
+  return pEntry;
+} /* tpCacheGet() */
+//
+// Return a row of a cached image (row 0 = top of the image)
+//
+static uint8_t *tpCacheRow(TPCACHEENTRY *pEntry, int iRow)
+{
+  return (uint8_t *)&pEntry[1] + strlen((char *)&pEntry[1]) + 1 + iRow * ((pEntry->iWidth + 7) >> 3);
+} /* tpCacheRow() */
+//
+// Draw a string of characters in a custom font into the gfx buffer
+//
+int tpDrawCustomText(GFXfont *pFont, int x, int y, char *szMsg)
+{
+TPCACHEENTRY *pEntry;
+int ty, iRow;
+
+   if (pBackBuffer == NULL || pFont == NULL || x < 0 || y > tpPageHeight())
+      return -1;
+   if (iDLMode == DL_MODE_RECORD) {
+      int w, top, bottom;
+      tpGetStringBox(pFont, szMsg, &w, &top, &bottom);
+      if (ucTextStyle & (STYLE_UNDERLINE | STYLE_STRIKE | STYLE_INVERSE))
+         tpStyleExtent(pFont, ucTextStyle, &top, &bottom);
+      return tpDLAdd(DL_CUSTOMTEXT, ucTextStyle, y + top, y + bottom, x, y, 0, 0, pFont, szMsg, strlen(szMsg) + 1);
+   }
+   y -= bb_top; // band relative
+   pEntry = tpCacheGet(pFont, szMsg);
+   if (pEntry == NULL) { // not cached, draw the glyphs
+      tpRenderCustomText(pFont, x, y, szMsg, pBackBuffer, bb_pitch, bb_width, bb_height, 1, ucTextStyle);
+      return 0;
+   }
+   // blit the cached image
+   ty = y + pEntry->y;
+   tpMarkDirty(ty, ty + pEntry->iHeight - 1);
+   for (iRow=0; iRow<pEntry->iHeight; iRow++, ty++) {
+      if (ty < 0) continue;
+      if (ty >= bb_height) break;
+      tpOrBits(tpCacheRow(pEntry, iRow), pEntry->iWidth, x + pEntry->x, &pBackBuffer[ty * bb_pitch], bb_width);
+   }
    return 0;
 } /* tpDrawCustomText() */
 //
@@ -310,151 +1392,314 @@ GFXglyph glyph, *pGlyph;
 //
 int tpPrintCustomText(GFXfont *pFont, int startx, char *szMsg)
 {
-int i, x, y, end_y, dx, dy, tx, ty, c, iBitOff;
-int maxy, miny, height;
-uint8_t *s, *d, bits, ucMask, ucClr, uc;
-GFXglyph glyph, *pGlyph;
+int y;
+int maxy, miny;
 uint8_t ucTemp[80]; // max width of 1 scan line (576 pixels)
 int iPrintWidth = 384;
+TPCACHEENTRY *pEntry;
 
    if (!bConnected)
       return -1;
-   if (pFont == NULL || x < 0)
+   if (pFont == NULL || startx < 0)
       return -1;
-   pGlyph = &glyph;
-
-   // Get the size of the rectangle enclosing the text
-//   tpGetStringBox(pFont, szMsg, &tx, &miny, &maxy);
-//   height = (maxy - miny) + 1;
+   pEntry = tpCacheGet(pFont, szMsg);
 
-   tpPreGraphics(iPrintWidth, pFont->yAdvance);
+   tpBeginGraphics();
    miny = 0 - (pFont->yAdvance * 2)/3; // 2/3 of char is above the baseline
    maxy = pFont->yAdvance + miny;
    for (y=miny; y<=maxy; y++)
    {
-     i = 0;
-     x = startx;
      memset(ucTemp, 0, sizeof(ucTemp));
-     while (szMsg[i] && x < iPrintWidth)
-     {
-       c = szMsg[i++];
-       if (c < pFont->first || c > pFont->last) // undefined character
-         continue; // skip it
-       c -= pFont->first; // first char of font defined
-       memcpy_P(&glyph, &pFont->glyph[c], sizeof(glyph));
-       dx = x + pGlyph->xOffset; // offset from character UL to start drawing
-       dy = /*y +*/ pGlyph->yOffset;
-       s = pFont->bitmap + pGlyph->bitmapOffset; // start of bitmap data
-       // Bitmap drawing loop. Image is MSB first and each pixel is packed next
-       // to the next (continuing on to the next character line)
-       iBitOff = 0; // bitmap offset (in bits)
-       bits = uc = 0; // bits left in this font byte
-       end_y = dy + pGlyph->height;
-       for (ty=dy; ty<=end_y; ty++) {
-         for (tx=0; tx<pGlyph->width; tx++) {
-            if (uc == 0) { // need to read more font data
-               tx += bits; // skip any remaining 0 bits
-               uc = pgm_read_byte(&s[iBitOff>>3]); // get more font bitmap data
-               bits = 8 - (iBitOff & 7); // we might not be on a byte boundary
-               iBitOff += bits; // because of a clipped line
-               uc <<= (8-bits);
-               if (tx >= pGlyph->width) {
-                  while(tx >= pGlyph->width) { // rolls into next line(s)
-                     tx -= pGlyph->width;
-                     ty++;
-                  }
-                  if (ty >= end_y) { // we're past the end
-                     tx = pGlyph->width;
-                     continue; // exit this character cleanly
-                  }
-               }
-            } // if we ran out of bits
-            if (uc & 0x80 && ty == y) { // set pixel if we're drawing this line
-               ucMask = 0x80 >> ((dx+tx) & 7);
-               ucTemp[(dx+tx)>>3] |= ucMask;
-            }
-            bits--; // next bit
-            uc <<= 1;
-         } // for tx
-      } // for ty
-      x += pGlyph->xAdvance; // width of this character
-    } // while drawing characters
-    tpSendScanline(ucTemp, (iPrintWidth+7)/8); // send to printer 
+     if (pEntry) { // copy the line from the cached image
+       if (y >= pEntry->y && y < pEntry->y + pEntry->iHeight)
+         tpOrBits(tpCacheRow(pEntry, y - pEntry->y), pEntry->iWidth, startx + pEntry->x, ucTemp, iPrintWidth);
+     } else { // draw the glyph rows which touch this line (a 1 row buffer)
+       tpRenderCustomText(pFont, startx, -y, szMsg, ucTemp, sizeof(ucTemp), iPrintWidth, 1, 0, ucTextStyle);
+     }
+     tpSendScanline(ucTemp, (iPrintWidth+7)/8); // send to printer
   } // for each line of output
   tpPostGraphics();
   return 0;
 } /* tpPrintCustomText() */
 //
-// Draw text into the graphics buffer
+// Copy a row of iBits pixels (MSB first) to the back buffer at x,y (band row)
+// The pixels are opaque (0 bits clear the destination) and clipped
+// to the buffer width; x doesn't need to be byte aligned
 //
-int tpDrawText(int x, int y, char *szMsg, int iFontSize, int bInvert)
+static void tpCopyBits(uint8_t *s, int iBits, int x, int y)
 {
-int i, ty, iFontOff;
-unsigned char c, *s, *d, ucTemp[64];
+uint8_t *d, ucMask;
+uint16_t us, usMask;
+int i;
 
-    if (x == -1 || y == -1) // use the cursor position
-    {
-      x = iCursorX; y = iCursorY;
-    }
-    else
-    {
-      iCursorX = x; iCursorY = y; // set the new cursor position
+  d = &pBackBuffer[y * bb_pitch];
+  for (i=0; i<iBits; i+=8, x+=8) {
+    if (x + 8 <= 0) continue; // off the left edge
+    if (x >= bb_width) break; // off the right edge
+    ucMask = 0xff;
+    if (iBits - i < 8) ucMask <<= (8 - (iBits - i)); // partial last byte
+    if (x < 0) ucMask &= (0xff >> -x);
+    if (x + 8 > bb_width) ucMask &= (0xff << (x + 8 - bb_width));
+    us = ((uint16_t)(s[i>>3] & ucMask) << 8) >> (x & 7);
+    usMask = ((uint16_t)ucMask << 8) >> (x & 7);
+    if (usMask >> 8)
+      d[x>>3] = (d[x>>3] & ~(usMask >> 8)) | (us >> 8);
+    if (usMask & 0xff)
+      d[(x>>3)+1] = (d[(x>>3)+1] & ~usMask) | (uint8_t)us;
+  }
+} /* tpCopyBits() */
+//
+// Widen a row of 1-bpp pixels by an integer factor (1-4)
+// using the bit expansion tables
+//
+static void tpExpandBits(uint8_t *s, int iBytes, int iScale, uint8_t *d)
+{
+int i;
+uint16_t us;
+uint32_t u32;
+
+  for (i=0; i<iBytes; i++) {
+    switch (iScale) {
+      case 1:
+        *d++ = s[i];
+        break;
+      case 2:
+        us = pgm_read_word(&usExpand2[s[i]]);
+        *d++ = (uint8_t)(us >> 8); *d++ = (uint8_t)us;
+        break;
+      case 3:
+        u32 = ((uint32_t)pgm_read_word(&usExpand3[s[i] >> 4]) << 12) | pgm_read_word(&usExpand3[s[i] & 0xf]);
+        *d++ = (uint8_t)(u32 >> 16); *d++ = (uint8_t)(u32 >> 8); *d++ = (uint8_t)u32;
+        break;
+      case 4: // 2x twice
+        us = pgm_read_word(&usExpand2[s[i]]);
+        u32 = ((uint32_t)pgm_read_word(&usExpand2[us >> 8]) << 16) | pgm_read_word(&usExpand2[us & 0xff]);
+        *d++ = (uint8_t)(u32 >> 24); *d++ = (uint8_t)(u32 >> 16);
+        *d++ = (uint8_t)(u32 >> 8); *d++ = (uint8_t)u32;
+        break;
+    }
+  }
+} /* tpExpandBits() */
+//
+// Smooth upscaling of the 8x8 font (Scale2x / Scale3x, also known as EPX)
+// An output pixel takes the color of a neighbor instead of the center
+// pixel where the neighbors form a diagonal edge, which rounds off the
+// staircase of plain pixel doubling. It works on 8 pixels at once with
+// bit operations: for the source row E, B and H are the rows above and
+// below, D/F are E shifted to line up the left/right neighbors, and
+// A,C / G,I are the corners (B and H shifted).
+//
+#define TP_SMOOTH_CACHE 16 // recently smoothed glyphs (indexed by the low bits of the code)
+typedef struct tag_tpsmoothglyph {
+  uint8_t c; // character code
+  uint8_t ucFactor; // 2 or 3 (0 = empty)
+  uint16_t usCodePage;
+  uint8_t ucData[72]; // 16x16 or 24x24 pixels
+} TPSMOOTHGLYPH;
+static TPSMOOTHGLYPH tpSmoothCache[TP_SMOOTH_CACHE];
+#define SELECT(m, a, b) (uint8_t)(((m) & (a)) | (~(m) & (b)))
+#define EXPAND3(b) (((uint32_t)pgm_read_word(&usExpand3[(b) >> 4]) << 12) | pgm_read_word(&usExpand3[(b) & 0xf]))
+//
+// Enlarge an 8x8 glyph 2x (16x16, 32 bytes) or 3x (24x24, 72 bytes)
+//
+static void tpSmoothGlyph(const uint8_t *s, int iFactor, uint8_t *d)
+{
+int y;
+uint8_t A, B, C, D, E, F, G, H, I;
+uint8_t E0, E1, E2, E3, E5, E6, E7, E8, m0, m2, m6, m8;
+uint16_t us;
+uint32_t u32, u32a, u32b, u32c;
+
+  for (y=0; y<8; y++) {
+    E = s[y];
+    B = (y > 0) ? s[y-1] : 0;
+    H = (y < 7) ? s[y+1] : 0;
+    D = E >> 1; F = E << 1; // MSB = leftmost pixel
+    // where the corner pixels take the neighbor's color
+    m0 = ~(D ^ B) & (B ^ F) & (D ^ H); // upper left
+    m2 = ~(B ^ F) & (B ^ D) & (F ^ H); // upper right
+    m6 = ~(D ^ H) & (D ^ B) & (H ^ F); // lower left
+    m8 = ~(H ^ F) & (D ^ H) & (B ^ F); // lower right
+    if (iFactor == 2) { // interleave the left and right output pixels
+      us = (pgm_read_word(&usExpand2[SELECT(m0, D, E)]) & 0xaaaa) | (pgm_read_word(&usExpand2[SELECT(m2, F, E)]) & 0x5555);
+      d[0] = (uint8_t)(us >> 8); d[1] = (uint8_t)us;
+      us = (pgm_read_word(&usExpand2[SELECT(m6, D, E)]) & 0xaaaa) | (pgm_read_word(&usExpand2[SELECT(m8, F, E)]) & 0x5555);
+      d[2] = (uint8_t)(us >> 8); d[3] = (uint8_t)us;
+      d += 4;
+      continue;
+    }
+    A = B >> 1; C = B << 1; G = H >> 1; I = H << 1;
+    E0 = SELECT(m0, D, E);
+    E1 = SELECT((m0 & (E ^ C)) | (m2 & (E ^ A)), B, E);
+    E2 = SELECT(m2, F, E);
+    E3 = SELECT((m0 & (E ^ G)) | (m6 & (E ^ A)), D, E);
+    E5 = SELECT((m2 & (E ^ I)) | (m8 & (E ^ C)), F, E);
+    E6 = SELECT(m6, D, E);
+    E7 = SELECT((m6 & (E ^ I)) | (m8 & (E ^ G)), H, E);
+    E8 = SELECT(m8, F, E);
+    // 3 rows of 3 interleaved output pixels
+    u32a = EXPAND3(E0); u32b = EXPAND3(E1); u32c = EXPAND3(E2);
+    u32 = (u32a & 0x924924) | (u32b & 0x492492) | (u32c & 0x249249);
+    d[0] = (uint8_t)(u32 >> 16); d[1] = (uint8_t)(u32 >> 8); d[2] = (uint8_t)u32;
+    u32a = EXPAND3(E3); u32b = EXPAND3(E); u32c = EXPAND3(E5);
+    u32 = (u32a & 0x924924) | (u32b & 0x492492) | (u32c & 0x249249);
+    d[3] = (uint8_t)(u32 >> 16); d[4] = (uint8_t)(u32 >> 8); d[5] = (uint8_t)u32;
+    u32a = EXPAND3(E6); u32b = EXPAND3(E7); u32c = EXPAND3(E8);
+    u32 = (u32a & 0x924924) | (u32b & 0x492492) | (u32c & 0x249249);
+    d[6] = (uint8_t)(u32 >> 16); d[7] = (uint8_t)(u32 >> 8); d[8] = (uint8_t)u32;
+    d += 9;
+  }
+} /* tpSmoothGlyph() */
+//
+// Copy the glyph of a character in the built-in font of the current code page
+// 8 bytes for FONT_SMALL, 64 for FONT_LARGE, 32 for FONT_SMOOTH2X, 72 for FONT_SMOOTH3X
+//
+static void tpGetGlyph(uint8_t c, int iFontSize, uint8_t *pGlyph)
+{
+const uint8_t *s;
+uint8_t ucTemp[8];
+TPSMOOTHGLYPH *pEntry;
+int i, iFactor;
+
+  if (c < 32) c = ' '; // control characters don't have glyphs
+  s = (usCodePage == CODEPAGE_852) ? ucFont852 : ucFont;
+  s += (c - 32) * 8;
+  if (iFontSize == FONT_SMALL) {
+    memcpy_P(pGlyph, s, 8);
+    return;
+  }
+#ifndef TP_NO_BIG_FONT
+  if (iFontSize == FONT_LARGE && (c < 0x80 || usCodePage == CODEPAGE_437)) {
+    memcpy_P(pGlyph, &ucBigFont[(c - 32) * 64], 64);
+    return;
+  }
+#endif
+  // smooth the 8x8 glyph (the large font only has the 437 characters)
+  iFactor = (iFontSize == FONT_SMOOTH3X) ? 3 : 2;
+  pEntry = &tpSmoothCache[c & (TP_SMOOTH_CACHE - 1)];
+  if (pEntry->c != c || pEntry->ucFactor != iFactor || pEntry->usCodePage != usCodePage) {
+    memcpy_P(ucTemp, s, 8);
+    tpSmoothGlyph(ucTemp, iFactor, pEntry->ucData);
+    pEntry->c = c;
+    pEntry->ucFactor = (uint8_t)iFactor;
+    pEntry->usCodePage = usCodePage;
+  }
+  if (iFontSize == FONT_LARGE) { // 16x16 with the rows doubled
+    for (i=0; i<16; i++) {
+      memcpy(&pGlyph[i*4], &pEntry->ucData[i*2], 2);
+      memcpy(&pGlyph[i*4+2], &pEntry->ucData[i*2], 2);
+    }
+  } else {
+    memcpy(pGlyph, pEntry->ucData, iFactor * iFactor * 8);
+  }
+} /* tpGetGlyph() */
+//
+// Apply the bold, underline and strikethrough styles to a built-in font
+// glyph before it's enlarged, so the lines scale with it
+//
+static void tpStyleGlyph(uint8_t *pGlyph, int iFontSize)
+{
+int i, y, iTop, iRows, iBytes, iHeight;
+uint8_t *s;
+
+  iBytes = ucCellWidth[iFontSize] / 8;
+  iHeight = ucCellHeight[iFontSize];
+  if (ucTextStyle & STYLE_BOLD) { // row | row >> 1
+    for (y=0; y<iHeight; y++) {
+      s = &pGlyph[y * iBytes];
+      for (i=iBytes-1; i>0; i--) // right to left so the carry comes from the unchanged byte
+        s[i] |= (s[i] >> 1) | (s[i-1] << 7);
+      s[0] |= (s[0] >> 1);
+    }
+  }
+  if (ucTextStyle & STYLE_UNDERLINE) {
+    tpStyleRows(NULL, iFontSize, 1, STYLE_UNDERLINE, &iTop, &iRows);
+    memset(&pGlyph[iTop * iBytes], 0xff, iBytes);
+  }
+  if (ucTextStyle & STYLE_STRIKE) {
+    tpStyleRows(NULL, iFontSize, 1, STYLE_STRIKE, &iTop, &iRows);
+    memset(&pGlyph[iTop * iBytes], 0xff, iBytes);
+  }
+} /* tpStyleGlyph() */
+//
+// Get a built-in font glyph with the text style applied (up to 72 bytes)
+//
+static void tpPrepGlyph(uint8_t c, int iFontSize, int bInvert, uint8_t *pGlyph)
+{
+  tpGetGlyph(c, iFontSize, pGlyph);
+  if (ucTextStyle & (STYLE_BOLD | STYLE_UNDERLINE | STYLE_STRIKE))
+    tpStyleGlyph(pGlyph, iFontSize);
+  if ((bInvert != 0) ^ ((ucTextStyle & STYLE_INVERSE) != 0))
+    InvertBytes(pGlyph, (ucCellWidth[iFontSize] / 8) * ucCellHeight[iFontSize]);
+} /* tpPrepGlyph() */
+//
+// Draw text into the graphics buffer
+//
+int tpDrawText(int x, int y, char *szMsg, int iFontSize, int bInvert)
+{
+  return tpDrawScaledText(x, y, szMsg, iFontSize, 1, bInvert);
+} /* tpDrawText() */
+//
+// Draw text into the graphics buffer enlarged by an integer factor (1-4)
+// The characters don't need to start on a byte boundary
+//
+int tpDrawScaledText(int x, int y, char *szMsg, int iFontSize, int iScale, int bInvert)
+{
+int i, ty, iRow, iRep, iCharWidth, iCharHeight, iBytes, iPageHeight;
+unsigned char c, *s, ucTemp[72], ucRow[12];
+
+    if (iScale < 1 || iScale > 4)
+       return -1;
+    if (x == -1 || y == -1) // use the cursor position
+    {
+      x = iCursorX; y = iCursorY;
+    }
+    else
+    {
+      iCursorX = x; iCursorY = y; // set the new cursor position
     }
-    if (iCursorX >= bb_width || iCursorY >= bb_height-7)
+    if (iFontSize < FONT_SMALL || iFontSize > FONT_SMOOTH3X)
+       return -1;
+    iCharWidth = ucCellWidth[iFontSize]; iCharHeight = ucCellHeight[iFontSize];
+    iBytes = iCharWidth / 8; // source bytes per glyph row
+    iCharWidth *= iScale; iCharHeight *= iScale;
+    iPageHeight = tpPageHeight();
+    if (iCursorX >= bb_width || iCursorY > iPageHeight-iCharHeight)
        return -1; // can't draw off the display
 
-    if (iFontSize == FONT_SMALL) // 8x8 font
+    i = 0;
+    while (iCursorX < bb_width && iCursorY <= iPageHeight-iCharHeight && szMsg[i] != 0)
     {
-       i = 0;
-       while (iCursorX < bb_width && szMsg[i] != 0 && iCursorY < bb_height)
-       {
-          c = (unsigned char)szMsg[i];
-          iFontOff = (int)(c-32) * 8;
-          memcpy(ucTemp, &ucFont[iFontOff], 8);
-          if (bInvert) InvertBytes(ucTemp, 8);
-          d = &pBackBuffer[(iCursorY * bb_pitch) + iCursorX/8];
-          for (ty=0; ty<8; ty++)
-          {
-             d[0] = ucTemp[ty];
-             d += bb_pitch;
-          }
-          iCursorX += 8;
-          if (iCursorX >= bb_width && tp_wrap) // word wrap enabled?
+       c = tpNextChar(szMsg, &i);
+       iRow = iCursorY - bb_top; // band relative
+       if (iDLMode != DL_MODE_RECORD && iRow < bb_height && iRow + iCharHeight > 0) {
+          tpPrepGlyph(c, iFontSize, bInvert, ucTemp);
+          tpMarkDirty(iRow, iRow + iCharHeight - 1);
+          s = ucTemp;
+          for (ty=0; ty<iCharHeight; ty += iScale)
           {
-             iCursorX = 0; // start at the beginning of the next line
-             iCursorY +=8;
+             tpExpandBits(s, iBytes, iScale, ucRow);
+             for (iRep=0; iRep<iScale; iRep++) { // repeat the row vertically
+                if (iRow+ty+iRep >= 0 && iRow+ty+iRep < bb_height) // clip to the band
+                   tpCopyBits(ucRow, iCharWidth, iCursorX, iRow+ty+iRep);
+             }
+             s += iBytes;
           }
-       i++;
-       } // while
-    return 0;
-    } // 8x8
-    else if (iFontSize == FONT_LARGE) // 16x32 font
+       }
+       iCursorX += iCharWidth;
+       if (iCursorX >= bb_width && tp_wrap) // word wrap enabled?
+       {
+          iCursorX = 0; // start at the beginning of the next line
+          iCursorY += iCharHeight;
+       }
+    } // while
+    if (iDLMode == DL_MODE_RECORD) // the loop above only moved the cursor
     {
-      i = 0;
-      while (iCursorX < bb_width && iCursorY < bb_height-31 && szMsg[i] != 0)
-      {
-          s = (unsigned char *)&ucBigFont[(unsigned char)(szMsg[i]-32)*64];
-          memcpy(ucTemp, s, 64);
-          if (bInvert) InvertBytes(ucTemp, 64);
-          d = &pBackBuffer[(iCursorY * bb_pitch) + iCursorX/8];
-          for (ty=0; ty<32; ty++)
-          {
-             d[0] = s[0];
-             d[1] = s[1];
-             s += 2; d += bb_pitch;
-          }
-          iCursorX += 16;
-          if (iCursorX >= bb_width && tp_wrap) // word wrap enabled?
-          {
-             iCursorX = 0; // start at the beginning of the next line
-             iCursorY += 32;
-          }
-          i++;
-       } // while
-       return 0;
-    } // 16x32
-   return -1;
-} /* tpDrawText() */
+       ty = (iCursorX == 0) ? iCursorY - 1 : iCursorY + iCharHeight - 1;
+       return tpDLAdd(DL_TEXT, (bInvert != 0) | (tp_wrap << 1) | (ucTextStyle << 2), y, ty, x, y, iFontSize, iScale, NULL, szMsg, strlen(szMsg) + 1);
+    }
+    return 0;
+} /* tpDrawScaledText() */
 //
 // Set (or clear) an individual pixel
 //
@@ -464,6 +1709,12 @@ uint8_t *d, mask;
 
   if (pBackBuffer == NULL)
      return -1;
+  if (iDLMode == DL_MODE_RECORD)
+     return tpDLAdd(DL_PIXEL, ucColor, y, y, x, y, 0, 0, NULL, NULL, 0);
+  y -= bb_top; // band relative
+  if (x < 0 || x >= bb_width || y < 0 || y >= bb_height)
+     return -1;
+  tpMarkDirty(y, y);
   d = &pBackBuffer[(bb_pitch * y) + (x >> 3)];
   mask = 0x80 >> (x & 7);
   if (ucColor)
@@ -496,11 +1747,15 @@ uint8_t bFlipped = false;
   cy = pBMP[22] + (pBMP[23] << 8);
   if (cy > 0) // BMP is flipped vertically (typical)
      bFlipped = true;
-  if (cx + iXOffset > bb_width || cy + iYOffset > bb_height) // too big
+  if (cx + iXOffset > bb_width || abs(cy) + iYOffset > tpPageHeight()) // too big
      return -1;
   i16 = pBMP[28] + (pBMP[29] << 8);
   if (i16 != 1) // must be 1 bit per pixel
      return -1;
+  if (iDLMode == DL_MODE_RECORD)
+     return tpDLAdd(DL_BMP, (uint8_t)bInvert, iYOffset, iYOffset + abs(cy) - 1, iXOffset, iYOffset, 0, 0, pBMP, NULL, 0);
+  iYOffset -= bb_top; // band relative
+  tpMarkDirty(iYOffset, iYOffset + abs(cy) - 1);
   iOffBits = pBMP[10] + (pBMP[11] << 8);
   iPitch = (cx + 7) >> 3; // byte width
   iPitch = (iPitch + 3) & 0xfffc; // must be a multiple of DWORDS
@@ -518,6 +1773,8 @@ uint8_t bFlipped = false;
 // Send it to the gfx buffer
      for (y=0; y<cy; y++)
      {
+         if (iYOffset+y < 0 || iYOffset+y >= bb_height)
+            continue; // clip to the band
          s = &pBMP[iOffBits + (y * iPitch)]; // source line
          d = &pBackBuffer[((iYOffset+y) * bb_pitch) + iXOffset/8];
          srcmask = 0x80; dstmask = 0x80 >> (iXOffset & 7);
@@ -763,6 +2020,10 @@ int tpConnect(const char *szMacAddress)
 void tpDisconnect(void)
 {
   if (!bConnected) return;
+  if (bStreaming) { // finish the text mode output
+    if (iLineLen) tpFlushLine(0);
+    tpPostGraphics();
+  }
   if (pX18Client != nullptr) {
       pX18Client->disconnect();
       bConnected = 0;
@@ -925,11 +2186,19 @@ int tpGetWidth(void)
 } /* tpGetWidth() */
 //
 // Feed the paper in scanline increments
+// Also ends the print session left open by the streamed output
+// (tpPrint() and friends); inside tpBeginImage()/tpEndImage() it just feeds
 //
 void tpFeed(int iLines)
 {
   if (!bConnected || iLines < 0 || iLines > 255)
     return;
+  if (iLineLen) // finish any text waiting in the line buffer first
+    tpFlushLine(0);
+  if (bStreaming && !bImageOpen) { // end the streamed text/graphics
+    iBlankRows = 0; // the feed takes care of the white space
+    tpPostGraphics();
+  }
   tpWriteCatCommandD16(paperFeed,iLines);
 } /* tpFeed() */
 //
@@ -951,6 +2220,7 @@ static void tpPreGraphics(int iWidth, int iHeight)
 
 static void tpPostGraphics(void)
 {
+   bStreaming = 0;
    tpSendX18LatticeEnd();
    tpWriteCatCommandD8(0xbd, 0x08);
    tpWriteCatCommandD16(0xa1, 0x0080);
@@ -968,32 +2238,111 @@ static void tpSendScanline(uint8_t *s, int iLen)
       delay(30);
 } /* tpSendScanline() */
 
+//
+// Send the pending blank rows as paper feeds
+//
+static void tpSendBlankRows(void)
+{
+int iFeed;
+
+  while (iBlankRows) {
+    iFeed = (iBlankRows > 255) ? 255 : iBlankRows;
+    tpWriteCatCommandD16(paperFeed, iFeed);
+    iBlankRows -= iFeed;
+  }
+} /* tpSendBlankRows() */
+//
+// Start sending graphics
+// Sends the printer init sequence the first time; if text lines are
+// being streamed, the pending text is finished and the same session is used
+//
+static void tpBeginGraphics(void)
+{
+  if (!bPrinterInit) {
+    tpInitX18_9556();
+    bPrinterInit = 1;
+  }
+  if (bStreaming) {
+    if (iLineLen) tpFlushLine(0);
+    tpSendBlankRows();
+  } else {
+    tpPreGraphics(bb_width, tpPageHeight());
+  }
+  iBlankRows = 0;
+  bRowsStarted = 0;
+} /* tpBeginGraphics() */
+//
+// Send the blank rows waiting in front of the next row of pixels
+//
+static void tpSendPendingRows(int iPitch)
+{
+uint8_t ucBlank[80];
+
+  if (iBlankRows >= TP_MIN_FEED_ROWS) {
+    tpSendBlankRows();
+  } else if (iBlankRows) { // too short to bother with a feed command
+    memset(ucBlank, 0, sizeof(ucBlank));
+    while (iBlankRows) {
+      tpSendScanline(ucBlank, iPitch);
+      iBlankRows--;
+    }
+  }
+} /* tpSendPendingRows() */
+//
+// Send a row of pixels after the blank rows waiting in front of it
+//
+static void tpSendRow(uint8_t *s, int iPitch)
+{
+  tpSendPendingRows(iPitch);
+  tpSendScanline(s, iPitch);
+  bRowsStarted = 1;
+} /* tpSendRow() */
+//
+// Send the first iCount rows of the back buffer
+// Rows which weren't drawn are skipped at the top and bottom of the page;
+// runs of them in between are sent as a paper feed instead of blank lines
+//
+static void tpSendDirtyRows(int iCount)
+{
+int y;
+
+  for (y=0; y<iCount; y++) {
+    if (!tpRowDirty(y)) {
+      if (bRowsStarted) iBlankRows++; // leading blank rows are dropped
+      continue;
+    }
+    tpSendRow(&pBackBuffer[y * bb_pitch], bb_pitch);
+  } // for y
+} /* tpSendDirtyRows() */
 //
 // Send the graphics to the printer (must be connected over BLE first)
+// Only the rows which were drawn since tpFill(0) are sent
 //
 void tpPrintBuffer(void)
 {
-    uint8_t *s, ucTemp[8];
     int y;
-    int i;
 
-    if (!bConnected)
+    if (!bConnected || pBackBuffer == NULL)
         return;
 
-    static bool bInitialized = false;
-    if (!bInitialized) {
-        tpInitX18_9556();
-        bInitialized = true;
-    }
-
-    tpPreGraphics(bb_width, bb_height);
+    tpBeginGraphics();
 
+  if (iDLMode == DL_MODE_RECORD) {
+    // Render and send the display list one band at a time
+    int16_t iSaveX = iCursorX, iSaveY = iCursorY;
+    iDLMode = DL_MODE_REPLAY;
+    for (bb_top = 0; bb_top < iDLPageHeight; bb_top += bb_height) {
+      tpDLRenderBand();
+      y = iDLPageHeight - bb_top;
+      tpSendDirtyRows((y < bb_height) ? y : bb_height);
+    } // for each band
+    bb_top = 0;
+    iDLMode = DL_MODE_RECORD;
+    iCursorX = iSaveX; iCursorY = iSaveY;
+  } else {
   // Print the graphics
-  s = pBackBuffer;
-  for (y=0; y<bb_height; y++) {
-    tpSendScanline(s, bb_pitch);
-    s += bb_pitch;
-  } // for y
+    tpSendDirtyRows(bb_height);
+  }
   
   tpPostGraphics();
 
@@ -1005,10 +2354,10 @@ uint8_t *s;
 int x, y;
 uint8_t line[bb_pitch] = {0};
 
-  if (!bConnected)
+  if (!bConnected || iDLMode != DL_MODE_OFF) // needs the whole page in RAM
     return;
 
-  tpPreGraphics(bb_height, bb_width);
+  tpBeginGraphics();
   // Print the graphics
   s = pBackBuffer;
   for (y=0; y<bb_width; y++) {
@@ -1024,115 +2373,3491 @@ uint8_t line[bb_pitch] = {0};
 } /* tpPrintBufferSide() */
 
 //
-// Draw a line between 2 points
+// Text mode
+// Characters are collected into a line until a newline (or the line is full),
+// then the line is rendered into a small strip buffer a few rows at a time
+// and sent to the printer. The back buffer isn't used, so text of any
+// length can be printed with very little RAM.
 //
-void tpDrawLine(int x1, int y1, int x2, int y2, uint8_t ucColor)
+//
+// Build the table of character advances for the text mode font
+// Measuring text is then a single table lookup per character
+//
+static void tpBuildAdvances(void)
 {
-  int temp;
-  int dx = x2 - x1;
-  int dy = y2 - y1;
-  int error;
-  uint8_t *p, mask;
-  int xinc, yinc;
-
-  if (x1 < 0 || x2 < 0 || y1 < 0 || y2 < 0 || x1 >= bb_width || x2 >= bb_width || y1 >= bb_height || y2 >= bb_height)
-     return;
+int c, iGlyph;
+GFXglyph *pGlyph;
+const uint8_t *pMap = NULL;
 
-  if(abs(dx) > abs(dy)) {
-    // X major case
-    if(x2 < x1) {
-      dx = -dx;
-      temp = x1;
-      x1 = x2;
-      x2 = temp;
-      temp = y1;
-      y1 = y2;
-      y2 = temp;
+  if (pTextFont != NULL)
+    pMap = tpGetGlyphMap(pTextFont);
+  for (c=0; c<256; c++) {
+    if (pTextFont == NULL) {
+      ucAdvance[c] = ucCellWidth[ucTextFont] * ucTextScale;
+    } else if ((iGlyph = tpGlyphIndex(pTextFont, pMap, (uint8_t)c)) < 0) { // undefined character
+      ucAdvance[c] = 0;
+    } else {
+      pGlyph = &pTextFont->glyph[iGlyph];
+      ucAdvance[c] = pgm_read_byte(&pGlyph->xAdvance);
     }
+  }
+  bAdvanceValid = 1;
+} /* tpBuildAdvances() */
+//
+// Select the font used by tpPrint() and the paragraph functions
+// pFont = a GFXfont, or NULL to use the built-in font iFontSize
+// iScale enlarges the built-in fonts (1-4)
+//
+void tpSetFont(GFXfont *pFont, int iFontSize, int iScale)
+{
+  if (iLineLen) tpFlushLine(0); // the current line keeps its font
+  pTextFont = pFont;
+  ucTextFont = (iFontSize > FONT_SMALL && iFontSize <= FONT_SMOOTH3X) ? iFontSize : FONT_SMALL;
+  ucTextScale = (iScale < 1) ? 1 : (iScale > 4) ? 4 : iScale;
+  tpBuildAdvances();
+} /* tpSetFont() */
+//
+// Set the synthetic text style (STYLE_xxx flags) for all text
+//
+void tpSetTextStyle(int iStyle)
+{
+  if (iLineLen) tpFlushLine(0); // the current line keeps its style
+  ucTextStyle = (uint8_t)(iStyle & (STYLE_BOLD | STYLE_UNDERLINE | STYLE_STRIKE | STYLE_INVERSE));
+} /* tpSetTextStyle() */
+//
+// Set the alignment of the lines printed with tpPrint()
+// (ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT or ALIGN_JUSTIFY)
+// It applies to the line being collected
+//
+void tpAlign(int iAlign)
+{
+  if (iAlign >= ALIGN_LEFT && iAlign <= ALIGN_JUSTIFY)
+    ucTextAlign = (uint8_t)iAlign;
+} /* tpAlign() */
+//
+// Width in pixels of a character in the text mode font
+//
+static int tpCharWidth(uint8_t c)
+{
+  if (!bAdvanceValid)
+    tpBuildAdvances();
+  return ucAdvance[c];
+} /* tpCharWidth() */
+//
+// Width in pixels of iLen characters
+//
+static int tpRunWidth(const char *s, int iLen)
+{
+int i = 0, w = 0;
 
-    dy = (y2 - y1);
-    error = dx >> 1;
-    yinc = 1;
-    if (dy < 0)
-    {
-      dy = -dy;
-      yinc = -1;
+  while (i < iLen)
+    w += ucAdvance[tpNextChar(s, &i)];
+  return w;
+} /* tpRunWidth() */
+//
+// Height in pixels of a line in the text mode font
+//
+static int tpLineHeight(void)
+{
+  if (pTextFont == NULL)
+    return ucCellHeight[ucTextFont] * ucTextScale;
+  return pgm_read_byte(&pTextFont->yAdvance);
+} /* tpLineHeight() */
+//
+// Draw iLen characters of text in the text mode font
+// y is the top of the line
+//
+static void tpDrawRun(const char *s, int iLen, int x, int y)
+{
+char szTemp[TP_MAX_LINE+1];
+
+  if (iLen > TP_MAX_LINE) iLen = TP_MAX_LINE;
+  memcpy(szTemp, s, iLen);
+  szTemp[iLen] = 0;
+  if (pTextFont == NULL)
+    tpDrawScaledText(x, y, szTemp, ucTextFont, ucTextScale, 0);
+  else // baseline at 2/3 of the line height
+    tpDrawCustomText(pTextFont, x, y + (pgm_read_byte(&pTextFont->yAdvance) * 2) / 3, szTemp);
+} /* tpDrawRun() */
+//
+// Continue the underline, strikethrough and inverse box of the text style
+// across the space between two words (x1-x2 exclusive, y = top of the line)
+//
+static void tpStyleGap(int x1, int x2, int y)
+{
+int iBit, iTop, iRows;
+uint8_t ucColor = 1;
+
+  if (!(ucTextStyle & (STYLE_UNDERLINE | STYLE_STRIKE | STYLE_INVERSE)) || x1 >= x2)
+    return;
+  if (ucTextStyle & STYLE_INVERSE) { // the lines are cut out of the box
+    tpDrawRect(x1, y, x2 - 1, y + tpLineHeight() - 1, 1, 1);
+    ucColor = 0;
+  }
+  for (iBit = STYLE_UNDERLINE; iBit <= STYLE_STRIKE; iBit <<= 1) {
+    if (ucTextStyle & iBit) {
+      tpStyleRows(pTextFont, ucTextFont, ucTextScale, iBit, &iTop, &iRows);
+      tpDrawRect(x1, y + iTop, x2 - 1, y + iTop + iRows - 1, ucColor, 1);
     }
-    p = &pBackBuffer[(y1 * bb_pitch) + (x1 >> 3)]; // point to current spot in back buffer
-    mask = 0x80 >> (x1 & 7); // current bit offset
-    for(; x1 <= x2; x1++) {
-      if (ucColor)
-        *p |= mask; // set pixel and increment x pointer
-      else
-        *p &= ~mask;
-      mask >>= 1;
-      if (mask == 0) {
-         mask = 0x80;
-         p++;
-      }
-      error -= dy;
-      if (error < 0)
-      {
-        error += dx;
-        if (yinc > 0)
-           p += bb_pitch;
-        else
-           p -= bb_pitch;
-      }
-    } // for x1
   }
-  else {
-    // Y major case
-    if(y1 > y2) {
-      dy = -dy;
-      temp = x1;
-      x1 = x2;
-      x2 = temp;
-      temp = y1;
-      y1 = y2;
-      y2 = temp;
+} /* tpStyleGap() */
+//
+// Render rows of the printout into the strip buffer a few rows at a time
+// and send them; pfnDraw is called for each strip and draws the whole
+// line (rows 0 to iHeight-1) with the normal drawing functions which clip
+// it to the strip. The back buffer and its state are left untouched.
+//
+static void tpStreamRows(int iHeight, void (*pfnDraw)(void *), void *pUser)
+{
+uint8_t *pSaveBuffer = pBackBuffer, ucSaveDirty[TP_MAX_DIRTY_ROWS/8];
+int iSaveWidth = bb_width, iSaveHeight = bb_height, iSavePitch = bb_pitch;
+int iSaveTop = bb_top, iSavePageHeight = iDLPageHeight, iSaveWrap = tp_wrap;
+int iSaveDirtyTop = iDirtyTop, iSaveDirtyBottom = iDirtyBottom;
+int16_t iSaveX = iCursorX, iSaveY = iCursorY;
+uint8_t iSaveMode = iDLMode;
+int iRows;
+
+  memcpy(ucSaveDirty, ucDirtyRows, sizeof(ucDirtyRows));
+  bb_width = tpGetWidth();
+  bb_pitch = (bb_width + 7) / 8;
+  bb_height = TP_STRIP_SIZE / bb_pitch;
+  pBackBuffer = ucStrip;
+  iDLMode = DL_MODE_REPLAY; // draw directly, clipped to a page of iHeight rows
+  iDLPageHeight = iHeight;
+  tp_wrap = 0;
+  for (bb_top = 0; bb_top < iHeight; bb_top += bb_height) {
+    memset(ucStrip, 0, TP_STRIP_SIZE);
+    tpSetAllDirty(0);
+    (*pfnDraw)(pUser);
+    iRows = iHeight - bb_top;
+    tpSendDirtyRows((iRows < bb_height) ? iRows : bb_height);
+  }
+  // restore the back buffer state
+  pBackBuffer = pSaveBuffer;
+  bb_width = iSaveWidth; bb_height = iSaveHeight; bb_pitch = iSavePitch;
+  bb_top = iSaveTop; iDLPageHeight = iSavePageHeight; iDLMode = iSaveMode;
+  tp_wrap = iSaveWrap; iCursorX = iSaveX; iCursorY = iSaveY;
+  memcpy(ucDirtyRows, ucSaveDirty, sizeof(ucDirtyRows));
+  iDirtyTop = iSaveDirtyTop; iDirtyBottom = iSaveDirtyBottom;
+} /* tpStreamRows() */
+//
+// Open the graphics session used for streamed lines
+//
+static void tpStartStream(void)
+{
+  if (bStreaming)
+    return;
+  if (!bPrinterInit) {
+    tpInitX18_9556();
+    bPrinterInit = 1;
+  }
+  tpPreGraphics(tpGetWidth(), 0);
+  bStreaming = 1;
+  iBlankRows = 0;
+  bRowsStarted = 1; // keep the spacing above the first line
+} /* tpStartStream() */
+//
+// Start printing an image made of strips
+//
+int tpBeginImage(void)
+{
+  if (!bConnected)
+    return -1;
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  tpStartStream();
+  bImageOpen = 1;
+  return 0;
+} /* tpBeginImage() */
+//
+// Send a strip of image rows
+//
+int tpPushImageRows(const uint8_t *pRows, int iWidth, int iPitch, int iCount, int bInvert)
+{
+uint8_t ucLine[TP_MAX_DITHER_WIDTH / 8], ucInvert, ucMask, ucAny;
+int i, y, iBytes, iLinePitch = (tpGetWidth() + 7) / 8;
+const uint8_t *s;
+
+  if (!bConnected || !bImageOpen || pRows == NULL || iWidth < 1 || iCount < 0)
+    return -1;
+  iBytes = (iWidth + 7) / 8;
+  ucMask = (iWidth & 7) ? (uint8_t)(0xff << (8 - (iWidth & 7))) : 0xff; // pixels of the last byte
+  if (iBytes > iLinePitch) { // crop
+    iBytes = iLinePitch;
+    ucMask = 0xff;
+  }
+  ucInvert = bInvert ? 0xff : 0x00;
+  memset(ucLine, 0, sizeof(ucLine));
+  for (y=0; y<iCount; y++) {
+    s = &pRows[y * iPitch];
+    for (i=0; i<iBytes; i++)
+      ucLine[i] = s[i] ^ ucInvert;
+    ucLine[iBytes-1] &= ucMask;
+    for (ucAny=0, i=0; i<iBytes; i++)
+      ucAny |= ucLine[i];
+    if (ucAny == 0) // white
+      iBlankRows++;
+    else
+      tpSendRow(ucLine, iLinePitch);
+  }
+  return 0;
+} /* tpPushImageRows() */
+//
+// Finish the image and feed it out
+//
+int tpEndImage(void)
+{
+  if (!bConnected || !bImageOpen)
+    return -1;
+  bImageOpen = 0;
+  iBlankRows = 0; // white rows at the end aren't worth feeding twice
+  if (bStreaming)
+    tpPostGraphics();
+  return 0;
+} /* tpEndImage() */
+//
+// End the print session after an image printed by a single call
+// (tpPrintBMP(), tpPrintImageBlob()...); the white rows
+// below it are fed. Inside tpBeginImage()/tpEndImage() it stays open.
+//
+static void tpFinishImage(void)
+{
+  if (bImageOpen || !bStreaming)
+    return;
+  tpSendBlankRows();
+  tpPostGraphics();
+} /* tpFinishImage() */
+//
+// Split text into words, starting at *pOffset and stopping at the end of
+// the paragraph (\n or the end of the text) or when the word table is full
+// Words wider than iWidth are split. *pOffset is updated.
+// returns the number of words found
+//
+static int tpFindWords(const char *szText, int *pOffset, int iWidth)
+{
+int i = *pOffset, j, iStart, w, cw, n = 0;
+uint8_t c, bSpace = 0;
+
+  while ((c = (uint8_t)szText[i]) != 0 && c != '\n' && n < TP_MAX_WORDS) {
+    if (c == ' ' || c == '\r') {
+      bSpace = (n > 0);
+      i++;
+      continue;
+    }
+    iStart = i; w = 0;
+    while ((c = (uint8_t)szText[i]) != 0 && c != ' ' && c != '\n' && c != '\r') {
+      j = i;
+      cw = ucAdvance[tpNextChar(szText, &j)];
+      if (w + cw > iWidth && i > iStart) break; // too wide, split it
+      w += cw;
+      i = j;
     }
+    tpWords[n].iStart = (uint16_t)iStart;
+    tpWords[n].iLen = (uint16_t)(i - iStart);
+    tpWords[n].iWidth = (int16_t)w;
+    tpWords[n].bSpace = bSpace;
+    n++;
+    bSpace = 0;
+  }
+  *pOffset = i;
+  return n;
+} /* tpFindWords() */
+//
+// Width of a line made of iCount words
+//
+static int tpWordsWidth(TPWORD *pWords, int iCount)
+{
+int i, w = 0;
 
-    p = &pBackBuffer[(y1 * bb_pitch) + (x1 >> 3)]; // point to current spot in back buffer
-    mask = 0x80 >> (x1 & 7); // current bit offset
-    dx = (x2 - x1);
-    error = dy >> 1;
-    xinc = 1;
-    if (dx < 0)
-    {
-      dx = -dx;
-      xinc = -1;
+  for (i=0; i<iCount; i++) {
+    if (i && pWords[i].bSpace) w += ucAdvance[' '];
+    w += pWords[i].iWidth;
+  }
+  return w;
+} /* tpWordsWidth() */
+//
+// Draw a line of words at x,y
+// iExtra pixels are spread across the spaces (for justified text)
+//
+static void tpDrawWords(const char *szText, TPWORD *pWords, int iCount, int x, int y, int iExtra)
+{
+int i, iGaps = 0, iGap;
+
+  for (i=1; i<iCount; i++)
+    iGaps += pWords[i].bSpace;
+  for (i=0; i<iCount; i++) {
+    if (i && pWords[i].bSpace) {
+      iGap = iExtra / iGaps; // spread the remainder over the first gaps
+      if (iExtra % iGaps) iGap++;
+      tpStyleGap(x, x + ucAdvance[' '] + iGap, y);
+      x += ucAdvance[' '] + iGap;
+      iExtra -= iGap; iGaps--;
     }
-    for(; y1 <= y2; y1++) {
-      if (ucColor)
-         *p |= mask; // set the pixel
-      else
-         *p &= ~mask;
-      p += bb_pitch; // y++
-      error -= dx;
-      if (error < 0)
-      {
-        error += dy;
-        x1 += xinc;
-        if (xinc > 0)
-        {
-          mask >>= 1;
-          if (mask == 0) // change the byte
-          {
-             p++;
-             mask = 0x80;
-          }
-        } // positive delta x
-        else // negative delta x
-        {
-          mask <<= 1;
-          if (mask == 0)
-          {
-             p--;
-             mask = 1;
+    tpDrawRun(&szText[pWords[i].iStart], pWords[i].iLen, x, y);
+    x += pWords[i].iWidth;
+  }
+} /* tpDrawWords() */
+//
+// Where a line starts and how much to stretch its spaces for the alignment
+//
+static int tpAlignLine(int iAlign, int iSlack, int bLast, int *pExtra)
+{
+  *pExtra = 0;
+  if (iSlack <= 0)
+    return 0;
+  switch (iAlign) {
+    case ALIGN_CENTER:
+      return iSlack / 2;
+    case ALIGN_RIGHT:
+      return iSlack;
+    case ALIGN_JUSTIFY:
+      if (!bLast) // the last line of a paragraph isn't stretched
+        *pExtra = iSlack;
+      break;
+  }
+  return 0;
+} /* tpAlignLine() */
+//
+// Break text into lines at word boundaries
+// Each paragraph (ending with \n) starts a new line. bBalanced picks the
+// breaks which make the line lengths most even (minimum raggedness)
+// instead of filling each line as much as possible.
+// pfnLine is called for each line (it can be NULL to just count them)
+// returns the number of lines
+//
+static int tpLayoutText(const char *szText, int iWidth, int bBalanced, TP_LINE_CB pfnLine, void *pUser)
+{
+int iOffset = 0, n, a, b, w, iLines = 0, bEnd, iSpace;
+uint32_t u32, u32Best;
+
+  if (szText == NULL || szText[0] == 0)
+    return 0;
+  if (!bAdvanceValid)
+    tpBuildAdvances();
+  iSpace = ucAdvance[' '];
+  while (1) {
+    n = tpFindWords(szText, &iOffset, iWidth);
+    bEnd = (szText[iOffset] == 0 || szText[iOffset] == '\n');
+    if (bBalanced) { // cost of the best breaks from each word to the end
+      u32Cost[n] = 0;
+      for (a=n-1; a>=0; a--) {
+        u32Best = 0xffffffff;
+        w = 0;
+        for (b=a+1; b<=n; b++) {
+          w += ((b-1 > a && tpWords[b-1].bSpace) ? iSpace : 0) + tpWords[b-1].iWidth;
+          if (w > iWidth && b > a+1) break;
+          u32 = (b == n || w > iWidth) ? 0 : (uint32_t)((iWidth - w) * (iWidth - w));
+          u32 += u32Cost[b];
+          if (u32 < u32Best) {
+            u32Best = u32;
+            ucBreak[a] = (uint8_t)b;
           }
         }
+        u32Cost[a] = u32Best;
       }
-    } // for y
-  } // y major case
-} /* tpDrawLine() */
+    }
+    for (a=0; a<n; a=b) {
+      if (bBalanced) {
+        b = ucBreak[a];
+      } else { // fill each line as much as it can hold
+        w = tpWords[a].iWidth;
+        for (b=a+1; b<n; b++) {
+          if (w + (tpWords[b].bSpace ? iSpace : 0) + tpWords[b].iWidth > iWidth) break;
+          w += (tpWords[b].bSpace ? iSpace : 0) + tpWords[b].iWidth;
+        }
+      }
+      if (b == n && !bEnd && a > 0) { // the word table filled up, continue from this line
+        iOffset = tpWords[a].iStart;
+        break;
+      }
+      if (pfnLine)
+        (*pfnLine)(szText, &tpWords[a], b - a, iWidth, (b == n && bEnd), pUser);
+      iLines++;
+    }
+    if (!bEnd)
+      continue;
+    if (n == 0) { // empty paragraph = blank line
+      if (pfnLine)
+        (*pfnLine)(szText, tpWords, 0, iWidth, 1, pUser);
+      iLines++;
+    }
+    if (szText[iOffset] == 0 || szText[iOffset+1] == 0) // the text ends with the last paragraph
+      break;
+    iOffset++; // skip the \n
+  }
+  return iLines;
+} /* tpLayoutText() */
+//
+// Return the number of lines a paragraph will need when wrapped to
+// iWidth pixels in the text mode font
+//
+int tpMeasureParagraph(const char *szText, int iWidth, int bBalanced)
+{
+  return tpLayoutText(szText, iWidth, bBalanced, NULL, NULL);
+} /* tpMeasureParagraph() */
+//
+// Line callback which draws into the back buffer
+//
+typedef struct tag_tpparagraph {
+  int x, y, iAlign;
+} TPPARAGRAPH;
+
+static void tpDrawParagraphLine(const char *szText, TPWORD *pWords, int iCount, int iWidth, int bLast, void *pUser)
+{
+TPPARAGRAPH *pPara = (TPPARAGRAPH *)pUser;
+int x, iExtra;
+
+  x = tpAlignLine(pPara->iAlign, iWidth - tpWordsWidth(pWords, iCount), bLast, &iExtra);
+  tpDrawWords(szText, pWords, iCount, pPara->x + x, pPara->y, iExtra);
+  pPara->y += tpLineHeight();
+} /* tpDrawParagraphLine() */
+//
+// Draw text wrapped at word boundaries into the back buffer
+// in the text mode font (see tpSetFont)
+// x,y = upper left corner, iWidth = width of the column in pixels
+// iAlign = ALIGN_LEFT/CENTER/RIGHT/JUSTIFY
+// returns the y coordinate below the last line
+//
+int tpDrawParagraph(int x, int y, int iWidth, char *szText, int iAlign, int bBalanced)
+{
+TPPARAGRAPH para;
+int iSaveWrap = tp_wrap;
+
+  if (pBackBuffer == NULL || szText == NULL || iWidth <= 0)
+    return -1;
+  para.x = x; para.y = y; para.iAlign = iAlign;
+  tp_wrap = 0;
+  tpLayoutText(szText, iWidth, bBalanced, tpDrawParagraphLine, &para);
+  tp_wrap = iSaveWrap;
+  return para.y;
+} /* tpDrawParagraph() */
+//
+// Draw one streamed line into the strip
+//
+typedef struct tag_tpstreamline {
+  const char *szText;
+  TPWORD *pWords;
+  int iCount, x, iExtra;
+} TPSTREAMLINE;
+
+static void tpDrawStreamLine(void *pUser)
+{
+TPSTREAMLINE *pLine = (TPSTREAMLINE *)pUser;
+
+  tpDrawWords(pLine->szText, pLine->pWords, pLine->iCount, pLine->x, 0, pLine->iExtra);
+} /* tpDrawStreamLine() */
+//
+// Line callback which streams to the printer
+//
+static void tpPrintParagraphLine(const char *szText, TPWORD *pWords, int iCount, int iWidth, int bLast, void *pUser)
+{
+TPSTREAMLINE line;
+
+  line.szText = szText;
+  line.pWords = pWords;
+  line.iCount = iCount;
+  line.x = tpAlignLine(ucTextAlign, iWidth - tpWordsWidth(pWords, iCount), bLast, &line.iExtra);
+  tpStreamRows(tpLineHeight(), tpDrawStreamLine, &line);
+} /* tpPrintParagraphLine() */
+//
+// Print text wrapped at word boundaries to the printer width
+// using the text mode font and alignment (see tpSetFont/tpAlign)
+// returns the number of lines printed or -1 if not connected
+//
+int tpPrintParagraph(char *szText, int bBalanced)
+{
+  if (!bConnected || szText == NULL)
+    return -1;
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  tpStartStream();
+  return tpLayoutText(szText, tpGetWidth(), bBalanced, tpPrintParagraphLine, NULL);
+} /* tpPrintParagraph() */
+//
+// Draw the text mode line as is into the strip (pUser points to its x)
+//
+static void tpDrawStreamText(void *pUser)
+{
+  tpDrawRun(szLine, iLineLen, *(int *)pUser, 0);
+} /* tpDrawStreamText() */
+//
+// Print the current line (even if it's empty) and start a new one
+// bWrapped = the line ended because it was full (justified text is stretched)
+//
+static void tpFlushLine(int bWrapped)
+{
+int iOffset = 0, n, iExtra;
+
+  tpStartStream();
+  szLine[iLineLen] = 0;
+  if (!bAdvanceValid)
+    tpBuildAdvances();
+  if (ucTextAlign == ALIGN_JUSTIFY && bWrapped) { // stretch the spaces between words
+    n = tpFindWords(szLine, &iOffset, 0x7fff);
+    tpPrintParagraphLine(szLine, tpWords, n, tpGetWidth(), 0, NULL);
+  } else { // spaces are kept as typed (text lined up with spaces stays lined up)
+    iOffset = tpAlignLine(ucTextAlign, tpGetWidth() - iLineWidth, 1, &iExtra);
+    tpStreamRows(tpLineHeight(), tpDrawStreamText, &iOffset);
+  }
+  iLineLen = iLineWidth = 0;
+} /* tpFlushLine() */
+//
+// Print text in the current font and alignment
+// Lines end with \n (\r is ignored); lines which are too wide
+// continue on the next line, breaking at a space if possible.
+// A line is printed when it's finished, so the last line without a \n
+// waits for more text, tpFeed(), tpPrintBuffer() or tpDisconnect()
+// returns 0 for success, -1 if not connected
+//
+int tpPrint(const char *szMsg)
+{
+uint8_t c;
+char c0;
+int i, j, iLen, iWidth, iBreak, iTrim;
+
+  if (!bConnected || szMsg == NULL)
+    return -1;
+  i = 0;
+  while (szMsg[i]) {
+    j = i;
+    c = tpNextChar(szMsg, &j); // one character (several bytes for UTF-8)
+    iLen = j - i;
+    if (c == '\r') {
+      i = j;
+      continue;
+    }
+    if (c == '\n') {
+      tpFlushLine(0);
+      i = j;
+      continue;
+    }
+    iWidth = tpCharWidth(c);
+    if ((iLineWidth + iWidth > tpGetWidth() && iLineLen) || iLineLen + iLen > TP_MAX_LINE) {
+      // doesn't fit, continue on the next line from the last space
+      for (iBreak = iLineLen; iBreak > 0 && szLine[iBreak-1] != ' '; iBreak--) {};
+      if (c == ' ' || iBreak == 0) { // break here
+        tpFlushLine(1);
+      } else {
+        int iEnd = iLineLen;
+        iLineLen = iBreak;
+        for (iTrim = iBreak; iTrim > 0 && szLine[iTrim-1] == ' '; iTrim--) {};
+        iLineWidth = tpRunWidth(szLine, iTrim); // the width without the space at the break
+        c0 = szLine[iBreak]; // the line gets terminated here
+        tpFlushLine(1);
+        szLine[iBreak] = c0;
+        while (iBreak < iEnd) // move the partial word to the new line
+          szLine[iLineLen++] = szLine[iBreak++];
+        iLineWidth = tpRunWidth(szLine, iLineLen);
+      }
+      if (c == ' ') { // don't start the new line with a space
+        i = j;
+        continue;
+      }
+    }
+    memcpy(&szLine[iLineLen], &szMsg[i], iLen);
+    iLineLen += iLen;
+    iLineWidth += iWidth;
+    i = j;
+  }
+  return 0;
+} /* tpPrint() */
+//
+// Formatted version of tpPrint()
+//
+int tpPrintf(const char *szFormat, ...)
+{
+char szTemp[256];
+va_list args;
+
+  va_start(args, szFormat);
+  vsnprintf(szTemp, sizeof(szTemp), szFormat, args);
+  va_end(args);
+  return tpPrint(szTemp);
+} /* tpPrintf() */
+//
+// Tables
+// Each column has a width, alignment and a rule for text which doesn't fit.
+// A row is laid out once (every cell is measured and broken into lines),
+// then drawn in one pass into the back buffer or the streaming strip.
+//
+//
+// Set up the columns for tpDrawRow()/tpPrintRow()
+// The column array must stay valid while the table is in use
+// iGap = space between columns in pixels
+// returns 0 for success, -1 for invalid parameters
+//
+int tpSetTable(TPCOLUMN *pColumns, int iCount, int iGap)
+{
+  if (pColumns == NULL || iCount < 1 || iCount > TP_MAX_COLUMNS)
+    return -1;
+  pTableColumns = pColumns;
+  iTableColumns = iCount;
+  iTableGap = iGap;
+  return 0;
+} /* tpSetTable() */
+//
+// Position of a line of text within its column
+//
+static int tpCellX(TPCOLUMN *pCol, const char *s, int iLen, int iWidth)
+{
+int i;
+
+  switch (pCol->ucAlign) {
+    case ALIGN_CENTER:
+      return (pCol->iWidth - iWidth) / 2;
+    case ALIGN_RIGHT:
+      return pCol->iWidth - iWidth;
+    case ALIGN_DECIMAL: // line up the decimal points
+      for (i=0; i<iLen && s[i] != '.'; i++) {};
+      return pCol->iWidth - ucAdvance['.'] - (ucAdvance['0'] * pCol->ucDecimals) - tpRunWidth(s, i);
+  }
+  return 0;
+} /* tpCellX() */
+//
+// Line callback which stores the lines of a wrapped cell
+//
+static void tpCellLine(const char *szText, TPWORD *pWords, int iCount, int iWidth, int bLast, void *pUser)
+{
+int iCol = *(int *)pUser;
+TPCELLLINE *pLine;
+
+  if (ucCellLines[iCol] >= TP_MAX_CELL_LINES)
+    return;
+  pLine = &tpCellLines[iCol][ucCellLines[iCol]++];
+  pLine->bEllipsis = 0;
+  if (iCount == 0) { // blank line
+    pLine->iStart = pLine->iLen = 0;
+    pLine->x = 0;
+    return;
+  }
+  pLine->iStart = pWords[0].iStart;
+  pLine->iLen = pWords[iCount-1].iStart + pWords[iCount-1].iLen - pLine->iStart;
+  pLine->x = (int16_t)tpCellX(&pTableColumns[iCol], &szText[pLine->iStart], pLine->iLen,
+                              tpRunWidth(&szText[pLine->iStart], pLine->iLen));
+  if (pLine->x < 0)
+    pLine->x = 0;
+} /* tpCellLine() */
+//
+// Break the cells of a row into lines
+// returns the number of lines of the tallest cell
+//
+static int tpLayoutRow(char **pCells)
+{
+int iCol, i, w, iLen, iMax, iLines = 1;
+const char *s;
+TPCOLUMN *pCol;
+TPCELLLINE *pLine;
+
+  if (!bAdvanceValid)
+    tpBuildAdvances();
+  pRowCells = pCells;
+  for (iCol=0; iCol<iTableColumns; iCol++) {
+    pCol = &pTableColumns[iCol];
+    s = pCells[iCol];
+    ucCellLines[iCol] = 0;
+    if (s == NULL || s[0] == 0)
+      continue;
+    if (pCol->ucOverflow == OVERFLOW_WRAP) {
+      tpLayoutText(s, pCol->iWidth, 0, tpCellLine, &iCol);
+    } else { // a single line, cut off at the column edge
+      pLine = &tpCellLines[iCol][0];
+      ucCellLines[iCol] = 1;
+      iLen = strlen(s);
+      w = tpRunWidth(s, iLen);
+      pLine->iStart = 0;
+      pLine->bEllipsis = 0;
+      if (w > pCol->iWidth) {
+        iMax = pCol->iWidth;
+        if (pCol->ucOverflow == OVERFLOW_ELLIPSIS) {
+          iMax -= ucAdvance['.'] * 3;
+          pLine->bEllipsis = 1;
+        }
+        for (i=0, w=0; i<iLen; ) {
+          int j = i, cw = ucAdvance[tpNextChar(s, &j)];
+          if (w + cw > iMax) break;
+          w += cw;
+          i = j;
+        }
+        iLen = i;
+        if (pLine->bEllipsis)
+          w += ucAdvance['.'] * 3;
+      }
+      pLine->iLen = (uint16_t)iLen;
+      pLine->x = (int16_t)tpCellX(pCol, s, iLen, w);
+      if (pLine->x < 0) // too wide for the column
+        pLine->x = 0;
+    }
+    if (ucCellLines[iCol] > iLines)
+      iLines = ucCellLines[iCol];
+  }
+  return iLines;
+} /* tpLayoutRow() */
+//
+// Draw the laid out row with its top at y
+//
+static void tpDrawRowCells(int y)
+{
+int iCol, i, x = 0, iLineHeight = tpLineHeight();
+TPCELLLINE *pLine;
+const char *s;
+
+  for (iCol=0; iCol<iTableColumns; iCol++) {
+    s = pRowCells[iCol];
+    for (i=0; i<ucCellLines[iCol]; i++) {
+      pLine = &tpCellLines[iCol][i];
+      if (pLine->iLen)
+        tpDrawRun(&s[pLine->iStart], pLine->iLen, x + pLine->x, y + i * iLineHeight);
+      if (pLine->bEllipsis)
+        tpDrawRun("...", 3, x + pLine->x + tpRunWidth(&s[pLine->iStart], pLine->iLen), y + i * iLineHeight);
+    }
+    x += pTableColumns[iCol].iWidth + iTableGap;
+  }
+} /* tpDrawRowCells() */
+//
+// Draw a table row into the back buffer with its top at y
+// pCells = text of each column (NULL for an empty cell)
+// returns the y coordinate below the row
+//
+int tpDrawRow(int y, char **pCells)
+{
+int iSaveWrap = tp_wrap, iLines;
+
+  if (pBackBuffer == NULL || pTableColumns == NULL || pCells == NULL)
+    return -1;
+  iLines = tpLayoutRow(pCells);
+  tp_wrap = 0;
+  tpDrawRowCells(y);
+  tp_wrap = iSaveWrap;
+  return y + iLines * tpLineHeight();
+} /* tpDrawRow() */
+//
+// Draw the streamed row into the strip
+//
+static void tpDrawStreamRow(void *pUser)
+{
+  (void)pUser;
+  tpDrawRowCells(0);
+} /* tpDrawStreamRow() */
+//
+// Print a table row; it's sent to the printer right away
+// pCells = text of each column (NULL for an empty cell)
+// returns 0 for success, -1 if not connected
+//
+int tpPrintRow(char **pCells)
+{
+int iLines;
+
+  if (!bConnected || pTableColumns == NULL || pCells == NULL)
+    return -1;
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  tpStartStream();
+  iLines = tpLayoutRow(pCells);
+  tpStreamRows(iLines * tpLineHeight(), tpDrawStreamRow, NULL);
+  return 0;
+} /* tpPrintRow() */
+
+//
+// Rotated text
+// Glyphs of the text mode font are turned 90 degrees (reading down the
+// page) or 270 degrees (reading up) as they're rendered, so vertical labels
+// and banners don't need the whole page in RAM. Each upright row of a glyph
+// becomes a column of the rotated one. Rotated glyphs are kept in the text
+// cache (tpSetTextCache), so drawing one again copies its rotated rows.
+//
+// Upright box of one character of the text mode font: u0-u1 from the pen
+// position, v0-v1 from the top of the line (ends exclusive)
+// returns the advance
+//
+static int tpGlyphBox(const char *szChar, int *pu0, int *pu1, int *pv0, int *pv1)
+{
+int iAdvance, iBase;
+
+  if (pTextFont == NULL) { // the whole character cell
+    *pu0 = *pv0 = 0;
+    *pu1 = ucCellWidth[ucTextFont] * ucTextScale;
+    *pv1 = ucCellHeight[ucTextFont] * ucTextScale;
+    return *pu1;
+  }
+  iAdvance = tpMeasureCustomText(pTextFont, szChar, ucTextStyle, pu0, pu1, pv0, pv1);
+  if (*pv1 > *pv0) { // relative to the baseline, at 2/3 of the line height
+    iBase = (pgm_read_byte(&pTextFont->yAdvance) * 2) / 3;
+    *pv0 += iBase; *pv1 += iBase;
+  }
+  return iAdvance;
+} /* tpGlyphBox() */
+//
+// Render one character rotated into a 1-bpp buffer (pixels are ORed)
+// x,y = top left corner of the rotated box (clipped)
+//
+static void tpRotateChar(const char *szChar, int iAngle, int u0, int u1, int v0, int v1, int x, int y, uint8_t *pDest, int iPitch, int iWidth, int iHeight)
+{
+uint8_t ucGlyph[72], ucRow[64], uc, ucMask;
+int i, u, v, tx, ty, iBytes, iBase = 0;
+
+  if (u1 - u0 > (int)sizeof(ucRow) * 8) // longer rows are cut off
+    u1 = u0 + sizeof(ucRow) * 8;
+  iBytes = ucCellWidth[ucTextFont] / 8;
+  if (pTextFont == NULL) {
+    i = 0;
+    tpPrepGlyph(tpNextChar(szChar, &i), ucTextFont, 0, ucGlyph);
+  } else {
+    iBase = (pgm_read_byte(&pTextFont->yAdvance) * 2) / 3;
+  }
+  for (v=v0; v<v1; v++) { // each upright row is a column of the rotated box
+    tx = (iAngle == 90) ? x + v1 - 1 - v : x + v - v0;
+    if (tx < 0 || tx >= iWidth) continue;
+    if (pTextFont == NULL) {
+      tpExpandBits(&ucGlyph[(v / ucTextScale) * iBytes], iBytes, ucTextScale, ucRow);
+    } else {
+      memset(ucRow, 0, (u1 - u0 + 7) >> 3);
+      tpRenderCustomText(pTextFont, -u0, iBase - v, szChar, ucRow, sizeof(ucRow), u1 - u0, 1, 0, ucTextStyle);
+    }
+    ucMask = 0x80 >> (tx & 7);
+    for (i=0; i<u1-u0; i+=8) {
+      uc = ucRow[i >> 3];
+      for (u=i; uc; u++, uc <<= 1) {
+        if (!(uc & 0x80)) continue;
+        ty = (iAngle == 90) ? y + u : y + (u1 - u0 - 1 - u);
+        if (ty >= 0 && ty < iHeight)
+          pDest[ty * iPitch + (tx >> 3)] |= ucMask;
+      }
+    }
+  }
+} /* tpRotateChar() */
+//
+// Draw text rotated by iAngle into the back buffer (band relative y)
+// The line box is tpLineHeight() pixels wide with its top left corner at x,y
+// and iWidth pixels tall (the length of the text). Banners pass pStart/pPen
+// to skip the characters which were already printed (90 degrees only).
+//
+static void tpRotatedRun(int x, int y, const char *szMsg, int iAngle, int iWidth, int *pStart, int *pPen)
+{
+char szChar[5];
+int i, j, iPen, iLine, iAdvance, u0, u1, v0, v1, bx, by, iRow, ty;
+uint8_t bPrefix = (pStart != NULL && iAngle == 90);
+TPCACHEENTRY *pEntry;
+uint16_t u16Attr = tpCacheAttr(pTextFont, (iAngle == 90) ? 1 : 2);
+
+  iLine = tpLineHeight();
+  i = (pStart) ? *pStart : 0;
+  iPen = (pPen) ? *pPen : 0;
+  while (szMsg[i]) {
+    // stop once the rest of the text is past the band
+    if (iAngle == 90 && y + iPen - iLine >= bb_height) break;
+    if (iAngle == 270 && y + iWidth - iPen + iLine <= 0) break;
+    j = i;
+    tpNextChar(szMsg, &i); // one character (up to 4 bytes of UTF-8)
+    memcpy(szChar, &szMsg[j], i - j);
+    szChar[i - j] = 0;
+    iAdvance = tpGlyphBox(szChar, &u0, &u1, &v0, &v1);
+    if (iAngle == 90) { // the top of the glyph faces right
+      bx = x + iLine - v1; by = y + iPen + u0;
+    } else { // the top faces left
+      bx = x + v0; by = y + iWidth - iPen - u1;
+    }
+    iPen += iAdvance;
+    if (by + (u1 - u0) <= 0) { // above the band
+      if (bPrefix) { // printed already, don't look at it again
+        *pStart = i; *pPen = iPen;
+      }
+      continue;
+    }
+    bPrefix = 0;
+    if (by >= bb_height || u1 <= u0 || v1 <= v0)
+      continue; // below the band or blank
+    ty = (by < 0) ? 0 : by;
+    tpMarkDirty(ty, ((by + u1 - u0 > bb_height) ? bb_height : by + u1 - u0) - 1);
+    pEntry = tpCacheFind(pTextFont, szChar, u16Attr);
+    if (pEntry == NULL && (pEntry = tpCacheAdd(pTextFont, szChar, u16Attr, 0, 0, v1 - v0, u1 - u0)) != NULL)
+      tpRotateChar(szChar, iAngle, u0, u1, v0, v1, 0, 0, tpCacheRow(pEntry, 0), (v1 - v0 + 7) >> 3, v1 - v0, u1 - u0);
+    if (pEntry == NULL) { // no cache, rotate it straight into the band
+      tpRotateChar(szChar, iAngle, u0, u1, v0, v1, bx, by, pBackBuffer, bb_pitch, bb_width, bb_height);
+      continue;
+    }
+    for (iRow=0; iRow<pEntry->iHeight; iRow++) { // copy the rotated rows
+      ty = by + iRow;
+      if (ty < 0) continue;
+      if (ty >= bb_height) break;
+      tpOrBits(tpCacheRow(pEntry, iRow), pEntry->iWidth, bx, &pBackBuffer[ty * bb_pitch], bb_width);
+    }
+  }
+} /* tpRotatedRun() */
+//
+// Draw text in the text mode font and style rotated by 90 or 270 degrees
+//
+int tpDrawRotatedText(int x, int y, char *szMsg, int iAngle)
+{
+int iWidth, iLine;
+
+  if (pBackBuffer == NULL || szMsg == NULL || (iAngle != 90 && iAngle != 270))
+    return -1;
+  if (!bAdvanceValid)
+    tpBuildAdvances();
+  iWidth = tpRunWidth(szMsg, strlen(szMsg));
+  if (iDLMode == DL_MODE_RECORD) { // glyphs can stick out of the line box a little
+    iLine = tpLineHeight();
+    return tpDLAdd(DL_ROTTEXT, ucTextStyle | ((iAngle == 270) ? 0x10 : 0), y - iLine, y + iWidth + iLine, x, y, iWidth,
+                   ucTextFont | (ucTextScale << 4), pTextFont, szMsg, strlen(szMsg) + 1);
+  }
+  tpRotatedRun(x, y - bb_top, szMsg, iAngle, iWidth, NULL, NULL);
+  return 0;
+} /* tpDrawRotatedText() */
+//
+// State of a banner being streamed
+//
+typedef struct tag_tpbanner {
+  const char *szMsg;
+  int x, iAngle, iWidth;
+  int iStart, iPen; // first character which can still be visible
+} TPBANNER;
+//
+// Draw the part of a banner which touches the current strip
+//
+static void tpDrawBannerStrip(void *pUser)
+{
+TPBANNER *pBanner = (TPBANNER *)pUser;
+
+  tpRotatedRun(pBanner->x, -bb_top, pBanner->szMsg, pBanner->iAngle, pBanner->iWidth, &pBanner->iStart, &pBanner->iPen);
+} /* tpDrawBannerStrip() */
+//
+// Print text of any length along the paper (rotated by 90 or 270 degrees)
+// in the text mode font, centered across the paper. It's rendered a strip
+// of rows at a time, so a long banner only needs a few rows of RAM.
+// returns -1 if not connected or the angle isn't valid
+//
+int tpPrintBanner(char *szMsg, int iAngle)
+{
+TPBANNER banner;
+
+  if (!bConnected || szMsg == NULL || (iAngle != 90 && iAngle != 270))
+    return -1;
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  if (!bAdvanceValid)
+    tpBuildAdvances();
+  tpStartStream();
+  banner.szMsg = szMsg;
+  banner.iAngle = iAngle;
+  banner.iWidth = tpRunWidth(szMsg, strlen(szMsg));
+  banner.x = (tpGetWidth() - tpLineHeight()) / 2;
+  banner.iStart = banner.iPen = 0;
+  tpStreamRows(banner.iWidth, tpDrawBannerStrip, &banner);
+  return 0;
+} /* tpPrintBanner() */
+
+//
+// Fill a rectangle of back buffer rows with a solid color
+// Coordinates are relative to the back buffer and inclusive
+// Each row is a masked left edge, a memset of whole bytes and a masked right edge
+//
+static void tpFillSpans(int x1, int x2, int y1, int y2, uint8_t ucColor)
+{
+int y, iBytes;
+uint8_t *d, ucLeft, ucRight, ucFill;
+
+  if (x1 > x2) { y = x1; x1 = x2; x2 = y; }
+  if (y1 > y2) { y = y1; y1 = y2; y2 = y; }
+  if (x1 < 0) x1 = 0;
+  if (x2 >= bb_width) x2 = bb_width - 1;
+  if (y1 < 0) y1 = 0;
+  if (y2 >= bb_height) y2 = bb_height - 1;
+  if (x1 > x2 || y1 > y2) return; // nothing visible
+  tpMarkDirty(y1, y2);
+  ucLeft = 0xff >> (x1 & 7);
+  ucRight = 0xff << (7 - (x2 & 7));
+  iBytes = (x2 >> 3) - (x1 >> 3);
+  if (iBytes == 0) ucLeft &= ucRight; // starts and ends in the same byte
+  ucFill = (ucColor) ? 0xff : 0x00;
+  d = &pBackBuffer[(y1 * bb_pitch) + (x1 >> 3)];
+  for (y=y1; y<=y2; y++) {
+    d[0] = (d[0] & ~ucLeft) | (ucFill & ucLeft);
+    if (iBytes) {
+      if (iBytes > 1)
+        memset(&d[1], ucFill, iBytes-1);
+      d[iBytes] = (d[iBytes] & ~ucRight) | (ucFill & ucRight);
+    }
+    d += bb_pitch;
+  }
+} /* tpFillSpans() */
+//
+// Draw a vertical line (back buffer coordinates, inclusive)
+// It's a single bit mask walked down the column
+//
+static void tpDrawVSpan(int x, int y1, int y2, uint8_t ucColor)
+{
+int y;
+uint8_t *d, ucMask;
+
+  if (y1 > y2) { y = y1; y1 = y2; y2 = y; }
+  if (y1 < 0) y1 = 0;
+  if (y2 >= bb_height) y2 = bb_height - 1;
+  if (x < 0 || x >= bb_width || y1 > y2) return;
+  tpMarkDirty(y1, y2);
+  d = &pBackBuffer[(y1 * bb_pitch) + (x >> 3)];
+  ucMask = 0x80 >> (x & 7);
+  if (ucColor) {
+    for (y=y1; y<=y2; y++) {
+      *d |= ucMask; d += bb_pitch;
+    }
+  } else {
+    ucMask = ~ucMask;
+    for (y=y1; y<=y2; y++) {
+      *d &= ucMask; d += bb_pitch;
+    }
+  }
+} /* tpDrawVSpan() */
+//
+// Number of minor axis steps taken by the line stepper after k major axis steps
+// e0 is the starting error term (major delta / 2)
+//
+static int64_t tpLineMinorSteps(int64_t k, int64_t dMajor, int64_t dMinor, int64_t e0)
+{
+  if (k * dMinor <= e0) return 0;
+  return (k * dMinor - e0 + dMajor - 1) / dMajor;
+} /* tpLineMinorSteps() */
+//
+// Return the first major axis step at which the stepper has taken
+// at least m minor axis steps
+//
+static int64_t tpLineFirstStep(int64_t m, int64_t dMajor, int64_t dMinor, int64_t e0)
+{
+  if (m <= 0) return 0;
+  if (dMinor == 0) return INT32_MAX; // never gets there
+  return (((m - 1) * dMajor) + e0) / dMinor + 1;
+} /* tpLineFirstStep() */
+//
+// Cohen-Sutherland region code of a point relative to the back buffer
+//
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+static int tpClipCode(int x, int y)
+{
+int iCode = 0;
+
+  if (x < 0) iCode |= CLIP_LEFT;
+  else if (x >= bb_width) iCode |= CLIP_RIGHT;
+  if (y < 0) iCode |= CLIP_TOP;
+  else if (y >= bb_height) iCode |= CLIP_BOTTOM;
+  return iCode;
+} /* tpClipCode() */
+//
+// Draw a line between 2 points
+// Horizontal and vertical lines are drawn as spans. Other lines are
+// clipped to the back buffer (Cohen-Sutherland region codes to reject
+// or accept them quickly, then the first and last visible steps are
+// computed directly) so the visible part is drawn with exactly the same
+// pixels as the unclipped line would have.
+//
+void tpDrawLine(int x1, int y1, int x2, int y2, uint8_t ucColor)
+{
+  int temp;
+  int dx, dy;
+  int error;
+  uint8_t *p, mask;
+  int xinc, yinc;
+  int iCode1, iCode2;
+  int64_t k0, k1, n0, e0, m;
+
+  if (pBackBuffer == NULL)
+     return;
+  if (iDLMode == DL_MODE_RECORD) {
+     if (x1 < -32768 || x1 > 32767 || x2 < -32768 || x2 > 32767 || y1 < -32768 || y1 > 32767 || y2 < -32768 || y2 > 32767)
+        return; // won't fit in the record
+     tpDLAdd(DL_LINE, ucColor, (y1 < y2) ? y1 : y2, (y1 < y2) ? y2 : y1, x1, y1, x2, y2, NULL, NULL, 0);
+     return;
+  }
+  y1 -= bb_top; y2 -= bb_top; // band relative
+  if (y1 == y2) { // horizontal
+     tpFillSpans(x1, x2, y1, y1, ucColor);
+     return;
+  }
+  if (x1 == x2) { // vertical
+     tpDrawVSpan(x1, y1, y2, ucColor);
+     return;
+  }
+  iCode1 = tpClipCode(x1, y1);
+  iCode2 = tpClipCode(x2, y2);
+  if (iCode1 & iCode2) // both ends off the same side
+     return;
+  dx = x2 - x1;
+  dy = y2 - y1;
+
+  if(abs(dx) > abs(dy)) {
+    // X major case
+    if(x2 < x1) {
+      dx = -dx;
+      temp = x1;
+      x1 = x2;
+      x2 = temp;
+      temp = y1;
+      y1 = y2;
+      y2 = temp;
+    }
+
+    dy = (y2 - y1);
+    error = dx >> 1;
+    yinc = 1;
+    if (dy < 0)
+    {
+      dy = -dy;
+      yinc = -1;
+    }
+    e0 = error;
+    k0 = 0; k1 = dx; // steps to draw
+    if (iCode1 | iCode2) { // needs clipping
+      if (x1 < 0) k0 = -x1;
+      if (x2 >= bb_width) k1 = bb_width - 1 - x1;
+      if (yinc > 0) { // visible minor steps are 0-y1 to bb_height-1-y1
+        m = tpLineFirstStep(-y1, dx, dy, e0);
+        if (m > k0) k0 = m;
+        m = tpLineFirstStep(bb_height - y1, dx, dy, e0) - 1;
+        if (m < k1) k1 = m;
+      } else { // visible minor steps are y1-(bb_height-1) to y1
+        m = tpLineFirstStep(y1 - bb_height + 1, dx, dy, e0);
+        if (m > k0) k0 = m;
+        m = tpLineFirstStep(y1 + 1, dx, dy, e0) - 1;
+        if (m < k1) k1 = m;
+      }
+      if (k0 > k1) return; // misses the buffer
+    }
+    n0 = tpLineMinorSteps(k0, dx, dy, e0);
+    m = tpLineMinorSteps(k1, dx, dy, e0) - n0; // minor steps to take
+    error = (int)(e0 - (k0 * dy) + (n0 * dx)); // stepper state at the first visible pixel
+    x1 += (int)k0;
+    y1 += (int)n0 * yinc;
+    x2 = x1 + (int)(k1 - k0);
+    if (yinc > 0)
+      tpMarkDirty(y1, y1 + (int)m);
+    else
+      tpMarkDirty(y1 - (int)m, y1);
+    p = &pBackBuffer[(y1 * bb_pitch) + (x1 >> 3)]; // point to current spot in back buffer
+    mask = 0x80 >> (x1 & 7); // current bit offset
+    for(; x1 <= x2; x1++) {
+      if (ucColor)
+        *p |= mask; // set pixel and increment x pointer
+      else
+        *p &= ~mask;
+      mask >>= 1;
+      if (mask == 0) {
+         mask = 0x80;
+         p++;
+      }
+      error -= dy;
+      if (error < 0)
+      {
+        error += dx;
+        if (yinc > 0)
+           p += bb_pitch;
+        else
+           p -= bb_pitch;
+      }
+    } // for x1
+  }
+  else {
+    // Y major case
+    if(y1 > y2) {
+      dy = -dy;
+      temp = x1;
+      x1 = x2;
+      x2 = temp;
+      temp = y1;
+      y1 = y2;
+      y2 = temp;
+    }
+
+    dx = (x2 - x1);
+    error = dy >> 1;
+    xinc = 1;
+    if (dx < 0)
+    {
+      dx = -dx;
+      xinc = -1;
+    }
+    e0 = error;
+    k0 = 0; k1 = dy; // steps to draw
+    if (iCode1 | iCode2) { // needs clipping
+      if (y1 < 0) k0 = -y1;
+      if (y2 >= bb_height) k1 = bb_height - 1 - y1;
+      if (xinc > 0) {
+        m = tpLineFirstStep(-x1, dy, dx, e0);
+        if (m > k0) k0 = m;
+        m = tpLineFirstStep(bb_width - x1, dy, dx, e0) - 1;
+        if (m < k1) k1 = m;
+      } else {
+        m = tpLineFirstStep(x1 - bb_width + 1, dy, dx, e0);
+        if (m > k0) k0 = m;
+        m = tpLineFirstStep(x1 + 1, dy, dx, e0) - 1;
+        if (m < k1) k1 = m;
+      }
+      if (k0 > k1) return; // misses the buffer
+      n0 = tpLineMinorSteps(k0, dy, dx, e0);
+      error = (int)(e0 - (k0 * dx) + (n0 * dy)); // stepper state at the first visible pixel
+      y1 += (int)k0;
+      x1 += (int)n0 * xinc;
+      y2 = y1 + (int)(k1 - k0);
+    }
+    tpMarkDirty(y1, y2);
+    p = &pBackBuffer[(y1 * bb_pitch) + (x1 >> 3)]; // point to current spot in back buffer
+    mask = 0x80 >> (x1 & 7); // current bit offset
+    for(; y1 <= y2; y1++) {
+      if (ucColor)
+         *p |= mask; // set the pixel
+      else
+         *p &= ~mask;
+      p += bb_pitch; // y++
+      error -= dx;
+      if (error < 0)
+      {
+        error += dy;
+        x1 += xinc;
+        if (xinc > 0)
+        {
+          mask >>= 1;
+          if (mask == 0) // change the byte
+          {
+             p++;
+             mask = 0x80;
+          }
+        } // positive delta x
+        else // negative delta x
+        {
+          mask <<= 1;
+          if (mask == 0)
+          {
+             p--;
+             mask = 1;
+          }
+        }
+      }
+    } // for y
+  } // y major case
+} /* tpDrawLine() */
+//
+// Draw a rectangle (outline or filled) between 2 corners (inclusive)
+// Built from spans so it's much faster than drawing pixels or lines
+//
+void tpDrawRect(int x1, int y1, int x2, int y2, uint8_t ucColor, int bFilled)
+{
+int temp;
+
+  if (pBackBuffer == NULL)
+     return;
+  if (x1 > x2) { temp = x1; x1 = x2; x2 = temp; }
+  if (y1 > y2) { temp = y1; y1 = y2; y2 = temp; }
+  if (iDLMode == DL_MODE_RECORD) {
+     if (x1 < -32768 || x2 > 32767 || y1 < -32768 || y2 > 32767)
+        return;
+     tpDLAdd(DL_RECT, ucColor | (bFilled ? 2 : 0), y1, y2, x1, y1, x2, y2, NULL, NULL, 0);
+     return;
+  }
+  y1 -= bb_top; y2 -= bb_top; // band relative
+  if (bFilled) {
+     tpFillSpans(x1, x2, y1, y2, ucColor);
+  } else {
+     tpFillSpans(x1, x2, y1, y1, ucColor); // top
+     tpFillSpans(x1, x2, y2, y2, ucColor); // bottom
+     tpDrawVSpan(x1, y1, y2, ucColor); // left
+     tpDrawVSpan(x2, y1, y2, ucColor); // right
+  }
+} /* tpDrawRect() */
+//
+// Polygon scanline filler
+// Edges are sorted by their first scanline; an active edge table holds
+// the ones crossing the current scanline, sorted by x. Pixels whose centers
+// are inside the shape are filled as whole spans.
+//
+#define TP_MAX_EDGES 256
+#define TP_PATH_BREAK -32768 // x value of the point which ends a path contour
+typedef struct tag_tpedge {
+  int32_t x; // x (16.16) where the edge crosses the center of the current scanline
+  int32_t dx; // change in x per scanline (16.16)
+  int16_t yStart, yEnd; // scanlines crossed [yStart, yEnd)
+  int8_t iDir; // +1 = downward, -1 = upward (for the non-zero rule)
+} TPEDGE;
+static TPEDGE tpEdges[TP_MAX_EDGES];
+static uint8_t ucActiveEdges[TP_MAX_EDGES];
+//
+// Add the edges of one closed contour (back buffer coordinates)
+// Edges which don't cross the back buffer rows are left out
+// returns the new edge count or -1 if the table is full
+//
+static int tpAddEdges(TPPOINT *pPoints, int iCount, int iEdges)
+{
+int i, x0, y0, x1, y1, iDir, t;
+TPEDGE *pEdge;
+
+  for (i=0; i<iCount; i++) {
+    x0 = pPoints[i].x; y0 = pPoints[i].y - bb_top;
+    x1 = pPoints[(i+1) % iCount].x; y1 = pPoints[(i+1) % iCount].y - bb_top;
+    if (y0 == y1) continue; // horizontal edges don't contribute
+    iDir = 1;
+    if (y0 > y1) { // make it point down
+      t = x0; x0 = x1; x1 = t;
+      t = y0; y0 = y1; y1 = t;
+      iDir = -1;
+    }
+    if (y1 <= 0 || y0 >= bb_height) continue; // not in this band
+    if (iEdges >= TP_MAX_EDGES) return -1;
+    pEdge = &tpEdges[iEdges++];
+    pEdge->dx = (int32_t)((int64_t)(x1 - x0) * 65536 / (y1 - y0));
+    pEdge->x = (int32_t)x0 * 65536 + (pEdge->dx >> 1); // at the center of the first scanline
+    if (y0 < 0) { // starts above the band
+      pEdge->x += pEdge->dx * -y0;
+      y0 = 0;
+    }
+    pEdge->yStart = (int16_t)y0;
+    pEdge->yEnd = (int16_t)((y1 > bb_height) ? bb_height : y1);
+    pEdge->iDir = (int8_t)iDir;
+  }
+  return iEdges;
+} /* tpAddEdges() */
+//
+// Fill the span between two edge crossings on back buffer row y
+//
+static void tpFillEdgeSpan(int32_t xLeft, int32_t xRight, int y, uint8_t ucColor)
+{
+int x1, x2;
+
+  x1 = (xLeft + 0x7fff) >> 16; // first pixel center at or right of xLeft
+  x2 = ((xRight + 0x7fff) >> 16) - 1; // last pixel center left of xRight
+  if (x1 <= x2)
+    tpFillSpans(x1, x2, y, y, ucColor);
+} /* tpFillEdgeSpan() */
+//
+// Fill a list of points (page coordinates)
+// TP_PATH_BREAK points separate multiple contours; each one is closed
+// returns 0 for success, -1 if there are too many edges
+//
+static int tpFillPoints(TPPOINT *pPoints, int iCount, int iRule, uint8_t ucColor)
+{
+int i, j, y, iStart, iEdges, iNext, iActive, iWinding;
+uint8_t ucEdge;
+int32_t xLeft = 0;
+TPEDGE *pEdge;
+
+  iEdges = iStart = 0;
+  for (i=0; i<=iCount; i++) {
+    if (i == iCount || pPoints[i].x == TP_PATH_BREAK) { // end of a contour
+      if (i - iStart >= 2) {
+        iEdges = tpAddEdges(&pPoints[iStart], i - iStart, iEdges);
+        if (iEdges < 0) return -1;
+      }
+      iStart = i + 1;
+    }
+  }
+  if (iEdges == 0) return 0;
+  // sort the edges by starting scanline
+  for (i=1; i<iEdges; i++) {
+    TPEDGE e = tpEdges[i];
+    for (j=i; j>0 && tpEdges[j-1].yStart > e.yStart; j--)
+      tpEdges[j] = tpEdges[j-1];
+    tpEdges[j] = e;
+  }
+  iNext = iActive = 0;
+  for (y = tpEdges[0].yStart; y < bb_height && (iNext < iEdges || iActive); y++) {
+    // drop the edges which ended and add the ones which start here
+    for (i=j=0; i<iActive; i++) {
+      if (tpEdges[ucActiveEdges[i]].yEnd > y)
+        ucActiveEdges[j++] = ucActiveEdges[i];
+    }
+    iActive = j;
+    while (iNext < iEdges && tpEdges[iNext].yStart <= y)
+      ucActiveEdges[iActive++] = (uint8_t)iNext++;
+    // keep them sorted by x (they rarely change order)
+    for (i=1; i<iActive; i++) {
+      ucEdge = ucActiveEdges[i];
+      for (j=i; j>0 && tpEdges[ucActiveEdges[j-1]].x > tpEdges[ucEdge].x; j--)
+        ucActiveEdges[j] = ucActiveEdges[j-1];
+      ucActiveEdges[j] = ucEdge;
+    }
+    if (iRule == FILL_EVEN_ODD) {
+      for (i=0; i+1<iActive; i+=2)
+        tpFillEdgeSpan(tpEdges[ucActiveEdges[i]].x, tpEdges[ucActiveEdges[i+1]].x, y, ucColor);
+    } else { // non-zero winding
+      iWinding = 0;
+      for (i=0; i<iActive; i++) {
+        pEdge = &tpEdges[ucActiveEdges[i]];
+        if (iWinding == 0)
+          xLeft = pEdge->x;
+        iWinding += pEdge->iDir;
+        if (iWinding == 0)
+          tpFillEdgeSpan(xLeft, pEdge->x, y, ucColor);
+      }
+    }
+    for (i=0; i<iActive; i++) // step to the next scanline
+      tpEdges[ucActiveEdges[i]].x += tpEdges[ucActiveEdges[i]].dx;
+  } // for y
+  return 0;
+} /* tpFillPoints() */
+//
+// Draw the outline of a list of points with lines
+// Each contour ending in a TP_PATH_BREAK point is closed if the
+// break point's y is non-zero; a final contour without one uses bClose
+//
+static void tpOutlinePoints(TPPOINT *pPoints, int iCount, int bClose, uint8_t ucColor)
+{
+int i, iStart = 0;
+
+  for (i=0; i<=iCount; i++) {
+    if (i == iCount || pPoints[i].x == TP_PATH_BREAK) { // end of a contour
+      if (i - iStart >= 2 && ((i < iCount) ? pPoints[i].y : bClose))
+        tpDrawLine(pPoints[i-1].x, pPoints[i-1].y, pPoints[iStart].x, pPoints[iStart].y, ucColor);
+      iStart = i + 1;
+    } else if (i > iStart) {
+      tpDrawLine(pPoints[i-1].x, pPoints[i-1].y, pPoints[i].x, pPoints[i].y, ucColor);
+    }
+  }
+} /* tpOutlinePoints() */
+//
+// Record a polygon or path in the display list
+//
+static int tpDLAddPoints(TPPOINT *pPoints, int iCount, uint8_t ucFlags, int iRule)
+{
+int i, iTop = 32767, iBottom = -32768;
+
+  for (i=0; i<iCount; i++) {
+    if (pPoints[i].x == TP_PATH_BREAK) continue;
+    if (pPoints[i].y < iTop) iTop = pPoints[i].y;
+    if (pPoints[i].y > iBottom) iBottom = pPoints[i].y;
+  }
+  if (iTop > iBottom) return 0; // nothing to draw
+  return tpDLAdd(DL_POLY, ucFlags, iTop, iBottom, iCount, iRule, 0, 0, NULL, pPoints, iCount * sizeof(TPPOINT));
+} /* tpDLAddPoints() */
+//
+// Fill a polygon
+// iRule = FILL_EVEN_ODD or FILL_NON_ZERO
+// returns 0 for success, -1 if it has too many edges
+//
+int tpFillPolygon(TPPOINT *pPoints, int iCount, int iRule, uint8_t ucColor)
+{
+  if (pBackBuffer == NULL || pPoints == NULL || iCount < 3)
+    return -1;
+  if (iDLMode == DL_MODE_RECORD)
+    return tpDLAddPoints(pPoints, iCount, (ucColor & 1) | 2, iRule);
+  return tpFillPoints(pPoints, iCount, iRule, ucColor);
+} /* tpFillPolygon() */
+//
+// Draw the outline of a polygon
+//
+int tpDrawPolygon(TPPOINT *pPoints, int iCount, uint8_t ucColor)
+{
+  if (pBackBuffer == NULL || pPoints == NULL || iCount < 2)
+    return -1;
+  if (iDLMode == DL_MODE_RECORD)
+    return tpDLAddPoints(pPoints, iCount, (ucColor & 1) | 4, 0);
+  tpOutlinePoints(pPoints, iCount, 1, ucColor);
+  return 0;
+} /* tpDrawPolygon() */
+//
+// Start a new (empty) path
+// The path stores its points in the memory you provide
+//
+void tpPathInit(TPPATH *pPath, TPPOINT *pPoints, int iMaxPoints)
+{
+  pPath->pPoints = pPoints;
+  pPath->iMax = iMaxPoints;
+  pPath->iCount = pPath->iContour = 0;
+} /* tpPathInit() */
+//
+// Add a point to the path
+//
+static int tpPathAdd(TPPATH *pPath, int x, int y)
+{
+  if (pPath->iCount >= pPath->iMax)
+    return -1;
+  pPath->pPoints[pPath->iCount].x = (int16_t)x;
+  pPath->pPoints[pPath->iCount].y = (int16_t)y;
+  pPath->iCount++;
+  return 0;
+} /* tpPathAdd() */
+//
+// Start a new contour at the given point
+//
+int tpPathMoveTo(TPPATH *pPath, int x, int y)
+{
+  if (pPath->iCount > pPath->iContour) { // end the current contour (open)
+    if (tpPathAdd(pPath, TP_PATH_BREAK, 0)) return -1;
+  }
+  pPath->iContour = pPath->iCount;
+  return tpPathAdd(pPath, x, y);
+} /* tpPathMoveTo() */
+//
+// Add a straight line from the current point
+//
+int tpPathLineTo(TPPATH *pPath, int x, int y)
+{
+  return tpPathAdd(pPath, x, y);
+} /* tpPathLineTo() */
+//
+// Number of line segments to use for a curve with the given control points
+// More segments for longer control polygons
+//
+static int tpCurveSteps(TPPOINT *pCtrl, int iCount)
+{
+int i, iLen = 0;
+
+  for (i=1; i<iCount; i++)
+    iLen += abs(pCtrl[i].x - pCtrl[i-1].x) + abs(pCtrl[i].y - pCtrl[i-1].y);
+  i = 2;
+  while (i < 32 && i*i < iLen*2) // ~sqrt(2*length)
+    i++;
+  return i;
+} /* tpCurveSteps() */
+//
+// Add a quadratic Bezier curve from the current point
+//
+int tpPathQuadTo(TPPATH *pPath, int cx, int cy, int x, int y)
+{
+TPPOINT pts[3];
+int i, n;
+int32_t a, b, c, n2;
+
+  if (pPath->iCount == pPath->iContour) return -1; // no current point
+  pts[0] = pPath->pPoints[pPath->iCount-1];
+  pts[1].x = cx; pts[1].y = cy;
+  pts[2].x = x; pts[2].y = y;
+  n = tpCurveSteps(pts, 3);
+  n2 = n * n;
+  for (i=1; i<=n; i++) {
+    a = (n-i)*(n-i); b = 2*i*(n-i); c = i*i; // Bernstein weights * n^2
+    if (tpPathAdd(pPath, (a*pts[0].x + b*cx + c*x + n2/2) / n2 - (a*pts[0].x + b*cx + c*x + n2/2 < 0),
+                         (a*pts[0].y + b*cy + c*y + n2/2) / n2 - (a*pts[0].y + b*cy + c*y + n2/2 < 0)))
+      return -1;
+  }
+  return 0;
+} /* tpPathQuadTo() */
+//
+// Add a cubic Bezier curve from the current point
+//
+int tpPathCubicTo(TPPATH *pPath, int c1x, int c1y, int c2x, int c2y, int x, int y)
+{
+TPPOINT pts[4];
+int i, n;
+int64_t a, b, c, d, n3, sx, sy;
+
+  if (pPath->iCount == pPath->iContour) return -1; // no current point
+  pts[0] = pPath->pPoints[pPath->iCount-1];
+  pts[1].x = c1x; pts[1].y = c1y;
+  pts[2].x = c2x; pts[2].y = c2y;
+  pts[3].x = x; pts[3].y = y;
+  n = tpCurveSteps(pts, 4);
+  n3 = n * n * n;
+  for (i=1; i<=n; i++) {
+    a = (n-i)*(n-i)*(n-i); b = 3*i*(n-i)*(n-i); c = 3*i*i*(n-i); d = i*i*i;
+    sx = a*pts[0].x + b*c1x + c*c2x + d*x + n3/2;
+    sy = a*pts[0].y + b*c1y + c*c2y + d*y + n3/2;
+    if (tpPathAdd(pPath, (int)((sx >= 0) ? sx / n3 : -((n3 - 1 - sx) / n3)),
+                         (int)((sy >= 0) ? sy / n3 : -((n3 - 1 - sy) / n3))))
+      return -1;
+  }
+  return 0;
+} /* tpPathCubicTo() */
+//
+// Close the current contour with a line back to its first point
+//
+int tpPathClose(TPPATH *pPath)
+{
+  if (pPath->iCount == pPath->iContour) return 0; // nothing to close
+  if (tpPathAdd(pPath, TP_PATH_BREAK, 1)) return -1;
+  pPath->iContour = pPath->iCount;
+  return 0;
+} /* tpPathClose() */
+//
+// Fill a path; every contour is treated as closed
+// iRule = FILL_EVEN_ODD or FILL_NON_ZERO
+// returns 0 for success, -1 if it has too many edges
+//
+int tpFillPath(TPPATH *pPath, int iRule, uint8_t ucColor)
+{
+  if (pBackBuffer == NULL || pPath == NULL)
+    return -1;
+  if (iDLMode == DL_MODE_RECORD)
+    return tpDLAddPoints(pPath->pPoints, pPath->iCount, (ucColor & 1) | 2, iRule);
+  return tpFillPoints(pPath->pPoints, pPath->iCount, iRule, ucColor);
+} /* tpFillPath() */
+//
+// Draw the outline of a path
+//
+int tpDrawPath(TPPATH *pPath, uint8_t ucColor)
+{
+  if (pBackBuffer == NULL || pPath == NULL)
+    return -1;
+  if (iDLMode == DL_MODE_RECORD)
+    return tpDLAddPoints(pPath->pPoints, pPath->iCount, ucColor & 1, 0);
+  tpOutlinePoints(pPath->pPoints, pPath->iCount, 0, ucColor);
+  return 0;
+} /* tpDrawPath() */
+//
+// Integer square root
+//
+static uint32_t tpISqrt(uint32_t n)
+{
+uint32_t root = 0, bit = 1UL << 30;
+
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+} /* tpISqrt() */
+//
+// Half width of an ellipse on the row dy from its center (-1 if outside)
+// Pixels with x^2/rx^2 + y^2/ry^2 <= 1 + 1/max(rx,ry) are inside, which
+// gives nicely rounded small circles
+//
+static int tpEllipseHalfWidth(int rx, int ry, int dy)
+{
+int64_t m;
+
+  if (dy < 0) dy = -dy;
+  if (dy > ry) return -1;
+  if (ry == 0) return rx;
+  m = (rx > ry) ? rx : ry;
+  return (int)tpISqrt((uint32_t)(((int64_t)rx * rx * ((int64_t)(ry * ry - dy * dy) * m + (int64_t)ry * ry)) / ((int64_t)ry * ry * m)));
+} /* tpEllipseHalfWidth() */
+//
+// Shapes drawn a row at a time provide the span of each row
+// returns 0 if the row is outside the shape
+//
+typedef int (*TP_ROW_SPAN)(int *pParams, int y, int *pLeft, int *pRight);
+
+static int tpEllipseSpan(int *pParams, int y, int *pLeft, int *pRight)
+{
+int w = tpEllipseHalfWidth(pParams[2], pParams[3], y - pParams[1]);
+
+  if (w < 0) return 0;
+  *pLeft = pParams[0] - w;
+  *pRight = pParams[0] + w;
+  return 1;
+} /* tpEllipseSpan() */
+
+static int tpRoundRectSpan(int *pParams, int y, int *pLeft, int *pRight)
+{
+int r = pParams[4], iInset = 0;
+
+  if (y < pParams[1] || y > pParams[3]) return 0;
+  if (y < pParams[1] + r)
+    iInset = r - tpEllipseHalfWidth(r, r, pParams[1] + r - y);
+  else if (y > pParams[3] - r)
+    iInset = r - tpEllipseHalfWidth(r, r, y - (pParams[3] - r));
+  *pLeft = pParams[0] + iInset;
+  *pRight = pParams[2] - iInset;
+  return 1;
+} /* tpRoundRectSpan() */
+//
+// Draw a shape one row at a time (page rows y1 to y2)
+// The outline of each row is the part not covered by both rows next to it
+//
+static void tpDrawRowShape(int y1, int y2, TP_ROW_SPAN pfnSpan, int *pParams, uint8_t ucColor, int bFilled)
+{
+int y, l, r, lp, rp, ln, rn, a;
+
+  if (y1 < bb_top) y1 = bb_top;
+  if (y2 > bb_top + bb_height - 1) y2 = bb_top + bb_height - 1;
+  for (y=y1; y<=y2; y++) {
+    if (!(*pfnSpan)(pParams, y, &l, &r))
+      continue;
+    if (bFilled) {
+      tpFillSpans(l, r, y - bb_top, y - bb_top, ucColor);
+      continue;
+    }
+    if (!(*pfnSpan)(pParams, y-1, &lp, &rp)) { lp = INT16_MAX; rp = INT16_MIN; }
+    if (!(*pfnSpan)(pParams, y+1, &ln, &rn)) { ln = INT16_MAX; rn = INT16_MIN; }
+    a = ((lp > ln) ? lp : ln) - 1; // left edge
+    if (a < l) a = l;
+    if (a > r) a = r;
+    tpFillSpans(l, a, y - bb_top, y - bb_top, ucColor);
+    a = ((rp < rn) ? rp : rn) + 1; // right edge
+    if (a > r) a = r;
+    if (a < l) a = l;
+    tpFillSpans(a, r, y - bb_top, y - bb_top, ucColor);
+  }
+} /* tpDrawRowShape() */
+//
+// Draw an ellipse (outline or filled) centered on x,y
+//
+void tpDrawEllipse(int x, int y, int rx, int ry, uint8_t ucColor, int bFilled)
+{
+int params[4];
+
+  if (pBackBuffer == NULL || rx < 0 || ry < 0)
+    return;
+  if (iDLMode == DL_MODE_RECORD) {
+    tpDLAdd(DL_ELLIPSE, (ucColor & 1) | (bFilled ? 2 : 0), y - ry, y + ry, x, y, rx, ry, NULL, NULL, 0);
+    return;
+  }
+  params[0] = x; params[1] = y; params[2] = rx; params[3] = ry;
+  tpDrawRowShape(y - ry, y + ry, tpEllipseSpan, params, ucColor, bFilled);
+} /* tpDrawEllipse() */
+//
+// Draw a circle (outline or filled) centered on x,y
+//
+void tpDrawCircle(int x, int y, int r, uint8_t ucColor, int bFilled)
+{
+  tpDrawEllipse(x, y, r, r, ucColor, bFilled);
+} /* tpDrawCircle() */
+//
+// Draw a rectangle with rounded corners of radius r
+//
+void tpDrawRoundRect(int x1, int y1, int x2, int y2, int r, uint8_t ucColor, int bFilled)
+{
+int params[5], temp;
+int16_t i16;
+
+  if (pBackBuffer == NULL)
+    return;
+  if (x1 > x2) { temp = x1; x1 = x2; x2 = temp; }
+  if (y1 > y2) { temp = y1; y1 = y2; y2 = temp; }
+  if (r > (x2 - x1) / 2) r = (x2 - x1) / 2;
+  if (r > (y2 - y1) / 2) r = (y2 - y1) / 2;
+  if (r < 0) r = 0;
+  if (iDLMode == DL_MODE_RECORD) {
+    i16 = (int16_t)r;
+    tpDLAdd(DL_ROUNDRECT, (ucColor & 1) | (bFilled ? 2 : 0), y1, y2, x1, y1, x2, y2, NULL, &i16, sizeof(i16));
+    return;
+  }
+  params[0] = x1; params[1] = y1; params[2] = x2; params[3] = y2; params[4] = r;
+  tpDrawRowShape(y1, y2, tpRoundRectSpan, params, ucColor, bFilled);
+} /* tpDrawRoundRect() */
+
+//
+// Grayscale images
+// Rows of 8-bit gray pixels are dithered to 1-bpp as they arrive.
+// Error diffusion works in integers with 4 fractional bits (the kernel
+// weights are in 16ths). The error pushed to the right on the same row is
+// carried in variables, so only 2 rows of errors are kept: the next row
+// and the current one, whose entries are reused for the row after next
+// (Atkinson) as soon as they've been read. Odd rows are scanned right to
+// left (serpentine) so the errors don't drift in one direction.
+//
+// 8x8 Bayer matrix scaled to thresholds of 2-254
+const uint8_t ucBayer8[64] PROGMEM = {
+    2,130, 34,162, 10,138, 42,170,
+  194, 66,226, 98,202, 74,234,106,
+   50,178, 18,146, 58,186, 26,154,
+  242,114,210, 82,250,122,218, 90,
+   14,142, 46,174,  6,134, 38,166,
+  206, 78,238,110,198, 70,230,102,
+   62,190, 30,158, 54,182, 22,150,
+  254,126,222, 94,246,118,214, 86};
+//
+// Tone curves which suit each printer model's paper and head
+// (gamma in 1/100ths, contrast, black point, white point)
+//
+const int16_t sTonePresets[][4] PROGMEM = {
+  {170, 15, 12, 240}, // PRINTER_X18_9556: midtones print much too dark
+};
+//
+// Build a 256 entry lookup table of gray levels
+// Levels at or below iBlack become 0 and at or above iWhite become 255;
+// the range in between is raised to the power 100/iGamma (so > 100
+// lightens the midtones) and its contrast around middle gray is changed
+// by iContrast percent (-100 to 100)
+//
+int tpToneCurve(uint8_t *pLUT, int iGamma, int iContrast, int iBlack, int iWhite)
+{
+int i, v;
+float f, fExp;
+
+  if (pLUT == NULL || iGamma < 10 || iGamma > 1000 || iContrast < -100 || iContrast > 100)
+    return -1;
+  if (iBlack < 0 || iWhite > 255 || iBlack >= iWhite)
+    return -1;
+  fExp = 100.0f / (float)iGamma;
+  for (i=0; i<256; i++) {
+    if (i <= iBlack) {
+      v = 0;
+    } else if (i >= iWhite) {
+      v = 255;
+    } else {
+      f = (float)(i - iBlack) / (float)(iWhite - iBlack);
+      v = (int)(255.0f * powf(f, fExp) + 0.5f);
+      v = 128 + ((v - 128) * (100 + iContrast)) / 100;
+      if (v < 0) v = 0;
+      else if (v > 255) v = 255;
+    }
+    pLUT[i] = (uint8_t)v;
+  }
+  return 0;
+} /* tpToneCurve() */
+//
+// Build the tone curve suggested for a printer model (PRINTER_xxx)
+//
+int tpPrinterToneCurve(uint8_t *pLUT, int iPrinterType)
+{
+  if (iPrinterType < 0 || iPrinterType >= (int)(sizeof(sTonePresets) / sizeof(sTonePresets[0])))
+    return -1;
+  return tpToneCurve(pLUT, (int16_t)pgm_read_word(&sTonePresets[iPrinterType][0]),
+            (int16_t)pgm_read_word(&sTonePresets[iPrinterType][1]),
+            (int16_t)pgm_read_word(&sTonePresets[iPrinterType][2]),
+            (int16_t)pgm_read_word(&sTonePresets[iPrinterType][3]));
+} /* tpPrinterToneCurve() */
+//
+// Add a tone curve and/or sharpening ahead of the dither
+// pWindow holds the last 3 (toned) input rows and the filtered row
+//
+int tpDitherSetFilter(TPDITHER *pDither, const uint8_t *pLUT, int iSharpen, uint8_t *pWindow)
+{
+  if (pDither == NULL || iSharpen < 0 || iSharpen > 16 || pDither->iRow != 0)
+    return -1;
+  if (pWindow == NULL && (pLUT != NULL || iSharpen != 0))
+    return -1;
+  pDither->pTone = pLUT;
+  pDither->ucSharpen = (uint8_t)iSharpen;
+  pDither->pWindow = (pLUT != NULL || iSharpen != 0) ? pWindow : NULL;
+  pDither->iRowsIn = 0;
+  return 0;
+} /* tpDitherSetFilter() */
+//
+// Copy a row through the tone curve (if any)
+//
+static void tpToneRow(const uint8_t *pTone, const uint8_t *pSrc, uint8_t *pDest, int iWidth)
+{
+int x;
+
+  if (pTone == NULL) {
+    memcpy(pDest, pSrc, iWidth);
+    return;
+  }
+  for (x=0; x<iWidth; x++)
+    pDest[x] = pTone[pSrc[x]];
+} /* tpToneRow() */
+//
+// Run the next input row through the tone curve and unsharp mask and
+// return the row to dither, or NULL if there isn't one yet.
+// The 3x3 mask needs the row below, so with sharpening enabled the output
+// is one row behind the input and pGray == NULL flushes the last row
+// (the edge rows and columns are repeated). The blur is the 1-2-1 kernel
+// (weights in 16ths), applied as running column sums.
+//
+static const uint8_t *tpFilterRow(TPDITHER *pDither, const uint8_t *pGray)
+{
+int x, xr, v, iSum0, iSum1, iSum2, iRow, iWidth = pDither->iWidth;
+uint8_t *pAbove, *pCur, *pBelow, *pOut = &pDither->pWindow[iWidth * 3];
+
+  if (pDither->ucSharpen == 0) { // tone curve only, no delay
+    if (pGray == NULL)
+      return NULL;
+    tpToneRow(pDither->pTone, pGray, pOut, iWidth);
+    return pOut;
+  }
+  iRow = pDither->iRow; // the row to output
+  if (pGray) {
+    tpToneRow(pDither->pTone, pGray, &pDither->pWindow[(pDither->iRowsIn % 3) * iWidth], iWidth);
+    pDither->iRowsIn++;
+    if (pDither->iRowsIn < 2)
+      return NULL;
+    pBelow = &pDither->pWindow[((iRow + 1) % 3) * iWidth];
+  } else {
+    if (iRow >= pDither->iRowsIn) // nothing left to flush
+      return NULL;
+    pBelow = &pDither->pWindow[(iRow % 3) * iWidth];
+  }
+  pCur = &pDither->pWindow[(iRow % 3) * iWidth];
+  pAbove = (iRow == 0) ? pCur : &pDither->pWindow[((iRow + 2) % 3) * iWidth];
+  // vertical 1-2-1 sums of the columns to the left, center and right
+  iSum1 = pAbove[0] + 2*pCur[0] + pBelow[0];
+  iSum0 = iSum1;
+  for (x=0; x<iWidth; x++) {
+    xr = (x < iWidth-1) ? x+1 : x;
+    iSum2 = pAbove[xr] + 2*pCur[xr] + pBelow[xr];
+    // center + amount * (center - blur), amount in quarters
+    v = pCur[x] + (((pCur[x] * 16) - (iSum0 + 2*iSum1 + iSum2)) * pDither->ucSharpen) / 64;
+    if (v < 0) v = 0;
+    else if (v > 255) v = 255;
+    pOut[x] = (uint8_t)v;
+    iSum0 = iSum1; iSum1 = iSum2;
+  }
+  return pOut;
+} /* tpFilterRow() */
+//
+// Start dithering an image iWidth pixels wide
+//
+int tpDitherInit(TPDITHER *pDither, int iMode, int iWidth, int16_t *pErrors)
+{
+  if (pDither == NULL || iWidth < 1 || iWidth > TP_MAX_DITHER_WIDTH)
+    return -1;
+  if (iMode < DITHER_FLOYD_STEINBERG || iMode > DITHER_BAYER)
+    return -1;
+  if (pErrors == NULL && iMode != DITHER_BAYER)
+    return -1;
+  pDither->pErrors = pErrors;
+  pDither->iWidth = iWidth;
+  pDither->iRow = 0;
+  pDither->ucMode = (uint8_t)iMode;
+  pDither->pTone = NULL;
+  pDither->pWindow = NULL;
+  pDither->ucSharpen = 0;
+  pDither->iRowsIn = 0;
+  if (pErrors)
+    memset(pErrors, 0, TP_DITHER_ERRORS(iWidth) * sizeof(int16_t));
+  return 0;
+} /* tpDitherInit() */
+//
+// Dither the next row into packed 1-bpp pixels (MSB first, 1 = black)
+// Returns 1 if a row was written to pOut, 0 if not (sharpening delays the
+// output by a row; pGray = NULL flushes it)
+//
+int tpDitherRow(TPDITHER *pDither, const uint8_t *pGray, uint8_t *pOut)
+{
+int i, x, dx, v, iErr, e1, e2, iWidth = pDither->iWidth;
+int16_t *pCur, *pNext;
+uint8_t ucThresh[8];
+
+  if (pDither->pWindow) // tone curve / sharpening
+    pGray = tpFilterRow(pDither, pGray);
+  if (pGray == NULL)
+    return 0;
+  if (pDither->ucMode == DITHER_BAYER) {
+    memcpy_P(ucThresh, &ucBayer8[(pDither->iRow & 7) * 8], 8);
+    tpThresholdRow(pGray, ucThresh, 8, pOut, iWidth);
+    pDither->iRow++;
+    return 1;
+  }
+  memset(pOut, 0, (iWidth + 7) >> 3);
+  // the two error rows swap places on each row; 2 spare entries on each side
+  pCur = &pDither->pErrors[2 + (pDither->iRow & 1) * (iWidth + 4)];
+  pNext = &pDither->pErrors[2 + ((pDither->iRow & 1) ^ 1) * (iWidth + 4)];
+  if (pDither->iRow & 1) { // right to left
+    x = iWidth - 1; dx = -1;
+  } else {
+    x = 0; dx = 1;
+  }
+  e1 = e2 = 0; // error for the next 2 pixels on this row
+  for (i=0; i<iWidth; i++, x += dx) {
+    v = pGray[x] + ((pCur[x] + e1 + 8) >> 4);
+    if (v < 0) v = 0;
+    else if (v > 255) v = 255;
+    if (v < 128) { // black
+      pOut[x >> 3] |= (0x80 >> (x & 7));
+      iErr = v;
+    } else {
+      iErr = v - 255;
+    }
+    if (pDither->ucMode == DITHER_FLOYD_STEINBERG) { // 7/16 ahead, 3,5,1/16 below
+      e1 = e2 + iErr * 7;
+      pNext[x - dx] += iErr * 3;
+      pNext[x] += iErr * 5;
+      pNext[x + dx] += iErr;
+      pCur[x] = 0;
+    } else { // Atkinson: 1/8 to 2 pixels ahead, 3 below and 1 two rows down
+      e1 = e2 + iErr * 2;
+      e2 = iErr * 2;
+      pNext[x - dx] += iErr * 2;
+      pNext[x] += iErr * 2;
+      pNext[x + dx] += iErr * 2;
+      pCur[x] = iErr * 2; // this row's entries now belong to the row after next
+    }
+  }
+  pNext[-1] = pNext[iWidth] = 0; // the spare entries never carry anything
+  pDither->iRow++;
+  return 1;
+} /* tpDitherRow() */
+//
+// Dither the next row into the back buffer
+//
+int tpDitherToBuffer(TPDITHER *pDither, const uint8_t *pGray, int x, int y)
+{
+uint8_t ucRow[TP_MAX_DITHER_WIDTH / 8];
+
+  if (pBackBuffer == NULL || iDLMode == DL_MODE_RECORD || pDither == NULL)
+    return -1;
+  if (!tpDitherRow(pDither, pGray, ucRow))
+    return 0;
+  if (pDither->ucSharpen) // the output is a row behind
+    y--;
+  y -= bb_top; // band relative
+  if (y < 0 || y >= bb_height)
+    return 0;
+  tpCopyBits(ucRow, pDither->iWidth, x, y);
+  tpMarkDirty(y, y);
+  return 0;
+} /* tpDitherToBuffer() */
+//
+// Dither the next row and send it to the printer
+//
+int tpPrintGrayRow(TPDITHER *pDither, const uint8_t *pGray)
+{
+uint8_t ucRow[TP_MAX_DITHER_WIDTH / 8];
+int i, iPitch = (tpGetWidth() + 7) / 8;
+
+  if (!bConnected || pDither == NULL)
+    return -1;
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  tpStartStream();
+  memset(ucRow, 0, sizeof(ucRow));
+  if (!tpDitherRow(pDither, pGray, ucRow))
+    return 0;
+  for (i=0; i<iPitch && ucRow[i] == 0; i++) {};
+  if (i == iPitch) // white
+    iBlankRows++;
+  else
+    tpSendRow(ucRow, iPitch);
+  return 0;
+} /* tpPrintGrayRow() */
+//
+// Image scaling
+// An area average in both directions; each source row is resized
+// horizontally as it's pushed, then spread over the output rows it
+// overlaps. Whole number ratios take a faster horizontal path.
+//
+static int tpGCD(int a, int b)
+{
+int t;
+
+  while (b) {
+    t = a % b; a = b; b = t;
+  }
+  return a;
+} /* tpGCD() */
+//
+// Start resizing an image
+//
+int tpScaleInit(TPSCALER *pScaler, int iFormat, int iSrcWidth, int iSrcHeight, int iDestWidth, int iDestHeight, uint32_t *pMem)
+{
+int g;
+
+  if (pScaler == NULL || pMem == NULL || (iFormat != SCALE_GRAY8 && iFormat != SCALE_1BPP))
+    return -1;
+  if (iSrcWidth < 1 || iSrcWidth > TP_MAX_SCALE_SIZE || iSrcHeight < 1 || iSrcHeight > TP_MAX_SCALE_SIZE)
+    return -1;
+  if (iDestWidth == 0) {
+    iDestWidth = tpGetWidth();
+    if (iDestWidth == 0) // not connected
+      return -1;
+  }
+  if (iDestHeight == 0) // keep the aspect ratio
+    iDestHeight = (int)(((int32_t)iSrcHeight * iDestWidth + iSrcWidth/2) / iSrcWidth);
+  if (iDestHeight < 1) iDestHeight = 1;
+  if (iDestWidth < 1 || iDestWidth > TP_MAX_SCALE_SIZE || iDestHeight > TP_MAX_SCALE_SIZE)
+    return -1;
+  pScaler->pAccum = pMem;
+  pScaler->pRow = (uint16_t *)&pMem[iDestWidth];
+  pScaler->iSrcWidth = iSrcWidth; pScaler->iSrcHeight = iSrcHeight;
+  pScaler->iDestWidth = iDestWidth; pScaler->iDestHeight = iDestHeight;
+  pScaler->iSrcY = pScaler->iDestY = 0;
+  g = tpGCD(iSrcWidth, iDestWidth);
+  pScaler->usXSrc = (uint16_t)(iSrcWidth / g);
+  pScaler->usXDest = (uint16_t)(iDestWidth / g);
+  g = tpGCD(iSrcHeight, iDestHeight);
+  pScaler->usYSrc = (uint16_t)(iSrcHeight / g);
+  pScaler->usYDest = (uint16_t)(iDestHeight / g);
+  pScaler->ucFormat = (uint8_t)iFormat;
+  pScaler->bPending = 0;
+  memset(pMem, 0, iDestWidth * sizeof(uint32_t));
+  return 0;
+} /* tpScaleInit() */
+//
+// Read one source pixel as gray
+//
+static inline int tpScalePixel(TPSCALER *pScaler, const uint8_t *pSrc, int x)
+{
+  if (pScaler->ucFormat == SCALE_GRAY8)
+    return pSrc[x];
+  return (pSrc[x >> 3] & (0x80 >> (x & 7))) ? 0 : 255;
+} /* tpScalePixel() */
+//
+// Resize a source row horizontally into pRow
+//
+static void tpScaleRowH(TPSCALER *pScaler, const uint8_t *pSrc)
+{
+int s, d, k, v, iTake, iEnd, iSrcEnd;
+int iSrcUnits = pScaler->usXSrc, iDestUnits = pScaler->usXDest;
+uint32_t u32Sum, u32Pos;
+uint16_t *pRow = pScaler->pRow;
+
+  if (iDestUnits == 1) { // shrink by a whole number (1 = same size)
+    k = iSrcUnits;
+    for (d=0, s=0; d<pScaler->iDestWidth; d++) {
+      for (u32Sum=0, iEnd=s+k; s<iEnd; s++)
+        u32Sum += tpScalePixel(pScaler, pSrc, s);
+      pRow[d] = (uint16_t)((u32Sum * 16 + k/2) / k);
+    }
+  } else if (iSrcUnits == 1) { // enlarge by a whole number
+    k = iDestUnits;
+    for (s=0, d=0; s<pScaler->iSrcWidth; s++) {
+      v = tpScalePixel(pScaler, pSrc, s) * 16;
+      for (iEnd=d+k; d<iEnd; d++)
+        pRow[d] = (uint16_t)v;
+    }
+  } else { // walk both rows in units where they line up
+    s = 0; u32Pos = 0;
+    iSrcEnd = iDestUnits; // end of source pixel s
+    v = tpScalePixel(pScaler, pSrc, 0);
+    for (d=0; d<pScaler->iDestWidth; d++) {
+      iEnd = (d + 1) * iSrcUnits;
+      u32Sum = 0;
+      while ((int)u32Pos < iEnd) {
+        iTake = ((iSrcEnd < iEnd) ? iSrcEnd : iEnd) - (int)u32Pos;
+        u32Sum += iTake * v;
+        u32Pos += iTake;
+        if ((int)u32Pos == iSrcEnd && s < pScaler->iSrcWidth-1) {
+          s++;
+          iSrcEnd += iDestUnits;
+          v = tpScalePixel(pScaler, pSrc, s);
+        }
+      }
+      pRow[d] = (uint16_t)((u32Sum * 16 + iSrcUnits/2) / iSrcUnits);
+    }
+  }
+} /* tpScaleRowH() */
+//
+// Give the scaler the next source row
+//
+int tpScalePush(TPSCALER *pScaler, const uint8_t *pSrc)
+{
+  if (pScaler == NULL || pSrc == NULL || pScaler->bPending || pScaler->iSrcY >= pScaler->iSrcHeight)
+    return -1;
+  tpScaleRowH(pScaler, pSrc);
+  pScaler->bPending = 1;
+  return 0;
+} /* tpScalePush() */
+//
+// Add the pushed row's share of the current output row; if that finishes
+// the output row, write it out
+//
+int tpScalePull(TPSCALER *pScaler, uint8_t *pGray)
+{
+int x, iWeight, iSrcEnd, iDestEnd;
+uint32_t u32Div;
+uint32_t *pAccum;
+
+  if (pScaler == NULL || !pScaler->bPending)
+    return 0;
+  // rows in units: usYDest per source row, usYSrc per output row
+  iSrcEnd = (pScaler->iSrcY + 1) * pScaler->usYDest;
+  iDestEnd = (pScaler->iDestY + 1) * pScaler->usYSrc;
+  iWeight = ((iSrcEnd < iDestEnd) ? iSrcEnd : iDestEnd);
+  iWeight -= (pScaler->iSrcY * pScaler->usYDest > pScaler->iDestY * pScaler->usYSrc) ?
+             pScaler->iSrcY * pScaler->usYDest : pScaler->iDestY * pScaler->usYSrc;
+  pAccum = pScaler->pAccum;
+  if (iDestEnd > iSrcEnd) { // this output row needs more source rows
+    for (x=0; x<pScaler->iDestWidth; x++)
+      pAccum[x] += iWeight * pScaler->pRow[x];
+    pScaler->bPending = 0;
+    pScaler->iSrcY++;
+    return 0;
+  }
+  // the output row is complete
+  u32Div = pScaler->usYSrc * 16;
+  for (x=0; x<pScaler->iDestWidth; x++) {
+    pGray[x] = (uint8_t)((pAccum[x] + iWeight * pScaler->pRow[x] + u32Div/2) / u32Div);
+    pAccum[x] = 0;
+  }
+  pScaler->iDestY++;
+  if (iDestEnd == iSrcEnd) { // both end here
+    pScaler->bPending = 0;
+    pScaler->iSrcY++;
+  }
+  return 1;
+} /* tpScalePull() */
+//
+// Pick the decoder scale which lands just above the output width
+//
+int tpDecodeScale(int iWidth, int iDestWidth)
+{
+int iScale = 1;
+
+  if (iDestWidth <= 0)
+    iDestWidth = tpGetWidth();
+  if (iDestWidth <= 0) // not connected
+    return 1;
+  while (iScale < 8 && iWidth / (iScale * 2) >= iDestWidth)
+    iScale <<= 1;
+  return iScale;
+} /* tpDecodeScale() */
+//
+// Streamed BMP files
+// Only the header and one small chunk of a row are in memory at a time;
+// rows are read from their offset in the file, so bottom-up files (the
+// usual kind) print top first without buffering.
+//
+#define TP_BMP_CHUNK 48 // bytes read at a time (a whole number of 24-bit pixels)
+//
+// Gray level of a B,G,R color
+//
+static uint8_t tpBGRToGray(const uint8_t *p)
+{
+  return (uint8_t)((p[0] * 29 + p[1] * 150 + p[2] * 77) >> 8);
+} /* tpBGRToGray() */
+//
+// Read the headers and color table of a BMP file
+//
+int tpBMPOpen(TPBMP *pBMP, TP_READ_CALLBACK *pfnRead, void *pUser)
+{
+uint8_t ucHeader[54], ucEntry[4];
+int i, iColors, iHeaderSize;
+int32_t i32;
+
+  if (pBMP == NULL || pfnRead == NULL)
+    return -1;
+  if ((*pfnRead)(pUser, 0, ucHeader, sizeof(ucHeader)) != sizeof(ucHeader))
+    return -1;
+  if (ucHeader[0] != 'B' || ucHeader[1] != 'M')
+    return -1;
+  iHeaderSize = ucHeader[14] | (ucHeader[15] << 8);
+  if (iHeaderSize < 40) // OS/2 headers aren't supported
+    return -1;
+  pBMP->pfnRead = pfnRead;
+  pBMP->pUser = pUser;
+  pBMP->iDataOffset = ucHeader[10] | (ucHeader[11] << 8) | ((int32_t)ucHeader[12] << 16) | ((int32_t)ucHeader[13] << 24);
+  pBMP->iWidth = ucHeader[18] | (ucHeader[19] << 8) | ((int32_t)ucHeader[20] << 16) | ((int32_t)ucHeader[21] << 24);
+  i32 = ucHeader[22] | (ucHeader[23] << 8) | ((int32_t)ucHeader[24] << 16) | ((int32_t)ucHeader[25] << 24);
+  pBMP->bTopDown = (i32 < 0);
+  pBMP->iHeight = (i32 < 0) ? -i32 : i32;
+  pBMP->ucBpp = ucHeader[28];
+  if (ucHeader[30] | ucHeader[31] | ucHeader[32] | ucHeader[33]) // compressed
+    return -1;
+  if (pBMP->ucBpp != 1 && pBMP->ucBpp != 4 && pBMP->ucBpp != 8 && pBMP->ucBpp != 24)
+    return -1;
+  if (pBMP->iWidth < 1 || pBMP->iHeight < 1 || pBMP->iWidth > 32767)
+    return -1;
+  pBMP->iPitch = (((pBMP->iWidth * pBMP->ucBpp) + 31) >> 5) << 2; // rows are padded to 32 bits
+  pBMP->iRow = 0;
+  if (pBMP->ucBpp != 24) { // convert the color table to gray
+    iColors = ucHeader[46] | (ucHeader[47] << 8);
+    if (iColors == 0 || iColors > (1 << pBMP->ucBpp))
+      iColors = 1 << pBMP->ucBpp;
+    memset(pBMP->ucPalette, 0, sizeof(pBMP->ucPalette));
+    for (i=0; i<iColors; i++) {
+      if ((*pfnRead)(pUser, 14 + iHeaderSize + i*4, ucEntry, 4) != 4)
+        return -1;
+      pBMP->ucPalette[i] = tpBGRToGray(ucEntry);
+    }
+  }
+  return 0;
+} /* tpBMPOpen() */
+//
+// Read the next row of pixels as gray
+//
+int tpBMPReadRow(TPBMP *pBMP, uint8_t *pGray, int iCount)
+{
+uint8_t ucChunk[TP_BMP_CHUNK], *s;
+int32_t iOffset;
+int i, x, iLen, iBytes;
+
+  if (pBMP == NULL || pBMP->iRow >= pBMP->iHeight)
+    return -1;
+  if (iCount > pBMP->iWidth) iCount = pBMP->iWidth;
+  iOffset = pBMP->iDataOffset + (int32_t)pBMP->iPitch *
+            (pBMP->bTopDown ? pBMP->iRow : (pBMP->iHeight - 1 - pBMP->iRow));
+  iBytes = (iCount * pBMP->ucBpp + 7) >> 3; // only what's needed
+  x = 0;
+  while (iBytes > 0) {
+    iLen = (iBytes > TP_BMP_CHUNK) ? TP_BMP_CHUNK : iBytes;
+    if ((*pBMP->pfnRead)(pBMP->pUser, iOffset, ucChunk, iLen) != iLen)
+      return -1;
+    iOffset += iLen; iBytes -= iLen;
+    s = ucChunk;
+    switch (pBMP->ucBpp) {
+      case 24:
+        for (i=0; i<iLen; i+=3, s+=3)
+          pGray[x++] = tpBGRToGray(s);
+        break;
+      case 8:
+        for (i=0; i<iLen; i++)
+          pGray[x++] = pBMP->ucPalette[s[i]];
+        break;
+      case 4:
+        for (i=0; i<iLen; i++) {
+          pGray[x++] = pBMP->ucPalette[s[i] >> 4];
+          if (x < iCount) pGray[x++] = pBMP->ucPalette[s[i] & 0xf];
+        }
+        break;
+      case 1:
+        for (i=0; i<iLen*8 && x<iCount; i++)
+          pGray[x++] = pBMP->ucPalette[(s[i>>3] >> (7 - (i & 7))) & 1];
+        break;
+    }
+  }
+  pBMP->iRow++;
+  return 0;
+} /* tpBMPReadRow() */
+//
+// Read a row of gray pixels from one of the image readers
+//
+typedef int (TP_ROW_FUNC)(void *pImage, uint8_t *pGray, int iCount);
+//
+// Dither the rows of an image into the back buffer at x,y or print them
+//
+static int tpDitherImage(TP_ROW_FUNC *pfnRow, void *pImage, TPDITHER *pDither, int x, int y, int bPrint)
+{
+uint8_t ucGray[TP_MAX_DITHER_WIDTH];
+
+  if (pImage == NULL || pDither == NULL)
+    return -1;
+  if (bPrint && !bConnected)
+    return -1;
+  if (!bPrint && (pBackBuffer == NULL || iDLMode == DL_MODE_RECORD))
+    return -1;
+  memset(ucGray, 0xff, sizeof(ucGray)); // white past the right edge of the image
+  while ((*pfnRow)(pImage, ucGray, pDither->iWidth) == 0) {
+    if (bPrint) {
+      tpPrintGrayRow(pDither, ucGray);
+    } else {
+      if (y >= bb_top + bb_height) // the rest is off the bottom
+        break;
+      tpDitherToBuffer(pDither, ucGray, x, y++);
+    }
+  }
+  // finish a sharpened image
+  if (bPrint) {
+    tpPrintGrayRow(pDither, NULL);
+    tpFinishImage();
+  } else
+    tpDitherToBuffer(pDither, NULL, x, y);
+  return 0;
+} /* tpDitherImage() */
+
+static int tpBMPRow(void *pImage, uint8_t *pGray, int iCount)
+{
+  return tpBMPReadRow((TPBMP *)pImage, pGray, iCount);
+} /* tpBMPRow() */
+//
+// Dither the BMP into the back buffer
+//
+int tpDrawBMP(TPBMP *pBMP, TPDITHER *pDither, int x, int y)
+{
+  return tpDitherImage(tpBMPRow, pBMP, pDither, x, y, 0);
+} /* tpDrawBMP() */
+//
+// Dither the BMP and print it
+//
+int tpPrintBMP(TPBMP *pBMP, TPDITHER *pDither)
+{
+  return tpDitherImage(tpBMPRow, pBMP, pDither, 0, 0, 1);
+} /* tpPrintBMP() */
+//
+// Netpbm files
+// The binary formats (P4/P5) are read straight from each row's offset;
+// the text formats (P1/P2) are parsed in order through a small buffer.
+//
+//
+// Next byte of a Netpbm file (-1 at the end)
+//
+static int tpPNMGetc(TPPNM *pPNM)
+{
+  if (pPNM->iInPos >= pPNM->iInLen) {
+    pPNM->iInLen = (*pPNM->pfnRead)(pPNM->pUser, pPNM->iPos, pPNM->ucIn, sizeof(pPNM->ucIn));
+    pPNM->iInPos = 0;
+    if (pPNM->iInLen <= 0) {
+      pPNM->iInLen = 0;
+      return -1;
+    }
+    pPNM->iPos += pPNM->iInLen;
+  }
+  return pPNM->ucIn[pPNM->iInPos++];
+} /* tpPNMGetc() */
+//
+// Read a decimal number, skipping white space and comments
+// P1 pixels needn't be separated, so iMaxDigits can stop after one digit
+// returns -1 if there's no number
+//
+static int tpPNMNumber(TPPNM *pPNM, int iMaxDigits)
+{
+int c, v = 0, n = 0;
+
+  do {
+    c = tpPNMGetc(pPNM);
+    if (c == '#') { // comment to the end of the line
+      while (c != '\n' && c != '\r' && c != -1)
+        c = tpPNMGetc(pPNM);
+    }
+  } while (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f');
+  while (c >= '0' && c <= '9') {
+    if (v < 100000) v = v * 10 + (c - '0');
+    if (++n == iMaxDigits)
+      return v;
+    c = tpPNMGetc(pPNM);
+  }
+  if (c != -1 && c != ' ' && c != '\t' && c != '\n' && c != '\r')
+    pPNM->iInPos--; // not ours, read it again next time
+  return (n == 0) ? -1 : v;
+} /* tpPNMNumber() */
+//
+// Read the header of a Netpbm file
+//
+int tpPNMOpen(TPPNM *pPNM, TP_READ_CALLBACK *pfnRead, void *pUser)
+{
+int c;
+
+  if (pPNM == NULL || pfnRead == NULL)
+    return -1;
+  pPNM->pfnRead = pfnRead;
+  pPNM->pUser = pUser;
+  pPNM->iPos = 0;
+  pPNM->iInPos = pPNM->iInLen = 0;
+  if (tpPNMGetc(pPNM) != 'P')
+    return -1;
+  c = tpPNMGetc(pPNM) - '0';
+  if (c != 1 && c != 2 && c != 4 && c != 5)
+    return -1;
+  pPNM->ucType = (uint8_t)c;
+  pPNM->iWidth = tpPNMNumber(pPNM, 0);
+  pPNM->iHeight = tpPNMNumber(pPNM, 0);
+  // bitmaps have no max value; the last number ends with 1 white space byte
+  pPNM->iMaxVal = (c == 1 || c == 4) ? 1 : tpPNMNumber(pPNM, 0);
+  if (pPNM->iWidth < 1 || pPNM->iWidth > 32767 || pPNM->iHeight < 1 || pPNM->iMaxVal < 1 || pPNM->iMaxVal > 65535)
+    return -1;
+  pPNM->iDataOffset = pPNM->iPos - pPNM->iInLen + pPNM->iInPos;
+  pPNM->iRow = 0;
+  return 0;
+} /* tpPNMOpen() */
+//
+// Read the next row of a Netpbm file as gray
+//
+int tpPNMReadRow(TPPNM *pPNM, uint8_t *pGray, int iCount)
+{
+int x, i, v, iLen, iBytes, iSample;
+int32_t iOffset;
+
+  if (pPNM == NULL || pPNM->iRow >= pPNM->iHeight)
+    return -1;
+  if (iCount > pPNM->iWidth) iCount = pPNM->iWidth;
+  if (pPNM->ucType == 1 || pPNM->ucType == 2) { // text
+    for (x=0; x<pPNM->iWidth; x++) {
+      v = tpPNMNumber(pPNM, (pPNM->ucType == 1) ? 1 : 0);
+      if (v < 0)
+        return -1;
+      if (x >= iCount) continue; // parsed, but not used
+      if (pPNM->ucType == 1)
+        pGray[x] = v ? 0 : 255; // 1 = black
+      else
+        pGray[x] = (v >= pPNM->iMaxVal) ? 255 : (uint8_t)((v * 255) / pPNM->iMaxVal);
+    }
+  } else { // binary; the rows can be read in any order
+    iSample = (pPNM->iMaxVal > 255) ? 2 : 1;
+    if (pPNM->ucType == 4) {
+      iOffset = pPNM->iDataOffset + (int32_t)pPNM->iRow * ((pPNM->iWidth + 7) >> 3);
+      iBytes = (iCount + 7) >> 3;
+    } else {
+      iOffset = pPNM->iDataOffset + (int32_t)pPNM->iRow * pPNM->iWidth * iSample;
+      iBytes = iCount * iSample;
+    }
+    x = 0;
+    while (iBytes > 0) {
+      iLen = (iBytes > (int)sizeof(pPNM->ucIn)) ? (int)sizeof(pPNM->ucIn) : iBytes;
+      if ((*pPNM->pfnRead)(pPNM->pUser, iOffset, pPNM->ucIn, iLen) != iLen)
+        return -1;
+      iOffset += iLen; iBytes -= iLen;
+      if (pPNM->ucType == 4) {
+        for (i=0; i<iLen*8 && x<iCount; i++)
+          pGray[x++] = (pPNM->ucIn[i>>3] & (0x80 >> (i & 7))) ? 0 : 255;
+      } else {
+        for (i=0; i<iLen; i+=iSample) {
+          v = (iSample == 2) ? ((pPNM->ucIn[i] << 8) | pPNM->ucIn[i+1]) : pPNM->ucIn[i];
+          pGray[x++] = (v >= pPNM->iMaxVal) ? 255 : (uint8_t)(((int32_t)v * 255) / pPNM->iMaxVal);
+        }
+      }
+    }
+  }
+  pPNM->iRow++;
+  return 0;
+} /* tpPNMReadRow() */
+
+static int tpPNMRow(void *pImage, uint8_t *pGray, int iCount)
+{
+  return tpPNMReadRow((TPPNM *)pImage, pGray, iCount);
+} /* tpPNMRow() */
+//
+// Dither a Netpbm image into the back buffer
+//
+int tpDrawPNM(TPPNM *pPNM, TPDITHER *pDither, int x, int y)
+{
+  return tpDitherImage(tpPNMRow, pPNM, pDither, x, y, 0);
+} /* tpDrawPNM() */
+//
+// Dither a Netpbm image and print it
+//
+int tpPrintPNM(TPPNM *pPNM, TPDITHER *pDither)
+{
+  return tpDitherImage(tpPNMRow, pPNM, pDither, 0, 0, 1);
+} /* tpPrintPNM() */
+//
+// PNG files
+// The compressed data is inflated a row at a time straight from the IDAT
+// chunks; the 32K window keeps the history that the LZ77 matches copy
+// from, and the filters only need the row above. Huffman codes of up to
+// TP_HUFF_FAST_BITS are decoded with a table lookup, longer ones a bit at
+// a time.
+//
+const uint16_t usLenBase[29] PROGMEM = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,
+  35,43,51,59,67,83,99,115,131,163,195,227,258};
+const uint8_t ucLenExtra[29] PROGMEM = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
+const uint16_t usDistBase[30] PROGMEM = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
+  257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+const uint8_t ucDistExtra[30] PROGMEM = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+// order of the code length code lengths in a dynamic block header
+const uint8_t ucCodeLenOrder[19] PROGMEM = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+
+static uint32_t tpBE32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+} /* tpBE32() */
+//
+// Check the length of the chunk at iPos: PNG limits it to 2^31-1 and the
+// chunk (with its CRC) has to end inside the file
+//
+static int tpPNGChunkOK(TP_READ_CALLBACK *pfnRead, void *pUser, int32_t iPos, int32_t iLen)
+{
+uint8_t uc[4];
+
+  if (iLen < 0 || iLen > 0x7fffffff - 12 - iPos)
+    return 0;
+  return ((*pfnRead)(pUser, iPos + 8 + iLen, uc, 4) == 4);
+} /* tpPNGChunkOK() */
+//
+// Next byte of compressed data (-1 after the last IDAT chunk)
+//
+static int tpPNGByte(TPPNG *pPNG)
+{
+uint8_t ucHeader[8];
+int iLen;
+
+  while (pPNG->iInPos >= pPNG->iInLen) {
+    if (pPNG->bEOF)
+      return -1;
+    if (pPNG->iChunkLeft == 0) { // skip the CRC, the data continues in the next IDAT
+      if ((*pPNG->pfnRead)(pPNG->pUser, pPNG->iPos + 4, ucHeader, 8) != 8 || memcmp(&ucHeader[4], "IDAT", 4) != 0 ||
+          !tpPNGChunkOK(pPNG->pfnRead, pPNG->pUser, pPNG->iPos + 4, (int32_t)tpBE32(ucHeader))) {
+        pPNG->bEOF = 1;
+        return -1;
+      }
+      pPNG->iChunkLeft = (int32_t)tpBE32(ucHeader);
+      pPNG->iPos += 12;
+      continue;
+    }
+    iLen = (pPNG->iChunkLeft > (int32_t)sizeof(pPNG->ucIn)) ? (int)sizeof(pPNG->ucIn) : (int)pPNG->iChunkLeft;
+    iLen = (*pPNG->pfnRead)(pPNG->pUser, pPNG->iPos, pPNG->ucIn, iLen);
+    if (iLen <= 0) {
+      pPNG->bEOF = 1;
+      return -1;
+    }
+    pPNG->iPos += iLen;
+    pPNG->iChunkLeft -= iLen;
+    pPNG->iInPos = 0;
+    pPNG->iInLen = iLen;
+  }
+  return pPNG->ucIn[pPNG->iInPos++];
+} /* tpPNGByte() */
+//
+// Make sure there are at least 25 bits in the bit buffer
+// (zeros are added past the end of the data)
+//
+static void tpPNGFill(TPPNG *pPNG)
+{
+int c;
+
+  while (pPNG->iBitCount <= 24) {
+    c = tpPNGByte(pPNG);
+    if (c < 0) c = 0;
+    pPNG->u32Bits |= (uint32_t)c << pPNG->iBitCount;
+    pPNG->iBitCount += 8;
+  }
+} /* tpPNGFill() */
+//
+// Read n bits (0-16), least significant first
+//
+static int tpPNGBits(TPPNG *pPNG, int n)
+{
+int v;
+
+  if (n == 0)
+    return 0;
+  tpPNGFill(pPNG);
+  v = (int)(pPNG->u32Bits & ((1UL << n) - 1));
+  pPNG->u32Bits >>= n;
+  pPNG->iBitCount -= n;
+  return v;
+} /* tpPNGBits() */
+//
+// Build a canonical Huffman decoder from the code lengths of n symbols
+// returns -1 if the lengths are over-subscribed
+//
+static int tpHuffBuild(TPHUFF *pHuff, const uint8_t *pLengths, int n)
+{
+int i, j, iLen, iLeft, iCode, iRev;
+uint16_t usOffset[16], usNext[16];
+
+  memset(pHuff->usCount, 0, sizeof(pHuff->usCount));
+  for (i=0; i<n; i++)
+    pHuff->usCount[pLengths[i]]++;
+  pHuff->usCount[0] = 0;
+  iLeft = 1;
+  for (iLen=1; iLen<16; iLen++) {
+    iLeft = (iLeft << 1) - pHuff->usCount[iLen];
+    if (iLeft < 0)
+      return -1;
+  }
+  // symbols sorted by code length, then value
+  usOffset[1] = 0;
+  for (iLen=1; iLen<15; iLen++)
+    usOffset[iLen+1] = usOffset[iLen] + pHuff->usCount[iLen];
+  for (i=0; i<n; i++) {
+    if (pLengths[i])
+      pHuff->usSymbol[usOffset[pLengths[i]]++] = (uint16_t)i;
+  }
+  // the short codes go in the lookup table, indexed by the bits as they
+  // arrive (the reverse of the code)
+  memset(pHuff->usFast, 0, sizeof(pHuff->usFast));
+  iCode = 0;
+  for (iLen=1; iLen<16; iLen++) {
+    iCode = (iCode + pHuff->usCount[iLen-1]) << 1;
+    usNext[iLen] = (uint16_t)iCode;
+  }
+  for (i=0; i<n; i++) {
+    iLen = pLengths[i];
+    if (iLen == 0) continue;
+    iCode = usNext[iLen]++;
+    if (iLen > TP_HUFF_FAST_BITS) continue;
+    for (iRev=0, j=0; j<iLen; j++)
+      iRev |= ((iCode >> j) & 1) << (iLen - 1 - j);
+    for (j=iRev; j<(1 << TP_HUFF_FAST_BITS); j += (1 << iLen))
+      pHuff->usFast[j] = (uint16_t)((i << 4) | iLen);
+  }
+  return 0;
+} /* tpHuffBuild() */
+//
+// Decode one symbol (-1 for an invalid code)
+//
+static int tpHuffDecode(TPPNG *pPNG, TPHUFF *pHuff)
+{
+int iLen, iCode, iFirst, iIndex, iCount;
+uint16_t us;
+
+  tpPNGFill(pPNG);
+  us = pHuff->usFast[pPNG->u32Bits & ((1 << TP_HUFF_FAST_BITS) - 1)];
+  if (us) {
+    pPNG->u32Bits >>= (us & 15);
+    pPNG->iBitCount -= (us & 15);
+    return us >> 4;
+  }
+  iCode = iFirst = iIndex = 0;
+  for (iLen=1; iLen<16; iLen++) {
+    iCode |= tpPNGBits(pPNG, 1);
+    iCount = pHuff->usCount[iLen];
+    if (iCode - iCount < iFirst)
+      return pHuff->usSymbol[iIndex + (iCode - iFirst)];
+    iIndex += iCount;
+    iFirst = (iFirst + iCount) << 1;
+    iCode <<= 1;
+  }
+  return -1;
+} /* tpHuffDecode() */
+//
+// Read the code tables of a dynamic Huffman block
+//
+static int tpInflateTables(TPPNG *pPNG)
+{
+uint8_t ucLengths[286 + 30];
+int i, iLit, iDist, iCodes, iSym, iLen, iRepeat;
+
+  iLit = tpPNGBits(pPNG, 5) + 257;
+  iDist = tpPNGBits(pPNG, 5) + 1;
+  iCodes = tpPNGBits(pPNG, 4) + 4;
+  if (iLit > 286 || iDist > 30)
+    return -1;
+  memset(ucLengths, 0, 19);
+  for (i=0; i<iCodes; i++)
+    ucLengths[pgm_read_byte(&ucCodeLenOrder[i])] = (uint8_t)tpPNGBits(pPNG, 3);
+  if (tpHuffBuild(&pPNG->litHuff, ucLengths, 19)) // the code length code, for now
+    return -1;
+  for (i=0; i<iLit + iDist; ) {
+    iSym = tpHuffDecode(pPNG, &pPNG->litHuff);
+    if (iSym < 0)
+      return -1;
+    if (iSym < 16) {
+      ucLengths[i++] = (uint8_t)iSym;
+      continue;
+    }
+    iLen = 0;
+    if (iSym == 16) { // repeat the previous length 3-6 times
+      if (i == 0)
+        return -1;
+      iLen = ucLengths[i-1];
+      iRepeat = 3 + tpPNGBits(pPNG, 2);
+    } else if (iSym == 17) { // 3-10 zeros
+      iRepeat = 3 + tpPNGBits(pPNG, 3);
+    } else { // 11-138 zeros
+      iRepeat = 11 + tpPNGBits(pPNG, 7);
+    }
+    if (i + iRepeat > iLit + iDist)
+      return -1;
+    while (iRepeat--)
+      ucLengths[i++] = (uint8_t)iLen;
+  }
+  if (ucLengths[256] == 0) // no end of block code
+    return -1;
+  if (tpHuffBuild(&pPNG->litHuff, ucLengths, iLit) || tpHuffBuild(&pPNG->distHuff, &ucLengths[iLit], iDist))
+    return -1;
+  return 0;
+} /* tpInflateTables() */
+//
+// Set up the fixed Huffman codes
+//
+static void tpInflateFixed(TPPNG *pPNG)
+{
+uint8_t ucLengths[288];
+
+  memset(ucLengths, 8, 144);
+  memset(&ucLengths[144], 9, 112);
+  memset(&ucLengths[256], 7, 24);
+  memset(&ucLengths[280], 8, 8);
+  tpHuffBuild(&pPNG->litHuff, ucLengths, 288);
+  memset(ucLengths, 5, 30);
+  tpHuffBuild(&pPNG->distHuff, ucLengths, 30);
+} /* tpInflateFixed() */
+//
+// Inflate the next iLen bytes; the state is kept between calls so a
+// block or match can continue into the next row
+// returns the number of bytes written (less at the end of the data)
+// or -1 for corrupt data
+//
+static int tpInflate(TPPNG *pPNG, uint8_t *pOut, int iLen)
+{
+int n = 0, iSym, iType;
+uint8_t uc;
+
+  while (n < iLen) {
+    if (pPNG->iCopyLeft) { // continue a match
+      uc = pPNG->ucWindow[(pPNG->usWinPos - pPNG->iCopyDist) & 0x7fff];
+      pPNG->iCopyLeft--;
+    } else if (!pPNG->bInBlock) {
+      if (pPNG->bLastBlock)
+        return n; // end of the data
+      pPNG->bLastBlock = (uint8_t)tpPNGBits(pPNG, 1);
+      iType = tpPNGBits(pPNG, 2);
+      if (iType == 0) { // stored; starts on the next byte
+        tpPNGBits(pPNG, pPNG->iBitCount & 7);
+        pPNG->iStoredLeft = tpPNGBits(pPNG, 16);
+        if ((pPNG->iStoredLeft ^ 0xffff) != tpPNGBits(pPNG, 16))
+          return -1;
+      } else if (iType == 1) {
+        tpInflateFixed(pPNG);
+      } else if (iType == 2) {
+        if (tpInflateTables(pPNG))
+          return -1;
+      } else {
+        return -1;
+      }
+      pPNG->ucBlockType = (uint8_t)iType;
+      pPNG->bInBlock = 1;
+      continue;
+    } else if (pPNG->ucBlockType == 0) {
+      if (pPNG->iStoredLeft == 0) {
+        pPNG->bInBlock = 0;
+        continue;
+      }
+      uc = (uint8_t)tpPNGBits(pPNG, 8);
+      pPNG->iStoredLeft--;
+    } else {
+      iSym = tpHuffDecode(pPNG, &pPNG->litHuff);
+      if (iSym < 0 || iSym > 285)
+        return -1;
+      if (iSym == 256) { // end of block
+        pPNG->bInBlock = 0;
+        continue;
+      }
+      if (iSym < 256) {
+        uc = (uint8_t)iSym;
+      } else { // length / distance pair
+        iSym -= 257;
+        pPNG->iCopyLeft = pgm_read_word(&usLenBase[iSym]) + tpPNGBits(pPNG, pgm_read_byte(&ucLenExtra[iSym]));
+        iSym = tpHuffDecode(pPNG, &pPNG->distHuff);
+        if (iSym < 0 || iSym > 29)
+          return -1;
+        pPNG->iCopyDist = pgm_read_word(&usDistBase[iSym]) + tpPNGBits(pPNG, pgm_read_byte(&ucDistExtra[iSym]));
+        continue;
+      }
+    }
+    pPNG->ucWindow[pPNG->usWinPos] = uc;
+    pPNG->usWinPos = (pPNG->usWinPos + 1) & 0x7fff;
+    pOut[n++] = uc;
+  }
+  return n;
+} /* tpInflate() */
+//
+// Gray level of a pixel with alpha, drawn over white paper
+//
+static uint8_t tpOverWhite(int iGray, int iAlpha)
+{
+  return (uint8_t)((iGray * iAlpha + 255 * (255 - iAlpha) + 127) / 255);
+} /* tpOverWhite() */
+//
+// Read the PNG header chunks up to the image data
+//
+int tpPNGOpen(TPPNG *pPNG, TP_READ_CALLBACK *pfnRead, void *pUser, uint8_t *pRowMem, int iRowMemSize)
+{
+uint8_t uc[29];
+int i, j, n, iBits;
+int32_t iPos, iLen;
+const uint8_t ucSignature[8] = {137, 'P', 'N', 'G', 13, 10, 26, 10};
+
+  if (pPNG == NULL || pfnRead == NULL || pRowMem == NULL)
+    return -1;
+  if ((*pfnRead)(pUser, 0, uc, 29) != 29 || memcmp(uc, ucSignature, 8) != 0 || memcmp(&uc[12], "IHDR", 4) != 0)
+    return -1;
+  pPNG->pfnRead = pfnRead;
+  pPNG->pUser = pUser;
+  pPNG->iWidth = (int)tpBE32(&uc[16]);
+  pPNG->iHeight = (int)tpBE32(&uc[20]);
+  pPNG->ucDepth = uc[24];
+  pPNG->ucColorType = uc[25];
+  if (pPNG->iWidth < 1 || pPNG->iWidth > 32767 || pPNG->iHeight < 1 || uc[26] != 0 || uc[27] != 0 || uc[28] != 0)
+    return -1; // bad size, unknown compression/filter or interlaced
+  switch (pPNG->ucColorType) {
+    case 0: // gray
+      pPNG->ucChannels = 1;
+      if (pPNG->ucDepth != 1 && pPNG->ucDepth != 2 && pPNG->ucDepth != 4 && pPNG->ucDepth != 8 && pPNG->ucDepth != 16)
+        return -1;
+      break;
+    case 3: // palette
+      pPNG->ucChannels = 1;
+      if (pPNG->ucDepth != 1 && pPNG->ucDepth != 2 && pPNG->ucDepth != 4 && pPNG->ucDepth != 8)
+        return -1;
+      break;
+    case 2: // RGB
+    case 4: // gray + alpha
+    case 6: // RGBA
+      pPNG->ucChannels = (pPNG->ucColorType == 2) ? 3 : ((pPNG->ucColorType == 4) ? 2 : 4);
+      if (pPNG->ucDepth != 8 && pPNG->ucDepth != 16)
+        return -1;
+      break;
+    default:
+      return -1;
+  }
+  iBits = pPNG->ucChannels * pPNG->ucDepth;
+  pPNG->iPitch = (int)(((int32_t)pPNG->iWidth * iBits + 7) >> 3);
+  pPNG->ucPixelBytes = (uint8_t)((iBits < 8) ? 1 : (iBits >> 3));
+  if (iRowMemSize < 2 * (pPNG->iPitch + 1))
+    return -1;
+  pPNG->pCur = pRowMem;
+  pPNG->pPrev = &pRowMem[pPNG->iPitch + 1];
+  memset(pPNG->pPrev, 0, pPNG->iPitch + 1); // the row above the first is 0
+  memset(pPNG->ucPalette, 0, sizeof(pPNG->ucPalette));
+  // find the palette and the first IDAT chunk
+  iPos = 8 + 8 + 13 + 4;
+  while (1) {
+    if ((*pfnRead)(pUser, iPos, uc, 8) != 8)
+      return -1;
+    iLen = (int32_t)tpBE32(uc);
+    if (!tpPNGChunkOK(pfnRead, pUser, iPos, iLen))
+      return -1; // corrupt or cut short
+    if (memcmp(&uc[4], "IDAT", 4) == 0)
+      break;
+    if (memcmp(&uc[4], "IEND", 4) == 0)
+      return -1;
+    if (memcmp(&uc[4], "PLTE", 4) == 0) { // RGB entries
+      n = (int)(iLen / 3);
+      if (n > 256) n = 256;
+      for (i=0; i<n; i+=85) { // 85 entries per read
+        j = ((n - i) > 85) ? 85 : (n - i);
+        if ((*pfnRead)(pUser, iPos + 8 + i*3, pPNG->ucIn, j*3) != j*3)
+          return -1;
+        while (j--) {
+          const uint8_t *p = &pPNG->ucIn[j*3];
+          pPNG->ucPalette[i + j] = (uint8_t)((p[0] * 77 + p[1] * 150 + p[2] * 29) >> 8);
+        }
+      }
+    } else if (memcmp(&uc[4], "tRNS", 4) == 0 && pPNG->ucColorType == 3) { // palette alpha
+      n = (iLen > 256) ? 256 : (int)iLen;
+      if ((*pfnRead)(pUser, iPos + 8, pPNG->ucIn, n) != n)
+        return -1;
+      for (i=0; i<n; i++)
+        pPNG->ucPalette[i] = tpOverWhite(pPNG->ucPalette[i], pPNG->ucIn[i]);
+    }
+    iPos += 12 + iLen; // length, type, data, CRC
+  }
+  pPNG->iPos = iPos + 8;
+  pPNG->iChunkLeft = iLen;
+  pPNG->iInPos = pPNG->iInLen = 0;
+  pPNG->bEOF = 0;
+  pPNG->u32Bits = 0;
+  pPNG->iBitCount = 0;
+  pPNG->bInBlock = pPNG->bLastBlock = 0;
+  pPNG->iStoredLeft = pPNG->iCopyLeft = 0;
+  pPNG->usWinPos = 0;
+  pPNG->iRow = 0;
+  // zlib header: deflate, no preset dictionary
+  i = tpPNGByte(pPNG);
+  j = tpPNGByte(pPNG);
+  if (i < 0 || j < 0 || (i & 0xf) != 8 || ((i << 8) | j) % 31 != 0 || (j & 0x20))
+    return -1;
+  return 0;
+} /* tpPNGOpen() */
+//
+// Paeth predictor
+//
+static int tpPaeth(int a, int b, int c)
+{
+int p, pa, pb, pc;
+
+  p = a + b - c;
+  pa = (p > a) ? p - a : a - p;
+  pb = (p > b) ? p - b : b - p;
+  pc = (p > c) ? p - c : c - p;
+  if (pa <= pb && pa <= pc) return a;
+  return (pb <= pc) ? b : c;
+} /* tpPaeth() */
+//
+// Inflate, unfilter and convert the next row
+//
+int tpPNGReadRow(TPPNG *pPNG, uint8_t *pGray, int iCount)
+{
+int i, x, v, a, iBpp, iPitch, iStep, iBit, iMax;
+uint8_t *d, *u, *pTemp;
+const uint8_t *s;
+
+  if (pPNG == NULL || pPNG->iRow >= pPNG->iHeight)
+    return -1;
+  iPitch = pPNG->iPitch;
+  if (tpInflate(pPNG, pPNG->pCur, iPitch + 1) != iPitch + 1)
+    return -1;
+  d = &pPNG->pCur[1]; u = &pPNG->pPrev[1];
+  iBpp = pPNG->ucPixelBytes;
+  switch (pPNG->pCur[0]) { // filter type
+    case 0: // none
+      break;
+    case 1: // sub
+      for (i=iBpp; i<iPitch; i++)
+        d[i] += d[i - iBpp];
+      break;
+    case 2: // up
+      for (i=0; i<iPitch; i++)
+        d[i] += u[i];
+      break;
+    case 3: // average
+      for (i=0; i<iPitch; i++)
+        d[i] += (((i >= iBpp) ? d[i - iBpp] : 0) + u[i]) >> 1;
+      break;
+    case 4: // Paeth
+      for (i=0; i<iPitch; i++) {
+        if (i >= iBpp)
+          d[i] += (uint8_t)tpPaeth(d[i - iBpp], u[i], u[i - iBpp]);
+        else
+          d[i] += u[i];
+      }
+      break;
+    default:
+      return -1;
+  }
+  if (iCount > pPNG->iWidth) iCount = pPNG->iWidth;
+  if (pPNG->ucDepth < 8) { // packed gray or palette
+    iMax = (1 << pPNG->ucDepth) - 1;
+    for (x=0, iBit=0; x<iCount; x++, iBit += pPNG->ucDepth) {
+      v = (d[iBit >> 3] >> (8 - pPNG->ucDepth - (iBit & 7))) & iMax;
+      pGray[x] = (pPNG->ucColorType == 3) ? pPNG->ucPalette[v] : (uint8_t)((v * 255) / iMax);
+    }
+  } else { // 8 or 16-bit samples (the high byte of 16 comes first)
+    iStep = pPNG->ucDepth >> 3;
+    for (x=0; x<iCount; x++) {
+      s = &d[x * pPNG->ucChannels * iStep];
+      switch (pPNG->ucColorType) {
+        case 0:
+          pGray[x] = s[0];
+          break;
+        case 3:
+          pGray[x] = pPNG->ucPalette[s[0]];
+          break;
+        case 4:
+          pGray[x] = tpOverWhite(s[0], s[iStep]);
+          break;
+        default: // RGB(A)
+          v = (s[0] * 77 + s[iStep] * 150 + s[2*iStep] * 29) >> 8;
+          a = (pPNG->ucColorType == 6) ? s[3*iStep] : 255;
+          pGray[x] = tpOverWhite(v, a);
+          break;
+      }
+    }
+  }
+  pTemp = pPNG->pCur; pPNG->pCur = pPNG->pPrev; pPNG->pPrev = pTemp;
+  pPNG->iRow++;
+  return 0;
+} /* tpPNGReadRow() */
+
+static int tpPNGRow(void *pImage, uint8_t *pGray, int iCount)
+{
+  return tpPNGReadRow((TPPNG *)pImage, pGray, iCount);
+} /* tpPNGRow() */
+//
+// Dither a PNG image into the back buffer
+//
+int tpDrawPNG(TPPNG *pPNG, TPDITHER *pDither, int x, int y)
+{
+  return tpDitherImage(tpPNGRow, pPNG, pDither, x, y, 0);
+} /* tpDrawPNG() */
+//
+// Dither a PNG image and print it
+//
+int tpPrintPNG(TPPNG *pPNG, TPDITHER *pDither)
+{
+  return tpDitherImage(tpPNGRow, pPNG, pDither, 0, 0, 1);
+} /* tpPrintPNG() */
+//
+// Print-ready image blobs
+// Everything tpSendScanline() does for each row (mirroring, framing,
+// checksums) is done once when the blob is made, so printing a logo is
+// just sending the stored packets. A CRC-32 guards against damaged copies.
+//
+// CRC-32 (IEEE) of 4 bits at a time
+const uint32_t u32CRCNibble[16] PROGMEM = {
+  0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+  0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+// printer width in dots of each PRINTER_xxx model
+const uint16_t usPrinterWidths[] PROGMEM = {384};
+
+static uint32_t tpCRC32(uint32_t u32CRC, const uint8_t *pData, int iLen)
+{
+int i;
+
+  u32CRC = ~u32CRC;
+  for (i=0; i<iLen; i++) {
+    u32CRC ^= pData[i];
+    u32CRC = (u32CRC >> 4) ^ pgm_read_dword(&u32CRCNibble[u32CRC & 15]);
+    u32CRC = (u32CRC >> 4) ^ pgm_read_dword(&u32CRCNibble[u32CRC & 15]);
+  }
+  return ~u32CRC;
+} /* tpCRC32() */
+
+static void tpPutLE(uint8_t *d, uint32_t u32, int iBytes)
+{
+  while (iBytes--) {
+    *d++ = (uint8_t)u32;
+    u32 >>= 8;
+  }
+} /* tpPutLE() */
+
+static uint32_t tpGetLE(const uint8_t *s, int iBytes)
+{
+uint32_t u32 = 0;
+
+  while (iBytes--)
+    u32 = (u32 << 8) | s[iBytes];
+  return u32;
+} /* tpGetLE() */
+//
+// Write one framed command packet (if d isn't NULL); returns its length
+// The payload is copied as is
+//
+static int tpBlobPacket(uint8_t *d, uint8_t ucCommand, const uint8_t *pPayload, int iLen)
+{
+  if (d) {
+    d[0] = 0x51; d[1] = 0x78; d[2] = ucCommand; d[3] = 0x00;
+    d[4] = (uint8_t)iLen; d[5] = 0x00;
+    memcpy(&d[6], pPayload, iLen);
+    d[6 + iLen] = CheckSum((uint8_t *)pPayload, iLen);
+    d[7 + iLen] = 0xff;
+  }
+  return iLen + 8;
+} /* tpBlobPacket() */
+//
+// Add the packets for iBlank white rows (a paper feed, or blank lines if
+// there are too few to bother)
+//
+static int tpBlobBlankRows(uint8_t *d, int iBlank, int iLinePitch)
+{
+uint8_t ucPayload[TP_MAX_DITHER_WIDTH / 8];
+int iFeed, iLen = 0;
+
+  memset(ucPayload, 0, sizeof(ucPayload));
+  if (iBlank < TP_MIN_FEED_ROWS) {
+    while (iBlank--)
+      iLen += tpBlobPacket(d ? &d[iLen] : NULL, 0xa2, ucPayload, iLinePitch);
+    return iLen;
+  }
+  while (iBlank) {
+    iFeed = (iBlank > 255) ? 255 : iBlank;
+    ucPayload[0] = (uint8_t)iFeed; // 16-bit little endian count
+    iLen += tpBlobPacket(d ? &d[iLen] : NULL, paperFeed, ucPayload, 2);
+    iBlank -= iFeed;
+  }
+  return iLen;
+} /* tpBlobBlankRows() */
+//
+// Copy a row of an image into a printer line (cropped, padded with white)
+// returns true if it has any black pixels
+//
+static int tpBlobLine(const uint8_t *s, int iWidth, uint8_t *pLine, int iLinePitch)
+{
+int i, iBytes = (iWidth + 7) / 8;
+uint8_t ucAny = 0;
+
+  memset(pLine, 0, iLinePitch);
+  if (iBytes > iLinePitch) { // crop
+    iBytes = iLinePitch;
+    iWidth = iBytes * 8;
+  }
+  memcpy(pLine, s, iBytes);
+  if (iWidth & 7)
+    pLine[iBytes-1] &= (uint8_t)(0xff << (8 - (iWidth & 7)));
+  for (i=0; i<iBytes; i++)
+    ucAny |= pLine[i];
+  return (ucAny != 0);
+} /* tpBlobLine() */
+//
+// Compile an image into a print-ready blob
+//
+int tpEncodeImage(int iPrinterType, const uint8_t *pBits, int iWidth, int iPitch, int iHeight, uint8_t *pBlob, int iBlobSize)
+{
+uint8_t ucLine[TP_MAX_DITHER_WIDTH / 8];
+int i, y, iLinePitch, iPrinterWidth, iLen, iBlank, iNeed;
+
+  if (iPrinterType < 0 || iPrinterType >= (int)(sizeof(usPrinterWidths) / sizeof(usPrinterWidths[0])))
+    return -1;
+  if (pBits == NULL || iWidth < 1 || iHeight < 1 || iHeight > 65535 || iPitch < (iWidth + 7) / 8)
+    return -1;
+  iPrinterWidth = pgm_read_word(&usPrinterWidths[iPrinterType]);
+  iLinePitch = (iPrinterWidth + 7) / 8;
+  iLen = TP_BLOB_HEADER_SIZE;
+  iBlank = 0;
+  for (y=0; y<iHeight; y++) {
+    if (!tpBlobLine(&pBits[y * iPitch], iWidth, ucLine, iLinePitch)) {
+      iBlank++;
+      continue;
+    }
+    // the white rows in front of this one, then the row
+    iNeed = tpBlobBlankRows(NULL, iBlank, iLinePitch) + iLinePitch + 8;
+    if (pBlob) {
+      if (iLen + iNeed > iBlobSize)
+        return -1;
+      iLen += tpBlobBlankRows(&pBlob[iLen], iBlank, iLinePitch);
+      for (i=0; i<iLinePitch; i++) // the printer wants the bits in the other order
+        ucLine[i] = pgm_read_byte(&ucMirror[ucLine[i]]);
+      iLen += tpBlobPacket(&pBlob[iLen], 0xa2, ucLine, iLinePitch);
+    } else {
+      iLen += iNeed;
+    }
+    iBlank = 0;
+  }
+  // white rows at the bottom are just counted (the header) and fed when
+  // the blob is printed
+  if (pBlob) {
+    if (iBlobSize < TP_BLOB_HEADER_SIZE)
+      return -1;
+    memcpy(pBlob, "TPIB", 4);
+    pBlob[4] = TP_BLOB_VERSION;
+    pBlob[5] = (uint8_t)iPrinterType;
+    tpPutLE(&pBlob[6], iPrinterWidth, 2);
+    tpPutLE(&pBlob[8], iHeight, 2);
+    tpPutLE(&pBlob[10], iBlank, 2);
+    tpPutLE(&pBlob[12], iLen - TP_BLOB_HEADER_SIZE, 4);
+    tpPutLE(&pBlob[16], tpCRC32(0, &pBlob[TP_BLOB_HEADER_SIZE], iLen - TP_BLOB_HEADER_SIZE), 4);
+  }
+  return iLen;
+} /* tpEncodeImage() */
+//
+// Check a blob header against the connected printer
+// returns the length of the packets or -1
+//
+static int32_t tpCheckBlobHeader(const uint8_t *pHeader)
+{
+int32_t iLen;
+
+  if (memcmp(pHeader, "TPIB", 4) != 0 || pHeader[4] != TP_BLOB_VERSION)
+    return -1;
+  if (pHeader[5] != PRINTER_X18_9556 || (int)tpGetLE(&pHeader[6], 2) != tpGetWidth())
+    return -1; // made for another printer
+  iLen = (int32_t)tpGetLE(&pHeader[12], 4);
+  return (iLen < 0) ? -1 : iLen;
+} /* tpCheckBlobHeader() */
+//
+// Get the printer ready for the blob's packets
+//
+static void tpBlobStart(void)
+{
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  tpStartStream();
+  tpSendBlankRows();
+  bRowsStarted = 1;
+} /* tpBlobStart() */
+//
+// Print a blob which is in memory
+//
+int tpPrintImageBlob(const uint8_t *pBlob, int iSize)
+{
+int32_t iLen;
+
+  if (!bConnected || pBlob == NULL || iSize < TP_BLOB_HEADER_SIZE)
+    return -1;
+  iLen = tpCheckBlobHeader(pBlob);
+  if (iLen < 0 || iLen > iSize - TP_BLOB_HEADER_SIZE)
+    return -1;
+  if (tpCRC32(0, &pBlob[TP_BLOB_HEADER_SIZE], (int)iLen) != tpGetLE(&pBlob[16], 4))
+    return -1;
+  tpBlobStart();
+  tpWriteData((uint8_t *)&pBlob[TP_BLOB_HEADER_SIZE], (int)iLen);
+  iBlankRows = tpGetLE(&pBlob[10], 2);
+  tpFinishImage();
+  return 0;
+} /* tpPrintImageBlob() */
+//
+// Print a blob from a file
+//
+int tpPrintImageBlobFile(TP_READ_CALLBACK *pfnRead, void *pUser)
+{
+uint8_t ucBuf[MTU_SIZE];
+int32_t iLen, iPos;
+uint32_t u32CRC = 0, u32Expected;
+int n, iTrailing;
+
+  if (!bConnected || pfnRead == NULL)
+    return -1;
+  if ((*pfnRead)(pUser, 0, ucBuf, TP_BLOB_HEADER_SIZE) != TP_BLOB_HEADER_SIZE)
+    return -1;
+  iLen = tpCheckBlobHeader(ucBuf);
+  if (iLen < 0)
+    return -1;
+  iTrailing = tpGetLE(&ucBuf[10], 2);
+  u32Expected = tpGetLE(&ucBuf[16], 4);
+  for (iPos=0; iPos<iLen; iPos += n) { // check all of it before sending any
+    n = (iLen - iPos > MTU_SIZE) ? MTU_SIZE : (int)(iLen - iPos);
+    if ((*pfnRead)(pUser, TP_BLOB_HEADER_SIZE + iPos, ucBuf, n) != n)
+      return -1;
+    u32CRC = tpCRC32(u32CRC, ucBuf, n);
+  }
+  if (u32CRC != u32Expected)
+    return -1;
+  tpBlobStart();
+  for (iPos=0; iPos<iLen; iPos += n) {
+    n = (iLen - iPos > MTU_SIZE) ? MTU_SIZE : (int)(iLen - iPos);
+    if ((*pfnRead)(pUser, TP_BLOB_HEADER_SIZE + iPos, ucBuf, n) != n) {
+      tpFinishImage(); // the file went away; end what was sent
+      return -1;
+    }
+    tpWriteData(ucBuf, n);
+  }
+  iBlankRows = iTrailing;
+  tpFinishImage();
+  return 0;
+} /* tpPrintImageBlobFile() */
+//
+// Receipt templates
+// The static layer is kept as one ready to send scanline packet per row,
+// so rows without fields cost nothing but the BLE write. Rows covered by
+// a field box are rendered through the strip like other streamed output.
+//
+typedef struct tag_tpband {
+  TPTEMPLATE *pTemplate;
+  int y; // template row at the top of the band
+} TPBAND;
+//
+// Turn the static layer into a template
+//
+int tpTemplateInit(TPTEMPLATE *pTemplate, int iPrinterType, const uint8_t *pStatic, int iWidth, int iPitch, int iHeight, uint8_t *pMem, int iMemSize)
+{
+uint8_t ucLine[TP_MAX_DITHER_WIDTH / 8];
+int i, y, iLinePitch;
+
+  if (pTemplate == NULL || pMem == NULL || iPrinterType < 0 || iPrinterType >= (int)(sizeof(usPrinterWidths) / sizeof(usPrinterWidths[0])))
+    return -1;
+  if (pStatic == NULL || iWidth < 1 || iHeight < 1 || iPitch < (iWidth + 7) / 8)
+    return -1;
+  iLinePitch = (pgm_read_word(&usPrinterWidths[iPrinterType]) + 7) / 8;
+  if (iMemSize < iHeight * (iLinePitch + 8))
+    return -1;
+  memset(pTemplate, 0, sizeof(TPTEMPLATE));
+  for (y=0; y<iHeight; y++) {
+    tpBlobLine(&pStatic[y * iPitch], iWidth, ucLine, iLinePitch);
+    for (i=0; i<iLinePitch; i++) // the printer wants the bits in the other order
+      ucLine[i] = pgm_read_byte(&ucMirror[ucLine[i]]);
+    tpBlobPacket(&pMem[y * (iLinePitch + 8)], 0xa2, ucLine, iLinePitch);
+  }
+  pTemplate->pRows = pMem;
+  pTemplate->iHeight = iHeight;
+  pTemplate->iPitch = iLinePitch;
+  return 0;
+} /* tpTemplateInit() */
+//
+// Add a field to a template
+//
+int tpTemplateAddField(TPTEMPLATE *pTemplate, const char *szName, int x, int y, int iWidth, int iHeight, GFXfont *pFont, int iFontSize, int iScale, int iAlign, int iDecimals)
+{
+TPFIELD *pField;
+
+  if (pTemplate == NULL || szName == NULL || pTemplate->iFieldCount >= TP_MAX_FIELDS)
+    return -1;
+  if (iWidth < 1 || iHeight < 1 || x < 0 || y < 0 || y + iHeight > pTemplate->iHeight)
+    return -1;
+  if (iAlign != ALIGN_LEFT && iAlign != ALIGN_CENTER && iAlign != ALIGN_RIGHT && iAlign != ALIGN_DECIMAL)
+    return -1;
+  pField = &pTemplate->fields[pTemplate->iFieldCount];
+  pField->szName = szName;
+  pField->szValue = NULL;
+  pField->pFont = pFont;
+  pField->x = (int16_t)x; pField->y = (int16_t)y;
+  pField->iWidth = (int16_t)iWidth; pField->iHeight = (int16_t)iHeight;
+  pField->ucFontSize = (iFontSize > FONT_SMALL && iFontSize <= FONT_SMOOTH3X) ? iFontSize : FONT_SMALL;
+  pField->ucScale = (iScale < 1) ? 1 : (iScale > 4) ? 4 : iScale;
+  pField->ucAlign = (uint8_t)iAlign;
+  pField->ucDecimals = (uint8_t)iDecimals;
+  return pTemplate->iFieldCount++;
+} /* tpTemplateAddField() */
+//
+// Set the text of a field
+//
+int tpTemplateSetField(TPTEMPLATE *pTemplate, const char *szName, const char *szValue)
+{
+int i;
+
+  if (pTemplate == NULL || szName == NULL)
+    return -1;
+  for (i=0; i<pTemplate->iFieldCount; i++) {
+    if (strcmp(pTemplate->fields[i].szName, szName) == 0) {
+      pTemplate->fields[i].szValue = szValue;
+      return 0;
+    }
+  }
+  return -1;
+} /* tpTemplateSetField() */
+//
+// Returns true if a field with text covers template row y
+//
+static int tpFieldRow(TPTEMPLATE *pTemplate, int y)
+{
+int i;
+TPFIELD *pField;
+
+  for (i=0; i<pTemplate->iFieldCount; i++) {
+    pField = &pTemplate->fields[i];
+    if (pField->szValue != NULL && pField->szValue[0] != 0 && y >= pField->y && y < pField->y + pField->iHeight)
+      return 1;
+  }
+  return 0;
+} /* tpFieldRow() */
+//
+// Set the bits x1 to x2 (exclusive) of a row
+//
+static void tpSetSpan(uint8_t *pRow, int x1, int x2)
+{
+  for (; x1 < x2 && (x1 & 7); x1++)
+    pRow[x1 >> 3] |= (0x80 >> (x1 & 7));
+  for (; x1 + 8 <= x2; x1 += 8)
+    pRow[x1 >> 3] = 0xff;
+  for (; x1 < x2; x1++)
+    pRow[x1 >> 3] |= (0x80 >> (x1 & 7));
+} /* tpSetSpan() */
+//
+// Draw a band of template rows covered by fields into the strip:
+// the field text, clipped to the boxes, ORed with the static layer
+//
+static void tpDrawTemplateBand(void *pUser)
+{
+TPBAND *pBand = (TPBAND *)pUser;
+TPTEMPLATE *pTemplate = pBand->pTemplate;
+TPFIELD *pField;
+TPCOLUMN col;
+uint8_t ucMask[TP_MAX_DITHER_WIDTH / 8], ucAny, *d;
+const uint8_t *s;
+int i, x, y, iTop, iRows, iLen, iWidth = pTemplate->iPitch * 8;
+
+  iRows = iDLPageHeight - bb_top;
+  if (iRows > bb_height) iRows = bb_height;
+  for (i=0; i<pTemplate->iFieldCount; i++) {
+    pField = &pTemplate->fields[i];
+    iTop = pField->y - pBand->y; // in band rows
+    if (pField->szValue == NULL || pField->szValue[0] == 0 || iTop >= bb_top + iRows || iTop + pField->iHeight <= bb_top)
+      continue;
+    pTextFont = pField->pFont;
+    ucTextFont = pField->ucFontSize;
+    ucTextScale = pField->ucScale;
+    tpBuildAdvances();
+    iLen = (int)strlen(pField->szValue);
+    col.iWidth = pField->iWidth;
+    col.ucAlign = pField->ucAlign;
+    col.ucDecimals = pField->ucDecimals;
+    x = tpCellX(&col, pField->szValue, iLen, tpRunWidth(pField->szValue, iLen));
+    if (x < 0) x = 0; // too wide for the box
+    tpDrawRun(pField->szValue, iLen, pField->x + x, iTop + (pField->iHeight - tpLineHeight()) / 2);
+  }
+  tpSetAllDirty(0);
+  for (y=0; y<iRows; y++) {
+    memset(ucMask, 0, pTemplate->iPitch); // the boxes on this row
+    for (i=0; i<pTemplate->iFieldCount; i++) {
+      pField = &pTemplate->fields[i];
+      iTop = pField->y - pBand->y;
+      if (bb_top + y >= iTop && bb_top + y < iTop + pField->iHeight && pField->x < iWidth)
+        tpSetSpan(ucMask, pField->x, (pField->x + pField->iWidth > iWidth) ? iWidth : pField->x + pField->iWidth);
+    }
+    d = &pBackBuffer[y * bb_pitch];
+    s = &pTemplate->pRows[(pBand->y + bb_top + y) * (pTemplate->iPitch + 8) + 6];
+    for (ucAny=0, x=0; x<pTemplate->iPitch; x++) {
+      d[x] = (d[x] & ucMask[x]) | pgm_read_byte(&ucMirror[s[x]]);
+      ucAny |= d[x];
+    }
+    if (ucAny)
+      tpMarkDirty(y, y);
+  }
+} /* tpDrawTemplateBand() */
+//
+// Returns true if a stored scanline packet is all white
+//
+static int tpBlankPacket(const uint8_t *pPacket, int iPitch)
+{
+int i;
+
+  for (i=0; i<iPitch; i++) {
+    if (pPacket[6 + i])
+      return 0;
+  }
+  return 1;
+} /* tpBlankPacket() */
+//
+// Print a template
+//
+int tpPrintTemplate(TPTEMPLATE *pTemplate)
+{
+TPBAND band;
+GFXfont *pSaveFont = pTextFont;
+uint8_t ucSaveFont = ucTextFont, ucSaveScale = ucTextScale;
+int y, y2, iStride;
+
+  if (!bConnected || pTemplate == NULL || pTemplate->pRows == NULL)
+    return -1;
+  if (pTemplate->iPitch != (tpGetWidth() + 7) / 8)
+    return -1; // made for another printer
+  if (iLineLen) // finish the tpPrint() line first
+    tpFlushLine(0);
+  tpStartStream();
+  iStride = pTemplate->iPitch + 8;
+  band.pTemplate = pTemplate;
+  y = 0;
+  while (y < pTemplate->iHeight) {
+    for (y2 = y; y2 < pTemplate->iHeight && tpFieldRow(pTemplate, y2); y2++) {};
+    if (y2 > y) { // render the rows with fields
+      band.y = y;
+      tpStreamRows(y2 - y, tpDrawTemplateBand, &band);
+      y = y2;
+      continue;
+    }
+    if (tpBlankPacket(&pTemplate->pRows[y * iStride], pTemplate->iPitch)) {
+      iBlankRows++;
+      y++;
+      continue;
+    }
+    // send the stored lines up to the next blank or field row in one go
+    for (y2 = y + 1; y2 < pTemplate->iHeight && !tpFieldRow(pTemplate, y2) &&
+         !tpBlankPacket(&pTemplate->pRows[y2 * iStride], pTemplate->iPitch); y2++) {};
+    tpSendPendingRows(pTemplate->iPitch);
+    tpWriteData(&pTemplate->pRows[y * iStride], (y2 - y) * iStride);
+    bRowsStarted = 1;
+    y = y2;
+  }
+  // restore the text mode font
+  pTextFont = pSaveFont;
+  ucTextFont = ucSaveFont;
+  ucTextScale = ucSaveScale;
+  tpBuildAdvances();
+  tpFinishImage();
+  return 0;
+} /* tpPrintTemplate() */
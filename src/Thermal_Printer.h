@@ -20,15 +20,43 @@
 #ifndef __THERMAL_PRINTER_H__
 #define __THERMAL_PRINTER_H__
 
-#define FONT_SMALL 0
-#define FONT_LARGE 1
+// Built-in font sizes
+// FONT_SMOOTH2X/3X are the 8x8 font enlarged to 16x16/24x24 with edge
+// smoothing (Scale2x/Scale3x). Define TP_NO_BIG_FONT for the whole build to
+// leave out the 14K 16x32 table; FONT_LARGE is then smoothed as well.
+#define FONT_SMALL 0    // 8x8
+#define FONT_LARGE 1    // 16x32
+#define FONT_SMOOTH2X 2 // 16x16
+#define FONT_SMOOTH3X 3 // 24x24
 #define FONT_12x24 0
 #define FONT_9x17  1
 
 enum {
   ALIGN_LEFT=0x30,
   ALIGN_CENTER=0x31,
-  ALIGN_RIGHT=0x32
+  ALIGN_RIGHT=0x32,
+  ALIGN_JUSTIFY=0x33,
+  ALIGN_DECIMAL=0x34 // table columns and template fields only
+};
+
+enum {
+  CODEPAGE_437=437, // IBM PC (default)
+  CODEPAGE_852=852  // Latin-2 (Central European)
+};
+
+enum {
+  FONT_FORMAT_GFX=0, // plain Adafruit_GFX glyph bits
+  FONT_FORMAT_RLE,   // compressed with tools/fontcomp
+  FONT_FORMAT_ROWS,  // byte aligned rows (tools/fontcomp -rows)
+  FONT_FORMAT_ROWS_SHIFTED // aligned rows pre-shifted for each bit offset (-shifted)
+};
+
+enum {
+  STYLE_NORMAL=0,
+  STYLE_BOLD=1,
+  STYLE_UNDERLINE=2,
+  STYLE_STRIKE=4,  // strikethrough
+  STYLE_INVERSE=8  // white text on a black line box
 };
 
 enum {
@@ -59,6 +87,185 @@ enum {
 enum {
   PRINTER_X18_9556 = 0
 };
+//
+// Print-ready image blobs (see tpEncodeImage())
+// A 20 byte header (all values little endian):
+//   0  "TPIB"
+//   4  version, printer type (PRINTER_xxx)
+//   6  printer width in dots, image height in rows (16 bits each)
+//   10 white rows below the last printed row (16 bits)
+//   12 length of the packets which follow, CRC-32 of the packets (32 bits each)
+// then the printer's own framed command packets, ready to send
+//
+#define TP_BLOB_HEADER_SIZE 20
+#define TP_BLOB_VERSION 1
+// largest blob for an image h rows tall (every row sent as pixels)
+#define TP_BLOB_MAX_SIZE(h) (TP_BLOB_HEADER_SIZE + (h) * (8 + TP_MAX_DITHER_WIDTH / 8))
+
+//
+// What to do with table cells which don't fit their column
+//
+enum {
+  OVERFLOW_TRUNCATE = 0,
+  OVERFLOW_WRAP,
+  OVERFLOW_ELLIPSIS
+};
+//
+// A table column
+// ucDecimals = digits after the decimal point (for ALIGN_DECIMAL)
+//
+typedef struct tag_tpcolumn {
+  int16_t iWidth; // in pixels
+  uint8_t ucAlign; // ALIGN_LEFT/CENTER/RIGHT/DECIMAL
+  uint8_t ucOverflow; // OVERFLOW_TRUNCATE/WRAP/ELLIPSIS
+  uint8_t ucDecimals;
+} TPCOLUMN;
+
+enum {
+  FILL_EVEN_ODD = 0,
+  FILL_NON_ZERO
+};
+//
+// A point of a polygon or path (in pixels)
+//
+typedef struct tag_tppoint {
+  int16_t x, y;
+} TPPOINT;
+//
+// A path is a list of contours made of lines and curves
+// Curves are flattened into short lines as they're added
+// The points are stored in memory you provide to tpPathInit()
+//
+typedef struct tag_tppath {
+  TPPOINT *pPoints;
+  int iCount, iMax;
+  int iContour; // index of the first point of the current contour
+} TPPATH;
+
+enum {
+  DITHER_FLOYD_STEINBERG=0,
+  DITHER_ATKINSON, // lighter, more contrast (3/4 of the error is spread)
+  DITHER_BAYER     // ordered 8x8 matrix (no error state)
+};
+#define TP_MAX_DITHER_WIDTH 576
+// int16_t entries of error memory needed for rows of w pixels
+#define TP_DITHER_ERRORS(w) (2 * ((w) + 4))
+// bytes needed by tpDitherSetFilter() for rows of w pixels
+#define TP_DITHER_WINDOW(w) (4 * (w))
+//
+// State of a grayscale image being dithered one row at a time
+// Error diffusion keeps 2 rows of errors (4 fractional bits) in memory
+// you provide and scans the rows in alternating directions (serpentine)
+//
+typedef struct tag_tpdither {
+  int16_t *pErrors;
+  int iWidth;
+  int iRow; // rows done
+  uint8_t ucMode; // DITHER_xxx
+  uint8_t ucSharpen; // unsharp mask amount in quarters (0 = off)
+  const uint8_t *pTone; // 256 entry tone curve or NULL
+  uint8_t *pWindow; // 3 input rows + the filtered row
+  int iRowsIn; // rows received (the output lags when sharpening)
+} TPDITHER;
+//
+// Reads iLen bytes at iOffset of a file or stream into pBuf
+// returns the number of bytes read
+//
+typedef int (TP_READ_CALLBACK)(void *pUser, int32_t iOffset, uint8_t *pBuf, int iLen);
+//
+// A BMP file being read one row at a time
+//
+typedef struct tag_tpbmp {
+  TP_READ_CALLBACK *pfnRead;
+  void *pUser;
+  int32_t iDataOffset; // start of the pixel rows in the file
+  int iWidth, iHeight, iPitch;
+  int iRow; // next row to read (0 = top)
+  uint8_t ucBpp; // 1, 4, 8 or 24
+  uint8_t bTopDown; // rows are stored top first (negative height)
+  uint8_t ucPalette[256]; // gray level of each color table entry
+} TPBMP;
+//
+// A Netpbm file (P1/P4 bitmap, P2/P5 graymap) being read one row at a time
+//
+typedef struct tag_tppnm {
+  TP_READ_CALLBACK *pfnRead;
+  void *pUser;
+  int32_t iDataOffset; // start of the pixels
+  int32_t iPos; // file offset of the next read
+  int iWidth, iHeight, iMaxVal;
+  int iRow; // next row to read (0 = top)
+  int iInPos, iInLen;
+  uint8_t ucType; // 1, 2, 4 or 5 (P1, P2, P4, P5)
+  uint8_t ucIn[64]; // read buffer for the text formats
+} TPPNM;
+//
+// Canonical Huffman code used by the PNG inflater
+// Codes up to TP_HUFF_FAST_BITS long are decoded with one table lookup
+//
+#define TP_HUFF_FAST_BITS 9
+typedef struct tag_tphuff {
+  uint16_t usCount[16]; // number of codes of each length
+  uint16_t usSymbol[288]; // symbols in code order
+  uint16_t usFast[1 << TP_HUFF_FAST_BITS]; // (symbol << 4) | length, 0 = longer code
+} TPHUFF;
+// uint8_t bytes of row memory needed by a PNG w pixels wide (any format)
+#define TP_PNG_ROW_MEM(w) (2 * ((w) * 8 + 1))
+//
+// A PNG file being read one row at a time
+// The 32K inflate window is part of the structure (about 37K in all),
+// so declare it static or allocate it; the 2 rows needed by the PNG
+// filters are in memory passed to tpPNGOpen()
+//
+typedef struct tag_tppng {
+  TP_READ_CALLBACK *pfnRead;
+  void *pUser;
+  int iWidth, iHeight;
+  int iRow; // next row to read (0 = top)
+  int iPitch; // bytes per row (without the filter byte)
+  uint8_t ucDepth, ucColorType, ucChannels, ucPixelBytes;
+  uint8_t *pCur, *pPrev; // the row being decoded and the one above it
+  // compressed data (IDAT chunks)
+  int32_t iPos; // file offset of the next read
+  int32_t iChunkLeft; // IDAT bytes not read yet
+  int iInPos, iInLen;
+  uint8_t bEOF;
+  uint8_t ucIn[256];
+  // inflate state
+  uint32_t u32Bits;
+  int iBitCount;
+  uint8_t bInBlock, bLastBlock, ucBlockType;
+  int iStoredLeft, iCopyLeft, iCopyDist;
+  uint16_t usWinPos;
+  TPHUFF litHuff, distHuff;
+  uint8_t ucPalette[256]; // gray level of each palette entry (over white)
+  uint8_t ucWindow[32768];
+} TPPNG;
+//
+// Source pixel formats for the image scaler
+//
+enum {
+  SCALE_GRAY8=0, // 1 byte per pixel, 0 = black
+  SCALE_1BPP       // packed MSB first, 1 = black (same as the back buffer)
+};
+#define TP_MAX_SCALE_SIZE 16383
+// uint32_t words of memory needed by the scaler for output rows of w pixels
+#define TP_SCALE_MEM(w) ((w) + ((w) + 1) / 2)
+//
+// State of an image being resized one row at a time
+// Each output pixel is the average of the source area it covers, worked
+// out in integers: the sizes are reduced by their GCD so every source
+// pixel is usXDest units wide and every output pixel usXSrc units
+//
+typedef struct tag_tpscaler {
+  uint32_t *pAccum; // weighted sums of the output row being built
+  uint16_t *pRow; // last source row resized horizontally (4 fraction bits)
+  int iSrcWidth, iSrcHeight, iDestWidth, iDestHeight;
+  int iSrcY, iDestY; // rows pushed / pulled
+  uint16_t usXSrc, usXDest, usYSrc, usYDest;
+  uint8_t ucFormat; // SCALE_xxx
+  uint8_t bPending; // the last source row hasn't been used up yet
+} TPSCALER;
 
 // Proportional font data taken from Adafruit_GFX library
 /// Font data stored PER GLYPH
@@ -83,6 +290,30 @@ typedef struct {
 } GFXfont;
 #endif // _ADAFRUIT_GFX_H
 //
+// Receipt templates (see tpTemplateInit())
+// A field is a box on the template filled with one line of text at print
+// time, in its own font and alignment
+//
+#define TP_MAX_FIELDS 16
+typedef struct tag_tpfield {
+  const char *szName;
+  const char *szValue; // set by tpTemplateSetField(); NULL = empty
+  GFXfont *pFont; // NULL = the built-in font ucFontSize
+  int16_t x, y, iWidth, iHeight; // the box in pixels
+  uint8_t ucFontSize, ucScale;
+  uint8_t ucAlign; // ALIGN_LEFT/CENTER/RIGHT/DECIMAL
+  uint8_t ucDecimals; // digits after the decimal point (for ALIGN_DECIMAL)
+} TPFIELD;
+
+typedef struct tag_tptemplate {
+  uint8_t *pRows; // the static layer as ready to send scanline packets
+  int iHeight, iPitch; // rows and bytes per printer line
+  int iFieldCount;
+  TPFIELD fields[TP_MAX_FIELDS];
+} TPTEMPLATE;
+// memory for the static layer of a template h rows tall
+#define TP_TEMPLATE_MEM(h) ((h) * (8 + TP_MAX_DITHER_WIDTH / 8))
+//
 // Return the printer width in pixels
 // The printer needs to be connected to get this info
 //
@@ -95,6 +326,9 @@ int tpGetWidth(void);
 char *tpGetName(void);
 
 // Feed the paper in scanline increments
+// This also finishes streamed text (tpPrint(), tpPrintParagraph(),
+// tpPrintRow()...): the unfinished line is printed and the print
+// session is ended
 //
 void tpFeed(int iLines);
 //
@@ -114,6 +348,132 @@ int tpDrawCustomText(GFXfont *pFont, int x, int y, char *szMsg);
 // Print a string of characters in a custom font to the connected printer
 //
 int tpPrintCustomText(GFXfont *pFont, int x, char *szMsg);
+//
+// Keep the images of custom font strings in a cache so headers and labels
+// which repeat on every job are copied instead of drawn glyph by glyph
+// (tpDrawCustomText/tpPrintCustomText). Entries are keyed by font, string
+// and character set; the least recently used ones are dropped when the
+// memory is full. Pass NULL to turn it off.
+//
+void tpSetTextCache(uint8_t *pCache, int iSize);
+//
+// Return the cache hits, misses and bytes in use (pointers can be NULL)
+//
+void tpGetTextCacheStats(int *pHits, int *pMisses, int *pBytesUsed);
+
+//
+// Character sets
+// Select the code page of the built-in 8x8 font (CODEPAGE_437/852)
+// returns 0 for success, -1 if it's not supported
+//
+int tpSetCodePage(int iCodePage);
+//
+// Treat all text as UTF-8 (1) or as 8-bit character codes (0, default)
+// UTF-8 characters are converted to the current code page (or the map
+// given to tpSetCharMap); characters which aren't there print as '?'
+//
+void tpSetUTF8(int bEnable);
+//
+// Use your own character map; pMap[i] = the Unicode value of character
+// code 0x80+i (128 entries). The array must stay valid while in use.
+//
+void tpSetCharMap(const uint16_t *pMap);
+//
+// Give a sparse GFX font a table of 256 glyph indices (0xff = missing)
+// so it doesn't need glyphs for every character from first to last
+// returns 0 for success, -1 if there's no room (max 4 fonts)
+//
+int tpSetGlyphMap(GFXfont *pFont, const uint8_t *pMap);
+//
+// Set the glyph bitmap format of a GFX font (FONT_FORMAT_xxx)
+// Fonts converted with tools/fontcomp need their format set before use
+// returns 0 for success, -1 for an invalid format or no room (max 4 fonts)
+//
+int tpSetFontFormat(GFXfont *pFont, int iFormat);
+//
+// Set the text style (STYLE_xxx flags ORed together) made from the
+// glyphs of any font: bold, underline, strikethrough and inverse
+// It applies to all text drawn or printed after the call; a line being
+// collected by tpPrint() is finished first (like tpSetFont)
+//
+void tpSetTextStyle(int iStyle);
+
+//
+// Text mode
+// tpPrint() collects characters into lines, aligns them and streams each
+// finished line to the printer through a small internal buffer
+// (no back buffer is needed). A line ends with \n or when it's full
+// (it breaks at a space if possible).
+//
+// Select the font for tpPrint() and the paragraph functions: a GFXfont,
+// or NULL for the built-in font iFontSize (FONT_SMALL/LARGE/SMOOTH2X/SMOOTH3X)
+// enlarged by iScale (1-4)
+//
+void tpSetFont(GFXfont *pFont, int iFontSize, int iScale);
+//
+// Set the alignment of printed lines (ALIGN_LEFT/CENTER/RIGHT/JUSTIFY)
+// Justified lines are stretched except the last line of a paragraph
+//
+void tpAlign(int iAlign);
+//
+// Print text / formatted text; returns -1 if not connected
+// An unfinished last line is printed by tpFeed(), tpPrintBuffer() or tpDisconnect()
+//
+int tpPrint(const char *szMsg);
+int tpPrintf(const char *szFormat, ...);
+//
+// Word wrapped paragraphs
+// Text is broken into lines at spaces (\n starts a new paragraph).
+// bBalanced = 0 fills each line as much as possible, 1 chooses the breaks
+// which make the lines most even in length (less ragged)
+//
+// Return the number of lines the text needs at the given width
+//
+int tpMeasureParagraph(const char *szText, int iWidth, int bBalanced);
+//
+// Draw a paragraph into the back buffer in a column iWidth pixels wide
+// iAlign = ALIGN_LEFT/CENTER/RIGHT/JUSTIFY
+// returns the y coordinate below the last line
+//
+int tpDrawParagraph(int x, int y, int iWidth, char *szText, int iAlign, int bBalanced);
+//
+// Print a paragraph at the full printer width with the tpAlign() alignment
+// returns the number of lines printed or -1 if not connected
+//
+int tpPrintParagraph(char *szText, int bBalanced);
+//
+// Tables (in the text mode font)
+// Set the columns; the array must stay valid while the table is in use
+// iGap = space between the columns in pixels
+// returns 0 for success, -1 for invalid parameters (max 8 columns)
+//
+int tpSetTable(TPCOLUMN *pColumns, int iCount, int iGap);
+//
+// Draw a row into the back buffer with its top at y
+// pCells = the text of each column (NULL for an empty cell)
+// Wrapped cells make the row taller (up to 8 lines)
+// returns the y coordinate below the row
+//
+int tpDrawRow(int y, char **pCells);
+//
+// Print a row; it's laid out, rendered and sent right away so tables
+// of any length can be printed without a back buffer
+//
+int tpPrintRow(char **pCells);
+//
+// Rotated text (in the text mode font and style)
+// iAngle = 90 reads down the page, 270 reads up the page
+// Rotated glyphs are kept in the text cache if one is set (tpSetTextCache)
+//
+// Draw rotated text into the back buffer; x,y is the top left corner of
+// the line box (line height wide, text length tall)
+//
+int tpDrawRotatedText(int x, int y, char *szMsg, int iAngle);
+//
+// Print text of any length along the paper, centered across it
+// It streams a few rows at a time, so long banners need no back buffer
+//
+int tpPrintBanner(char *szMsg, int iAngle);
 
 //
 // Send raw data to printer
@@ -128,6 +488,26 @@ void tpWriteRawData(uint8_t *pData, int iLen);
 // So a 384x384 buffer would need to be 48x384 = 18432 bytes
 //
 void tpSetBackBuffer(uint8_t *pBuffer, int iWidth, int iHeight);
+//
+// Record the drawing functions into a display list instead of the back buffer
+// The back buffer then only needs to hold a band of rows (e.g. 384x16)
+// and tpPrintBuffer() rasterizes the page one band at a time, sending
+// each band as soon as it's ready. This allows pages much taller than
+// the available RAM. tpFill() starts a new page.
+// pList/iListSize = memory for the recorded commands (~20 bytes each + strings)
+// iPageHeight = total page height in pixels
+// returns 0 for success, -1 for invalid parameters
+// While recording, the drawing functions return -1 if the list is full
+//
+int tpBeginDisplayList(uint8_t *pList, int iListSize, int iPageHeight);
+//
+// Stop recording and go back to drawing directly into the back buffer
+//
+void tpEndDisplayList(void);
+//
+// Return the number of bytes of the display list in use
+//
+int tpGetDisplayListSize(void);
 
 //
 #define MODE_WITH_RESPONSE 1
@@ -145,10 +525,121 @@ void tpSetWriteMode(uint8_t bWriteMode);
 // along with a x and y offset (upper left corner)
 //
 int tpLoadBMP(uint8_t *pBMP, int bInvert, int iXOffset, int iYOffset);
+//
+// Read a BMP file of any size from storage a row at a time
+// Uncompressed 1, 4, 8 (palette) and 24-bit images are converted to 8-bit
+// gray as they're read, top row first whichever way the file stores them.
+// The callback reads from wherever the file is, e.g.
+//   int ReadFile(void *pUser, int32_t iOffset, uint8_t *pBuf, int iLen)
+//   { File *f = (File *)pUser; f->seek(iOffset); return f->read(pBuf, iLen); }
+// (or fseek()/fread() on a FILE * on a PC)
+// returns 0 for success, -1 for an unsupported or invalid file
+//
+int tpBMPOpen(TPBMP *pBMP, TP_READ_CALLBACK *pfnRead, void *pUser);
+//
+// Read the first iCount pixels of the next row as gray (0 = black)
+// returns -1 at the end of the image or if the file can't be read
+//
+int tpBMPReadRow(TPBMP *pBMP, uint8_t *pGray, int iCount);
+//
+// Dither the BMP into the back buffer at x,y (clipped to its edges) or
+// print it (left aligned); the width of pDither (up to the printer width)
+// sets how much of each row is used. Like the other single call image
+// printers (tpPrintPNM/PNG, tpPrintImageBlob...), tpPrintBMP()
+// ends the print session when it's done, unless it's called between
+// tpBeginImage() and tpEndImage()
+// returns -1 for errors
+//
+int tpDrawBMP(TPBMP *pBMP, TPDITHER *pDither, int x, int y);
+int tpPrintBMP(TPBMP *pBMP, TPDITHER *pDither);
+//
+// Read Netpbm images (P1/P4 bitmaps and P2/P5 graymaps, as exported by
+// most desktop tools) a row at a time through the same callback
+// returns 0 for success, -1 for an unsupported or invalid file
+//
+int tpPNMOpen(TPPNM *pPNM, TP_READ_CALLBACK *pfnRead, void *pUser);
+int tpPNMReadRow(TPPNM *pPNM, uint8_t *pGray, int iCount);
+int tpDrawPNM(TPPNM *pPNM, TPDITHER *pDither, int x, int y);
+int tpPrintPNM(TPPNM *pPNM, TPDITHER *pDither);
+//
+// Read PNG images a row at a time with the built-in inflater
+// All bit depths and color types are converted to gray (transparent
+// pixels become white); interlaced images aren't supported
+// pRowMem = 2 rows of the image (TP_PNG_ROW_MEM(width) is always enough)
+// returns 0 for success, -1 for an unsupported or invalid file or if
+// pRowMem is too small
+//
+int tpPNGOpen(TPPNG *pPNG, TP_READ_CALLBACK *pfnRead, void *pUser, uint8_t *pRowMem, int iRowMemSize);
+int tpPNGReadRow(TPPNG *pPNG, uint8_t *pGray, int iCount);
+int tpDrawPNG(TPPNG *pPNG, TPDITHER *pDither, int x, int y);
+int tpPrintPNG(TPPNG *pPNG, TPDITHER *pDither);
+//
+// Compile a 1-bpp image (MSB first, 1 = black, e.g. the back buffer) into
+// a print-ready blob for a printer model: the rows are mirrored, framed
+// and checksummed once, and runs of white rows become paper feeds. Save
+// the blob in flash or a file and print it any number of times with
+// tpPrintImageBlob(). Images wider than the printer are cropped.
+// pBlob = NULL just returns the size needed
+// returns the blob size or -1 for invalid parameters / too little room
+//
+int tpEncodeImage(int iPrinterType, const uint8_t *pBits, int iWidth, int iPitch, int iHeight, uint8_t *pBlob, int iBlobSize);
+//
+// Print a blob made by tpEncodeImage()
+// The header, printer model, width and CRC are checked first, then the
+// packets are sent straight from where they are (flash or RAM) without
+// copying or reformatting; the printer's flow control paces them.
+// The image is finished (print session ended) when it returns, unless
+// it's printed between tpBeginImage() and tpEndImage()
+// returns -1 if not connected or the blob is damaged or for another printer
+//
+int tpPrintImageBlob(const uint8_t *pBlob, int iSize);
+//
+// Same, for a blob in a file (read through the callback in MTU sized
+// pieces, twice: once for the CRC and once to send it)
+//
+int tpPrintImageBlobFile(TP_READ_CALLBACK *pfnRead, void *pUser);
+//
+// Receipt templates
+// Draw the parts of the receipt which never change (borders, logo,
+// headings) into the back buffer once, then turn them into a template:
+// the static layer is stored as ready to send printer lines in pMem
+// (TP_TEMPLATE_MEM(iHeight) bytes) and the back buffer is free again.
+// Each job only sets the field values and prints; just the field boxes
+// are rendered (and ORed over the static layer), the other rows are sent
+// as stored. iPrinterType = PRINTER_xxx
+// returns -1 for invalid parameters or too little memory, 0 for success
+//
+int tpTemplateInit(TPTEMPLATE *pTemplate, int iPrinterType, const uint8_t *pStatic, int iWidth, int iPitch, int iHeight, uint8_t *pMem, int iMemSize);
+//
+// Add a named field to a template
+// x,y,iWidth,iHeight = its box; text is clipped to the box and centered
+// vertically in it. pFont = a GFXfont, or NULL for the built-in font
+// iFontSize enlarged by iScale (1-4); iAlign = ALIGN_LEFT/CENTER/RIGHT,
+// or ALIGN_DECIMAL with iDecimals digits after the decimal point
+// The name isn't copied. returns the field number or -1
+//
+int tpTemplateAddField(TPTEMPLATE *pTemplate, const char *szName, int x, int y, int iWidth, int iHeight, GFXfont *pFont, int iFontSize, int iScale, int iAlign, int iDecimals);
+//
+// Set the text of a field for the next print (NULL or "" = empty)
+// The text isn't copied; it has to stay valid until the template is printed
+// returns -1 if there's no field with that name
+//
+int tpTemplateSetField(TPTEMPLATE *pTemplate, const char *szName, const char *szValue);
+//
+// Print a template with its current field values
+// The receipt is finished (print session ended) when it returns, unless
+// it's printed between tpBeginImage() and tpEndImage()
+// returns -1 if not connected or the template was made for another printer
+//
+int tpPrintTemplate(TPTEMPLATE *pTemplate);
 
 //
 // Fill the frame buffer with a byte pattern
 // e.g. all off (0x00) or all on (0xff)
+// Filling with 0 also resets the dirty row tracking; only the rows
+// touched by the drawing functions afterwards will be printed.
+// If you write into the buffer memory directly, call tpSetBackBuffer()
+// again (which marks every row as drawn) before printing.
 //
 void tpFill(unsigned char ucData);
 //
@@ -157,6 +648,8 @@ void tpFill(unsigned char ucData);
 int tpSetPixel(int x, int y, uint8_t ucColor);
 //
 // Send the graphics to the printer (must be connected over BLE first)
+// Untouched rows at the top and bottom are skipped and gaps
+// between drawn areas are sent as paper feeds
 //
 void tpPrintBuffer(void);
 //
@@ -164,14 +657,160 @@ void tpPrintBuffer(void);
 //
 void tpPrintBufferSide(void);
 //
+// Print an image as strips of rows arrive (e.g. from a JPEG decoder)
+// The graphics session stays open from tpBeginImage() to tpEndImage(), so
+// the strips join without gaps and no back buffer is needed. Each push
+// sends iCount rows of 1-bpp pixels (MSB first, 1 = black) straight from
+// the decoder's memory; bInvert = 1 for sources where 1 = white. Rows are
+// left aligned and cropped to the printer width; white rows become feeds.
+// The functions return -1 if not connected or no image was begun.
+//
+int tpBeginImage(void);
+int tpPushImageRows(const uint8_t *pRows, int iWidth, int iPitch, int iCount, int bInvert);
+int tpEndImage(void);
+//
 // Draw a line between 2 points
+// Lines which extend past the edges of the buffer are clipped
 //
 void tpDrawLine(int x1, int y1, int x2, int y2, uint8_t ucColor);
 //
+// Draw a rectangle between 2 corners (inclusive)
+// bFilled = 1 fills it with the color, 0 draws just the outline
+//
+void tpDrawRect(int x1, int y1, int x2, int y2, uint8_t ucColor, int bFilled);
+//
 // Draw text into the graphics buffer
+// x can be any pixel position (it doesn't need to be a multiple of 8)
 //
 int tpDrawText(int x, int y, char *szMsg, int iFontSize, int bInvert);
 //
+// Draw text enlarged by an integer factor (iScale = 1 to 4)
+// e.g. FONT_LARGE at 2x makes 32x64 characters for ticket numbers
+//
+int tpDrawScaledText(int x, int y, char *szMsg, int iFontSize, int iScale, int bInvert);
+//
+// Fill a polygon; edges may cross each other
+// iRule = FILL_EVEN_ODD or FILL_NON_ZERO decides which parts are inside
+// returns 0 for success, -1 if it has too many (>256) edges
+//
+int tpFillPolygon(TPPOINT *pPoints, int iCount, int iRule, uint8_t ucColor);
+//
+// Draw the outline of a polygon (the last point connects to the first)
+//
+int tpDrawPolygon(TPPOINT *pPoints, int iCount, uint8_t ucColor);
+//
+// Draw a circle or ellipse centered on x,y (outline or filled)
+//
+void tpDrawCircle(int x, int y, int r, uint8_t ucColor, int bFilled);
+void tpDrawEllipse(int x, int y, int rx, int ry, uint8_t ucColor, int bFilled);
+//
+// Draw a rectangle with rounded corners of radius r (outline or filled)
+//
+void tpDrawRoundRect(int x1, int y1, int x2, int y2, int r, uint8_t ucColor, int bFilled);
+//
+// Build a path of lines and Bezier curves, then fill or outline it
+// The path functions return -1 when the point memory is full
+// tpPathClose() connects the current contour back to its start;
+// tpFillPath() treats every contour as closed
+//
+void tpPathInit(TPPATH *pPath, TPPOINT *pPoints, int iMaxPoints);
+int tpPathMoveTo(TPPATH *pPath, int x, int y);
+int tpPathLineTo(TPPATH *pPath, int x, int y);
+int tpPathQuadTo(TPPATH *pPath, int cx, int cy, int x, int y);
+int tpPathCubicTo(TPPATH *pPath, int c1x, int c1y, int c2x, int c2y, int x, int y);
+int tpPathClose(TPPATH *pPath);
+int tpFillPath(TPPATH *pPath, int iRule, uint8_t ucColor);
+int tpDrawPath(TPPATH *pPath, uint8_t ucColor);
+//
+// Grayscale images
+// 8-bit gray rows (0 = black, 255 = white) are dithered to 1-bpp as they
+// arrive, so a photo never needs to be in memory as a whole
+// iWidth = pixels per row (up to TP_MAX_DITHER_WIDTH)
+// pErrors = TP_DITHER_ERRORS(iWidth) entries (can be NULL for DITHER_BAYER)
+// returns 0 for success, -1 for invalid parameters
+//
+int tpDitherInit(TPDITHER *pDither, int iMode, int iWidth, int16_t *pErrors);
+//
+// Thermal paper darkens steeply, so photos look muddy unless the midtones
+// are lifted first. A tone curve maps every gray level through a 256 byte
+// table; tpToneCurve() builds one from a gamma (in 1/100ths, > 100 is
+// lighter), a contrast change in percent (-100 to 100) and the input
+// black / white points. tpPrinterToneCurve() uses the values which suit a
+// printer model (PRINTER_xxx).
+// returns 0 for success, -1 for invalid parameters
+//
+int tpToneCurve(uint8_t *pLUT, int iGamma, int iContrast, int iBlack, int iWhite);
+int tpPrinterToneCurve(uint8_t *pLUT, int iPrinterType);
+//
+// Filter each row before it's dithered (call after tpDitherInit())
+// pLUT = tone curve or NULL
+// iSharpen = 3x3 unsharp mask amount in quarters (0 = off, 4 = 1.0, max 16)
+// pWindow = TP_DITHER_WINDOW(iWidth) bytes (3 rows of history + 1)
+// The mask needs the row below, so when sharpening each row out belongs
+// to the previous row in; pass pGray = NULL once more after the last row.
+//
+int tpDitherSetFilter(TPDITHER *pDither, const uint8_t *pLUT, int iSharpen, uint8_t *pWindow);
+//
+// Dither the next row into packed 1-bpp pixels in back buffer order
+// (MSB = leftmost, 1 = black); pOut needs (iWidth+7)/8 bytes
+// returns 1 if a row was written, 0 if sharpening is holding it back
+//
+int tpDitherRow(TPDITHER *pDither, const uint8_t *pGray, uint8_t *pOut);
+//
+// Dither the next row into the back buffer at x,y (y-1 when sharpening)
+// returns -1 if there's no back buffer or a display list is being recorded
+//
+int tpDitherToBuffer(TPDITHER *pDither, const uint8_t *pGray, int x, int y);
+//
+// Dither the next row and send it straight to the printer
+// (left aligned; white rows become paper feeds like text mode lines)
+// The print session stays open for more rows: print them between
+// tpBeginImage() and tpEndImage(), or end with tpFeed()
+// returns -1 if not connected
+//
+int tpPrintGrayRow(TPDITHER *pDither, const uint8_t *pGray);
+//
+// Ordered dither of one row against a tiled row of thresholds (src/dither.c)
+// Pixel x is black when pGray[x] < pThresh[x % iTileWidth]; iTileWidth
+// must be 8, 16, 32 or 64. Several pixels are compared per instruction.
+// returns -1 for an invalid tile width, 0 for success
+//
+extern "C" int tpThresholdRow(const uint8_t *pGray, const uint8_t *pThresh, int iTileWidth, uint8_t *pOut, int iWidth);
+//
+// Resize an image to fit the printer as it's read, keeping only one row
+// of sums. Push each source row, then pull the output rows it completes
+// (0 or more when enlarging); the output is 8-bit gray ready for
+// tpDitherRow() or tpPrintGrayRow():
+//   tpScalePush(&scaler, pSrcRow);
+//   while (tpScalePull(&scaler, ucGray))
+//      tpPrintGrayRow(&dither, ucGray);
+// iDestWidth = 0 fits the printer width, iDestHeight = 0 keeps the
+// aspect ratio; sizes are limited to TP_MAX_SCALE_SIZE
+// pMem = TP_SCALE_MEM(output width) words
+// returns 0 for success, -1 for invalid parameters
+//
+int tpScaleInit(TPSCALER *pScaler, int iFormat, int iSrcWidth, int iSrcHeight, int iDestWidth, int iDestHeight, uint32_t *pMem);
+//
+// Give the scaler the next source row
+// returns -1 if the previous row still has output rows waiting to be pulled
+// or the image is complete
+//
+int tpScalePush(TPSCALER *pScaler, const uint8_t *pSrc);
+//
+// Get the next finished output row (iDestWidth gray pixels)
+// returns 1 if a row was written to pGray, 0 if another source row is needed
+//
+int tpScalePull(TPSCALER *pScaler, uint8_t *pGray);
+//
+// Choose how much a JPEG decoder should shrink an image iWidth pixels
+// wide while decoding: the largest of 1, 2, 4 or 8 which still leaves at
+// least iDestWidth pixels (0 = the printer width) for tpScaleInit() to
+// finish. 2, 4 and 8 are the values of JPEGDEC's JPEG_SCALE_HALF/QUARTER/
+// EIGHTH options (use 0 for 1); a 2000 pixel photo for a 384 dot printer
+// is decoded at 1/4 size, which skips most of the IDCT work and memory.
+//
+int tpDecodeScale(int iWidth, int iDestWidth);
+//
 // Scan for compatible printers
 // returns true if found
 // and stores the printer address internally
@@ -0,0 +1,137 @@
+//
+// Thermal Printer Library - threshold (ordered) dithering kernel
+// written by Larry Bank
+// Copyright (c) 2021 BitBank Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Kept free of Arduino dependencies so the same code can be built and
+// timed on a PC (see tools/ditherbench). Unlike error diffusion, every
+// pixel of an ordered dither is independent, so several can be compared
+// at once: 4 per 32-bit word (SWAR) on the MCU, 16 or 32 per instruction
+// with SSE2/AVX2 on a PC. Define TP_NO_SIMD to use SWAR everywhere.
+//
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(TP_NO_SIMD) && defined(__AVX2__)
+#define TP_USE_AVX2
+#endif
+#if !defined(TP_NO_SIMD) && defined(__SSE2__)
+#define TP_USE_SSE2
+#endif
+#if defined(TP_USE_AVX2) || defined(TP_USE_SSE2)
+#include <immintrin.h>
+#endif
+// SWAR reads the pixels as little-endian words
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define TP_USE_SWAR
+#endif
+
+#if defined(TP_USE_AVX2) || defined(TP_USE_SSE2)
+//
+// The SIMD compares produce bit n for byte n (LSB first), but the printer
+// wants the first pixel in the MSB; reverse the bits of each byte
+//
+static uint32_t tpReverseBytes(uint32_t u32)
+{
+  u32 = ((u32 & 0xf0f0f0f0) >> 4) | ((u32 & 0x0f0f0f0f) << 4);
+  u32 = ((u32 & 0xcccccccc) >> 2) | ((u32 & 0x33333333) << 2);
+  u32 = ((u32 & 0xaaaaaaaa) >> 1) | ((u32 & 0x55555555) << 1);
+  return u32;
+} /* tpReverseBytes() */
+#endif
+
+#ifdef TP_USE_SWAR
+//
+// Compare 4 unsigned bytes at once (a < b) and return the 4 results as a
+// nibble with the first (lowest address) byte in the MSB. Each byte's low
+// 7 bits are subtracted with the high bit set so no borrow crosses into
+// the next byte; the high bits are then compared separately.
+//
+static uint32_t tpLess4(uint32_t a, uint32_t b)
+{
+uint32_t d, lt;
+
+  d = (a | 0x80808080) - (b & 0x7f7f7f7f); // high bit = (a & 0x7f) >= (b & 0x7f)
+  lt = ((~a & b) | (~(a ^ b) & ~d)) & 0x80808080;
+  // gather bits 7,15,23,31 into bits 27,26,25,24 with one multiply
+  return ((lt >> 7) * 0x08040201) >> 24;
+} /* tpLess4() */
+#endif
+//
+// Convert a row of 8-bit gray pixels to packed 1-bpp (MSB first, 1 = black)
+// by comparing pixel x against pThresh[x % iTileWidth]; gray < threshold
+// is black. The threshold row is one row of a tiled matrix (Bayer,
+// blue noise, ...) and must be 8, 16, 32 or 64 bytes wide.
+// Returns -1 for an invalid tile width, 0 for success.
+//
+int tpThresholdRow(const uint8_t *pGray, const uint8_t *pThresh, int iTileWidth, uint8_t *pOut, int iWidth)
+{
+int i, x;
+uint8_t ucTile[64], uc;
+#ifdef TP_USE_SWAR
+uint32_t a0, a1, b0, b1;
+#endif
+
+  if (iTileWidth < 8 || iTileWidth > 64 || (iTileWidth & (iTileWidth - 1)))
+    return -1;
+  // repeat the tile to 64 bytes so every vector width lines up with it
+  memcpy(ucTile, pThresh, iTileWidth);
+  for (i=iTileWidth; i<64; i <<= 1)
+    memcpy(&ucTile[i], ucTile, i);
+  x = 0;
+#ifdef TP_USE_AVX2
+  for (; x + 32 <= iWidth; x += 32) {
+    __m256i g = _mm256_loadu_si256((const __m256i *)&pGray[x]);
+    __m256i t = _mm256_loadu_si256((const __m256i *)&ucTile[x & 63]);
+    // the saturated difference t - g is only 0 when g >= t (white)
+    uint32_t u32 = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_subs_epu8(t, g), _mm256_setzero_si256()));
+    u32 = tpReverseBytes(u32);
+    pOut[(x >> 3)] = (uint8_t)u32;
+    pOut[(x >> 3) + 1] = (uint8_t)(u32 >> 8);
+    pOut[(x >> 3) + 2] = (uint8_t)(u32 >> 16);
+    pOut[(x >> 3) + 3] = (uint8_t)(u32 >> 24);
+  }
+#endif
+#ifdef TP_USE_SSE2
+  for (; x + 16 <= iWidth; x += 16) {
+    __m128i g = _mm_loadu_si128((const __m128i *)&pGray[x]);
+    __m128i t = _mm_loadu_si128((const __m128i *)&ucTile[x & 63]);
+    uint32_t u32 = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(t, g), _mm_setzero_si128()));
+    u32 = tpReverseBytes(u32);
+    pOut[(x >> 3)] = (uint8_t)u32;
+    pOut[(x >> 3) + 1] = (uint8_t)(u32 >> 8);
+  }
+#endif
+#ifdef TP_USE_SWAR
+  for (; x + 8 <= iWidth; x += 8) {
+    memcpy(&a0, &pGray[x], 4);
+    memcpy(&a1, &pGray[x+4], 4);
+    memcpy(&b0, &ucTile[x & 63], 4);
+    memcpy(&b1, &ucTile[(x & 63) + 4], 4);
+    pOut[x >> 3] = (uint8_t)((tpLess4(a0, b0) << 4) | tpLess4(a1, b1));
+  }
+#endif
+  // the last partial byte (or everything without SWAR)
+  for (; x < iWidth; x += 8) {
+    uc = 0;
+    for (i=0; i<8 && x + i < iWidth; i++) {
+      if (pGray[x + i] < ucTile[(x + i) & 63])
+        uc |= (0x80 >> i);
+    }
+    pOut[x >> 3] = uc;
+  }
+  return 0;
+} /* tpThresholdRow() */
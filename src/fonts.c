@@ -11,8 +11,10 @@
 // limitations under the License.
 //===========================================================================
 
-#ifdef CP852_SUPPORT
-const unsigned char ucFont[] = {
+//
+// Both 8x8 character sets are included; tpSetCodePage() selects one at runtime
+//
+const unsigned char ucFont852[] = {
 	// CP852 (Latin-2) character set by fulda :)
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 0x18,0x3c,0x3c,0x18,0x18,0x00,0x18,0x00,	// " " "!" (#32, 33)
 	0x6c,0x6c,0x6c,0x00,0x00,0x00,0x00,0x00, 0x6c,0x6c,0xfe,0x6c,0xfe,0x6c,0x6c,0x00,	// " # (34, 35)
@@ -126,7 +128,6 @@ const unsigned char ucFont[] = {
 	0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 0x12,0x24,0xcc,0xcc,0xcc,0xcc,0x76,0x00,	// ̇ ű (250, 251)
 	0x48,0xfc,0x66,0x7c,0x6c,0x66,0xe6,0x00, 0x48,0x30,0xdc,0x76,0x62,0x60,0xf0,0x00,	// Ř ř (252, 253)
 	0x00,0x00,0x3c,0x3c,0x3c,0x3c,0x00,0x00, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};	// ■   (254, 255)
-#else
 const unsigned char ucFont[] = {
 	// ANSI 437 character set
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, 0x18,0x3c,0x3c,0x18,0x18,0x00,0x18,0x00,	// " " "!" (#32, 33)
@@ -241,9 +242,12 @@ const unsigned char ucFont[] = {
 	0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00, 0x0f,0x0c,0x0c,0x0c,0xec,0x6c,0x3c,0x1c,	// ▪ √ (250, 251) ̇ ű
 	0x58,0x6c,0x6c,0x6c,0x6c,0x00,0x00,0x00, 0x70,0x98,0x30,0x60,0xf8,0x00,0x00,0x00,	// ⁿ ² (252, 253) Ř ř
 	0x00,0x00,0x3c,0x3c,0x3c,0x3c,0x00,0x00, 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};	// ■   (254, 255) ■  
-#endif
 
 
+//
+// 16x32 font; builds with TP_NO_BIG_FONT defined smooth the 8x8 font instead
+//
+#ifndef TP_NO_BIG_FONT
 const unsigned char ucBigFont[] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -1152,3 +1156,4 @@ const unsigned char ucBigFont[] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
+#endif // TP_NO_BIG_FONT
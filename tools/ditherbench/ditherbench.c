@@ -0,0 +1,155 @@
+//
+// ditherbench - times the Thermal_Printer library's threshold dither kernel
+// written by Larry Bank
+// Copyright (c) 2021 BitBank Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Dithers a random grayscale image with tpThresholdRow() (src/dither.c)
+// and with a one pixel at a time reference loop, checks that the output
+// matches bit for bit (every width from 1 to 576 and each tile size) and
+// reports the speed of both in megapixels per second.
+//
+// Build whichever kernel you want to measure:
+//   gcc -O2 -mavx2 -o ditherbench ditherbench.c ../../src/dither.c  (AVX2)
+//   gcc -O2 -o ditherbench ditherbench.c ../../src/dither.c         (SSE2 on x64)
+//   gcc -O2 -DTP_NO_SIMD -o ditherbench ditherbench.c ../../src/dither.c (SWAR)
+// Usage: ditherbench [width] [height]
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+int tpThresholdRow(const uint8_t *pGray, const uint8_t *pThresh, int iTileWidth, uint8_t *pOut, int iWidth);
+
+#define MAX_WIDTH 4096
+// same 8x8 Bayer matrix as the library's DITHER_BAYER
+static const uint8_t ucBayer8[64] = {
+    2,130, 34,162, 10,138, 42,170,
+  194, 66,226, 98,202, 74,234,106,
+   50,178, 18,146, 58,186, 26,154,
+  242,114,210, 82,250,122,218, 90,
+   14,142, 46,174,  6,134, 38,166,
+  206, 78,238,110,198, 70,230,102,
+   62,190, 30,158, 54,182, 22,150,
+  254,126,222, 94,246,118,214, 86};
+
+static const char *szKernel =
+#if !defined(TP_NO_SIMD) && defined(__AVX2__)
+  "AVX2 (32 pixels)";
+#elif !defined(TP_NO_SIMD) && defined(__SSE2__)
+  "SSE2 (16 pixels)";
+#else
+  "SWAR (4 pixels per word)";
+#endif
+//
+// One pixel at a time, as the library did it before
+//
+static void ScalarRow(const uint8_t *pGray, const uint8_t *pThresh, int iTileWidth, uint8_t *pOut, int iWidth)
+{
+int x;
+
+  memset(pOut, 0, (iWidth + 7) >> 3);
+  for (x=0; x<iWidth; x++) {
+    if (pGray[x] < pThresh[x & (iTileWidth - 1)])
+      pOut[x >> 3] |= (0x80 >> (x & 7));
+  }
+} /* ScalarRow() */
+
+static double Seconds(void)
+{
+struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+} /* Seconds() */
+//
+// Compare the two versions on every width and tile size
+//
+static int Verify(const uint8_t *pImage, const uint8_t *pThresh)
+{
+int iTile, iWidth, y;
+uint8_t ucRef[MAX_WIDTH/8], ucOut[MAX_WIDTH/8];
+
+  for (iTile = 8; iTile <= 64; iTile <<= 1) {
+    for (iWidth = 1; iWidth <= 576; iWidth++) {
+      for (y=0; y<8; y++) {
+        const uint8_t *pGray = &pImage[y * MAX_WIDTH];
+        const uint8_t *pRow = (iTile == 8) ? &pThresh[y * 8] : pThresh;
+        ScalarRow(pGray, pRow, iTile, ucRef, iWidth);
+        tpThresholdRow(pGray, pRow, iTile, ucOut, iWidth);
+        if (memcmp(ucRef, ucOut, (iWidth + 7) >> 3) != 0) {
+          printf("Mismatch: tile %d, width %d, row %d\n", iTile, iWidth, y);
+          return 0;
+        }
+      }
+    }
+  }
+  return 1;
+} /* Verify() */
+
+int main(int argc, char *argv[])
+{
+int x, y, iPass, iWidth = 576, iHeight = 2000, iPasses = 20;
+uint8_t *pImage, ucOut[MAX_WIDTH/8];
+uint8_t ucNoise[64];
+double dTime, dRef, dFast;
+volatile uint8_t ucSink = 0;
+
+  if (argc > 1) iWidth = atoi(argv[1]);
+  if (argc > 2) iHeight = atoi(argv[2]);
+  if (iWidth < 1 || iWidth > MAX_WIDTH || iHeight < 8) {
+    printf("Usage: ditherbench [width 1-%d] [height 8+]\n", MAX_WIDTH);
+    return -1;
+  }
+  pImage = (uint8_t *)malloc(MAX_WIDTH * iHeight);
+  srand(1234);
+  for (y=0; y<iHeight; y++) {
+    for (x=0; x<MAX_WIDTH; x++)
+      pImage[y * MAX_WIDTH + x] = (uint8_t)rand();
+  }
+  // any 64 thresholds will do to check the wider tiles
+  for (x=0; x<64; x++)
+    ucNoise[x] = (uint8_t)rand();
+  if (!Verify(pImage, ucBayer8) || !Verify(pImage, ucNoise)) {
+    free(pImage);
+    return -1;
+  }
+  printf("Kernel: %s, output matches the reference\n", szKernel);
+
+  dRef = dFast = 1e9; // best of several passes
+  for (iPass=0; iPass<iPasses; iPass++) {
+    dTime = Seconds();
+    for (y=0; y<iHeight; y++) {
+      ScalarRow(&pImage[y * MAX_WIDTH], &ucBayer8[(y & 7) * 8], 8, ucOut, iWidth);
+      ucSink ^= ucOut[0];
+    }
+    dTime = Seconds() - dTime;
+    if (dTime < dRef) dRef = dTime;
+    dTime = Seconds();
+    for (y=0; y<iHeight; y++) {
+      tpThresholdRow(&pImage[y * MAX_WIDTH], &ucBayer8[(y & 7) * 8], 8, ucOut, iWidth);
+      ucSink ^= ucOut[0];
+    }
+    dTime = Seconds() - dTime;
+    if (dTime < dFast) dFast = dTime;
+  }
+  printf("%d x %d pixels\n", iWidth, iHeight);
+  printf("Scalar reference: %8.1f MP/s\n", (double)iWidth * iHeight / dRef / 1e6);
+  printf("tpThresholdRow:   %8.1f MP/s (%.1fx)\n", (double)iWidth * iHeight / dFast / 1e6, dRef / dFast);
+  free(pImage);
+  return 0;
+} /* main() */
@@ -0,0 +1,468 @@
+//
+// fontcomp - Adafruit_GFX font compressor for the Thermal_Printer library
+// written by Larry Bank
+// Copyright (c) 2021 BitBank Software, Inc.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// Reads GFXfont header files and writes a converted copy of each one
+// next to it, then reports the size. The glyph table and font structure
+// keep the GFXfont layout; only the bitmap data changes.
+//   -rle (default) FONT_FORMAT_RLE, <name>_rle.h: each glyph row is XOR'd
+//        with the row above and the result is coded as runs of unchanged /
+//        flipped pixels in nibbles. Every glyph is decoded again and
+//        compared to the original.
+//   -rows FONT_FORMAT_ROWS, <name>_rows.h: each row starts on a byte
+//        boundary so it can be copied without unpacking bits
+//   -shifted FONT_FORMAT_ROWS_SHIFTED, <name>_shifted.h: 8 copies of the
+//        aligned rows, pre-shifted by 0-7 pixels (8x the size of -rows, for small
+//        fonts which need to be drawn as fast as possible)
+//
+// Build: gcc -O2 -o fontcomp fontcomp.c
+// Usage: fontcomp [-rle|-rows|-shifted] <font.h> [font2.h ...]
+//
+// In your sketch:
+//   #include "MyFont_rle.h"
+//   tpSetFontFormat((GFXfont *)&MyFont_RLE, FONT_FORMAT_RLE);
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+#define MAX_GLYPHS 256
+#define MAX_NAME 128
+// output formats (same values as the library's FONT_FORMAT_xxx)
+enum {
+  FORMAT_RLE = 1,
+  FORMAT_ROWS,
+  FORMAT_ROWS_SHIFTED
+};
+static const char *szFormatNames[] = {"", "RLE", "ROWS", "ROWS_SHIFTED"};
+static const char *szSuffix[] = {"", "rle", "rows", "shifted"};
+
+typedef struct tag_glyph {
+  int iOffset, iWidth, iHeight, iAdvance, xOffset, yOffset;
+} GLYPH;
+
+typedef struct tag_font {
+  char szName[MAX_NAME];
+  uint8_t *pBitmap;
+  int iBitmapSize;
+  GLYPH glyphs[MAX_GLYPHS];
+  int iGlyphCount;
+  int iFirst, iLast, iYAdvance;
+} FONT;
+
+typedef struct tag_nibbles {
+  uint8_t *pData;
+  int iCount; // nibbles written
+} NIBBLES;
+
+//
+// Read a whole file into memory (zero terminated)
+//
+static char *ReadFile(const char *szName)
+{
+FILE *f;
+long lSize;
+char *p;
+
+  f = fopen(szName, "rb");
+  if (f == NULL)
+    return NULL;
+  fseek(f, 0, SEEK_END);
+  lSize = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  p = (char *)malloc(lSize + 1);
+  if (p) {
+    if (fread(p, 1, lSize, f) != (size_t)lSize) {
+      free(p);
+      p = NULL;
+    } else {
+      p[lSize] = 0;
+    }
+  }
+  fclose(f);
+  return p;
+} /* ReadFile() */
+//
+// Blank out the comments so they can't be mistaken for data
+//
+static void StripComments(char *p)
+{
+  while (*p) {
+    if (p[0] == '/' && p[1] == '/') {
+      while (*p && *p != '\n') *p++ = ' ';
+    } else if (p[0] == '/' && p[1] == '*') {
+      while (*p && !(p[0] == '*' && p[1] == '/')) *p++ = ' ';
+      if (*p) { p[0] = p[1] = ' '; p += 2; }
+    } else {
+      p++;
+    }
+  }
+} /* StripComments() */
+//
+// Find the array whose declaration (before the '=') contains szType
+// returns a pointer to the first character after its '{'
+//
+static char *FindArray(char *p, const char *szType)
+{
+char *pEq, *pLine;
+
+  while ((pEq = strstr(p, "[]")) != NULL) {
+    pLine = pEq;
+    while (pLine > p && pLine[-1] != ';' && pLine[-1] != '}') pLine--;
+    p = pEq + 2;
+    if (strstr(pLine, szType) != NULL && strstr(pLine, szType) < pEq) {
+      p = strchr(p, '{');
+      return (p) ? p + 1 : NULL;
+    }
+  }
+  return NULL;
+} /* FindArray() */
+//
+// Parse a GFXfont header file
+// returns 0 for success, -1 for an error
+//
+static int ParseFont(char *pText, FONT *pFont)
+{
+char *p, *pEnd, *pNext, *pTableEnd;
+int i, iValues[6], iMax;
+long l;
+
+  StripComments(pText);
+  // bitmap data
+  p = FindArray(pText, "uint8_t");
+  if (p == NULL) return -1;
+  pEnd = strstr(p, "}");
+  iMax = (int)(pEnd - p) / 2; // more than enough
+  pFont->pBitmap = (uint8_t *)malloc(iMax + 1);
+  pFont->iBitmapSize = 0;
+  while (p < pEnd) {
+    l = strtol(p, &pNext, 0);
+    if (pNext == p) { p++; continue; } // not a number
+    pFont->pBitmap[pFont->iBitmapSize++] = (uint8_t)l;
+    p = pNext;
+  }
+  // glyph table
+  p = FindArray(pEnd, "GFXglyph");
+  if (p == NULL) return -1;
+  pTableEnd = strstr(p, "};");
+  if (pTableEnd == NULL) return -1;
+  pFont->iGlyphCount = 0;
+  while ((p = strchr(p, '{')) != NULL && p < pTableEnd) {
+    p++;
+    for (i=0; i<6; i++) {
+      while (*p && !isdigit((unsigned char)*p) && *p != '-') p++;
+      iValues[i] = (int)strtol(p, &p, 0);
+    }
+    if (pFont->iGlyphCount >= MAX_GLYPHS) return -1;
+    pFont->glyphs[pFont->iGlyphCount].iOffset = iValues[0];
+    pFont->glyphs[pFont->iGlyphCount].iWidth = iValues[1];
+    pFont->glyphs[pFont->iGlyphCount].iHeight = iValues[2];
+    pFont->glyphs[pFont->iGlyphCount].iAdvance = iValues[3];
+    pFont->glyphs[pFont->iGlyphCount].xOffset = iValues[4];
+    pFont->glyphs[pFont->iGlyphCount].yOffset = iValues[5];
+    pFont->iGlyphCount++;
+    p = strchr(p, '}');
+    if (p == NULL) return -1;
+  }
+  // font structure: name = the identifier after GFXfont, then the last 3 values
+  p = strstr(pTableEnd, "GFXfont");
+  if (p == NULL) return -1;
+  p += 7;
+  while (*p && !isalpha((unsigned char)*p) && *p != '_') p++;
+  if (strncmp(p, "PROGMEM", 7) == 0) return -1;
+  for (i=0; i<MAX_NAME-1 && (isalnum((unsigned char)*p) || *p == '_'); i++)
+    pFont->szName[i] = *p++;
+  pFont->szName[i] = 0;
+  pEnd = strchr(p, '}');
+  if (pEnd == NULL) return -1;
+  for (i=0; i<3; i++) { // walk back 3 numbers
+    pNext = pEnd;
+    while (pNext > p && pNext[-1] != ',') pNext--;
+    iValues[2-i] = (int)strtol(pNext, NULL, 0);
+    pEnd = pNext - 1;
+  }
+  pFont->iFirst = iValues[0];
+  pFont->iLast = iValues[1];
+  pFont->iYAdvance = iValues[2];
+  if (pFont->iGlyphCount == 0 || pFont->iGlyphCount > pFont->iLast - pFont->iFirst + 1) return -1;
+  if (pFont->iGlyphCount < pFont->iLast - pFont->iFirst + 1) { // some generators leave off the last glyph
+    fprintf(stderr, "%s: only has %d glyphs, last character changed to 0x%02X\n", pFont->szName,
+            pFont->iGlyphCount, pFont->iFirst + pFont->iGlyphCount - 1);
+    pFont->iLast = pFont->iFirst + pFont->iGlyphCount - 1;
+  }
+  return 0;
+} /* ParseFont() */
+
+static void PutNibble(NIBBLES *pOut, int n)
+{
+  if (pOut->iCount & 1)
+    pOut->pData[pOut->iCount >> 1] |= (uint8_t)n;
+  else
+    pOut->pData[pOut->iCount >> 1] = (uint8_t)(n << 4);
+  pOut->iCount++;
+} /* PutNibble() */
+//
+// Write a run length with the variable length nibble code
+//
+static void PutRun(NIBBLES *pOut, int iLen)
+{
+  if (iLen < 13) {
+    PutNibble(pOut, iLen);
+  } else if (iLen < 29) {
+    PutNibble(pOut, 13);
+    PutNibble(pOut, iLen - 13);
+  } else if (iLen < 285) {
+    PutNibble(pOut, 14);
+    PutNibble(pOut, (iLen - 29) >> 4);
+    PutNibble(pOut, (iLen - 29) & 0xf);
+  } else {
+    PutNibble(pOut, 15);
+    PutNibble(pOut, iLen >> 12);
+    PutNibble(pOut, (iLen >> 8) & 0xf);
+    PutNibble(pOut, (iLen >> 4) & 0xf);
+    PutNibble(pOut, iLen & 0xf);
+  }
+} /* PutRun() */
+
+static int GetPixel(const uint8_t *s, int iBit)
+{
+  return (s[iBit >> 3] >> (7 - (iBit & 7))) & 1;
+} /* GetPixel() */
+//
+// Compress one glyph; returns the number of bytes written
+//
+static int CompressGlyph(FONT *pFont, GLYPH *pGlyph, uint8_t *pOut)
+{
+NIBBLES out;
+int x, y, iBit, iRun, bFlip, iDelta;
+const uint8_t *s = &pFont->pBitmap[pGlyph->iOffset];
+
+  out.pData = pOut;
+  out.iCount = 0;
+  if (pGlyph->iWidth == 0 || pGlyph->iHeight == 0)
+    return 0;
+  bFlip = 0; // runs start with unchanged pixels
+  iRun = 0;
+  for (y=0; y<pGlyph->iHeight; y++) {
+    for (x=0; x<pGlyph->iWidth; x++) {
+      iBit = y * pGlyph->iWidth + x;
+      iDelta = GetPixel(s, iBit);
+      if (y > 0)
+        iDelta ^= GetPixel(s, iBit - pGlyph->iWidth);
+      if (iDelta != bFlip) { // run ends
+        PutRun(&out, iRun);
+        bFlip ^= 1;
+        iRun = 0;
+      }
+      iRun++;
+    }
+  }
+  PutRun(&out, iRun);
+  return (out.iCount + 1) >> 1;
+} /* CompressGlyph() */
+//
+// Decode a compressed glyph the same way the library does and compare
+// returns 0 if it matches the original
+//
+static int VerifyGlyph(FONT *pFont, GLYPH *pGlyph, const uint8_t *pComp)
+{
+uint8_t ucRow[256];
+int x, y, n, iRun = 0, bFlip = 1, iNib = 0;
+const uint8_t *s = &pFont->pBitmap[pGlyph->iOffset];
+#define NIB() ((iNib & 1) ? (pComp[iNib++ >> 1] & 0xf) : (pComp[iNib++ >> 1] >> 4))
+
+  memset(ucRow, 0, sizeof(ucRow));
+  for (y=0; y<pGlyph->iHeight; y++) {
+    for (x=0; x<pGlyph->iWidth; x++) {
+      while (iRun == 0) {
+        n = NIB();
+        if (n == 13) n += NIB();
+        else if (n == 14) { n = NIB() << 4; n += 29 + NIB(); }
+        else if (n == 15) { n = NIB() << 12; n |= NIB() << 8; n |= NIB() << 4; n |= NIB(); }
+        iRun = n;
+        bFlip ^= 1;
+      }
+      ucRow[x] ^= bFlip;
+      iRun--;
+      if (ucRow[x] != GetPixel(s, y * pGlyph->iWidth + x))
+        return -1;
+    }
+  }
+  return 0;
+} /* VerifyGlyph() */
+//
+// Write a glyph as byte aligned rows; iShifts = 1 (plain) or 8 (pre-shifted)
+// returns the number of bytes written
+//
+static int AlignGlyph(FONT *pFont, GLYPH *pGlyph, uint8_t *pOut, int iShifts)
+{
+int x, y, iShift, iPitch, iBit;
+const uint8_t *s = &pFont->pBitmap[pGlyph->iOffset];
+
+  if (pGlyph->iWidth == 0 || pGlyph->iHeight == 0)
+    return 0;
+  iPitch = (iShifts == 1) ? (pGlyph->iWidth + 7) / 8 : (pGlyph->iWidth + 14) / 8;
+  memset(pOut, 0, iPitch * pGlyph->iHeight * iShifts);
+  for (iShift=0; iShift<iShifts; iShift++) {
+    for (y=0; y<pGlyph->iHeight; y++) {
+      for (x=0; x<pGlyph->iWidth; x++) {
+        if (GetPixel(s, y * pGlyph->iWidth + x)) {
+          iBit = x + iShift;
+          pOut[(iShift * pGlyph->iHeight + y) * iPitch + (iBit >> 3)] |= (0x80 >> (iBit & 7));
+        }
+      }
+    }
+  }
+  return iPitch * pGlyph->iHeight * iShifts;
+} /* AlignGlyph() */
+//
+// Printable name of a character for the comments
+//
+static void CharName(int c, char *szOut)
+{
+  if (c >= 0x20 && c < 0x7f && c != '\\')
+    sprintf(szOut, "'%c'", c);
+  else
+    sprintf(szOut, "0x%02X", c);
+} /* CharName() */
+//
+// Convert a font file and write <name>_<format>.h
+// returns 0 for success
+//
+static int ProcessFile(const char *szIn, int iFormat)
+{
+FONT font;
+char *pText, szOut[1024], szNewName[MAX_NAME + 8], szChar[8];
+uint8_t *pComp;
+int *pOffsets, *pSizes;
+int i, j, iCompSize, iTable;
+FILE *f;
+
+  memset(&font, 0, sizeof(font));
+  pText = ReadFile(szIn);
+  if (pText == NULL) {
+    fprintf(stderr, "%s: can't read the file\n", szIn);
+    return -1;
+  }
+  if (ParseFont(pText, &font) != 0) {
+    fprintf(stderr, "%s: doesn't look like a GFXfont header\n", szIn);
+    free(pText);
+    return -1;
+  }
+  free(pText);
+  // compress each glyph
+  pComp = (uint8_t *)malloc(font.iBitmapSize * 12 + font.iGlyphCount * 2048); // worst case is well below this
+  pOffsets = (int *)malloc(sizeof(int) * font.iGlyphCount);
+  pSizes = (int *)malloc(sizeof(int) * font.iGlyphCount);
+  iCompSize = 0;
+  for (i=0; i<font.iGlyphCount; i++) {
+    GLYPH *pGlyph = &font.glyphs[i];
+    if (pGlyph->iOffset + (pGlyph->iWidth * pGlyph->iHeight + 7) / 8 > font.iBitmapSize) {
+      fprintf(stderr, "%s: glyph %d is outside the bitmap data\n", szIn, i);
+      return -1;
+    }
+    pOffsets[i] = iCompSize;
+    if (iFormat != FORMAT_RLE) {
+      pSizes[i] = AlignGlyph(&font, pGlyph, &pComp[iCompSize], (iFormat == FORMAT_ROWS) ? 1 : 8);
+    } else {
+      pSizes[i] = CompressGlyph(&font, pGlyph, &pComp[iCompSize]);
+    }
+    if (iFormat == FORMAT_RLE && VerifyGlyph(&font, pGlyph, &pComp[iCompSize]) != 0) {
+      fprintf(stderr, "%s: glyph %d didn't survive the round trip\n", szIn, i);
+      return -1;
+    }
+    iCompSize += pSizes[i];
+  }
+  if (iCompSize > 0xffff) {
+    fprintf(stderr, "%s: the %s data (%d bytes) is too big for 16-bit offsets\n", szIn, szSuffix[iFormat], iCompSize);
+    return -1;
+  }
+  // write the new header
+  strcpy(szOut, szIn);
+  if (strrchr(szOut, '.')) *strrchr(szOut, '.') = 0;
+  sprintf(&szOut[strlen(szOut)], "_%s.h", szSuffix[iFormat]);
+  sprintf(szNewName, "%s_%s", font.szName, (iFormat == FORMAT_RLE) ? "RLE" : (iFormat == FORMAT_ROWS) ? "ROWS" : "SHIFTED");
+  f = fopen(szOut, "wt");
+  if (f == NULL) {
+    fprintf(stderr, "%s: can't create the file\n", szOut);
+    return -1;
+  }
+  fprintf(f, "// %s converted by fontcomp to FONT_FORMAT_%s (%d bytes of glyph data instead of %d)\n",
+          font.szName, szFormatNames[iFormat], iCompSize, font.iBitmapSize);
+  fprintf(f, "// Call tpSetFontFormat((GFXfont *)&%s, FONT_FORMAT_%s) before using it\n", szNewName, szFormatNames[iFormat]);
+  fprintf(f, "const uint8_t %sBitmaps[] PROGMEM = {\n", szNewName);
+  for (i=0; i<font.iGlyphCount; i++) {
+    if (pSizes[i] == 0) continue;
+    CharName(font.iFirst + i, szChar);
+    fprintf(f, "\t");
+    for (j=0; j<pSizes[i]; j++)
+      fprintf(f, "0x%02X,", pComp[pOffsets[i] + j]);
+    fprintf(f, " // %s\n", szChar);
+  }
+  if (iCompSize == 0)
+    fprintf(f, "\t0x00\n");
+  fprintf(f, "};\n");
+  fprintf(f, "const GFXglyph %sGlyphs[] PROGMEM = {\n", szNewName);
+  fprintf(f, "// bitmapOffset, width, height, xAdvance, xOffset, yOffset\n");
+  for (i=0; i<font.iGlyphCount; i++) {
+    GLYPH *pGlyph = &font.glyphs[i];
+    CharName(font.iFirst + i, szChar);
+    fprintf(f, "\t  { %5d, %3d, %3d, %3d, %4d, %4d }%s // %s\n", pOffsets[i], pGlyph->iWidth,
+            pGlyph->iHeight, pGlyph->iAdvance, pGlyph->xOffset, pGlyph->yOffset,
+            (i < font.iGlyphCount - 1) ? "," : " ", szChar);
+  }
+  fprintf(f, "};\n");
+  fprintf(f, "const GFXfont %s PROGMEM = {\n", szNewName);
+  fprintf(f, "(uint8_t  *)%sBitmaps,(GFXglyph *)%sGlyphs,0x%02X, 0x%02X, %d};\n", szNewName, szNewName,
+          font.iFirst, font.iLast, font.iYAdvance);
+  fclose(f);
+  iTable = font.iGlyphCount * 8; // the glyph table doesn't change
+  printf("%-24s %5d glyphs  bitmaps %6d -> %6d bytes (%+4d%%)  total %6d -> %6d  %s\n",
+         font.szName, font.iGlyphCount, font.iBitmapSize, iCompSize,
+         (font.iBitmapSize) ? (iCompSize * 100 / font.iBitmapSize) - 100 : 0,
+         font.iBitmapSize + iTable, iCompSize + iTable, szOut);
+  free(pComp);
+  free(pOffsets);
+  free(pSizes);
+  free(font.pBitmap);
+  return 0;
+} /* ProcessFile() */
+
+int main(int argc, char *argv[])
+{
+int i, iErrors = 0, iFormat = FORMAT_RLE;
+
+  if (argc < 2) {
+    printf("fontcomp - convert Adafruit_GFX fonts for the Thermal_Printer library\n");
+    printf("usage: fontcomp [-rle|-rows|-shifted] <font.h> [font2.h ...]\n");
+    printf("writes <font>_rle.h, _rows.h or _shifted.h next to each input file\n");
+    return 1;
+  }
+  for (i=1; i<argc; i++) {
+    if (strcmp(argv[i], "-rle") == 0)
+      iFormat = FORMAT_RLE;
+    else if (strcmp(argv[i], "-rows") == 0)
+      iFormat = FORMAT_ROWS;
+    else if (strcmp(argv[i], "-shifted") == 0)
+      iFormat = FORMAT_ROWS_SHIFTED;
+    else if (ProcessFile(argv[i], iFormat) != 0)
+      iErrors++;
+  }
+  return (iErrors) ? 1 : 0;
+} /* main() */